@@ -41,8 +41,82 @@
 
   Dual console (important)
   ------------------------
-  • All prints go to USB (Serial) and Serial1 simultaneously.
+  • All prints go to USB (Serial) and Serial1 simultaneously, except replies:
+    CLI answers and the station's reply to a CLI command (matched by FID,
+    on P01 by ctrl) go only to the console that asked.
+  • JBC commands are queued per console (4 each) and sent round-robin, one
+    per loop pass. A queued command is already encoded (errors are reported
+    right away) and keeps a short echo for the [*_CLI_SEND] line. While the
+    link is down or the FW bootstrap is still running the line itself is held
+    (max. 63 characters) and flushed in order afterwards; a command older than
+    10 s (CLI_HOLD_MS) is dropped with a "[CLI] verworfen" line instead.
   • Input is read from both ports and logged with a prefix: [USB UART] / [S1 UART].
+  • Output goes through a 256-byte buffer per port (CON_TXBUF) that loop()
+    drains as far as the UART has room, so short bursts never stall the
+    firmware. When a buffer is full the per-port policy decides: BLOCK (wait,
+    default), OLD (drop the oldest unsent line) or NEW (drop the new line).
+    Lines are never cut. A port with binary output (OUT ... BIN, RPC) always
+    blocks, because its records are not delimited by line ends. "TXBUF" shows fill level, peak and drop counters;
+    "TXBUF S1 OLD" sets the policy (persisted).
+    Each line is first assembled in a 128-byte line buffer (CON_LINEBUF) and
+    then routed/filtered once and written with one call per port. "PERF"
+    shows the time spent per decoded frame and per output line.
+    Numbers, hex bytes and fixed-point values (°C, %) are formatted by
+    jbc_fmt.h (nibble table, no divisions, no float) instead of
+    Print::print; "PERF FMT" times both on the same values and checks that
+    they produce the same bytes.
+  • Backpressure (SHED): if a port keeps falling behind for 0.5 s (buffer over
+    3/4 full, dropped lines or BLOCK waits on every 100 ms check), its output
+    is reduced by one level; a single burst such as HELP does not count. Level
+    1 pauses HEX/[RAW] and [TX]/[RX]. Level 2 also replaces the per-port
+    CONTIMODE_SENDING lines with one CONTIMODE_SUMMARY line per burst (seq,
+    ports, active, max_c, max_pct, changes). A port steps back one level after
+    5 s without such sustained pressure. Every change is announced as "[SHED]
+    S1 level=…". "SHED" shows the state and "SHED OFF" disables the automatic
+    mode (not persisted).
+  • Change-only conti output (CONTIDELTA): "CONTIDELTA <°C> <%> [hb_s]" prints
+    a CONTIMODE_SENDING line for a port only when a temperature moved by at
+    least the °C deadband, power/flow by at least the % deadband, the
+    flags/status differ, changes is non-zero or the port has been silent for
+    hb_s seconds (heartbeat, 0 = none). Compared against the last line printed
+    for that port, decided once per burst for all formats and remembered only
+    when a console actually received the port line (not with CONTISEND OFF,
+    SHED summary or an OUT mask without CONTI). "CONTIDELTA ON|OFF" toggles it
+    (default off, 2.0 °C, 2.0 %, 60 s; persisted), "CONTIDELTA" shows
+    shown/skipped port lines.
+  • Per-port output filter: every line has a category (REPLY, SYN, CONTI, TXRX,
+    HEX, STATUS) and each port a persisted mask. "OUT S1 1" = replies, conti
+    telemetry and status only; "OUT USB 3" = everything; "OUT S1 -STATUS +SYN"
+    adjusts single categories. Replies and messages routed to the asking console
+    always pass (its [TX]/HEX lines still follow the mask).
+    HEX/LOG/SYN ON still decide whether such lines are produced at all.
+  • JSON Lines per port: "OUT S1 JSON" (persisted, "OUT S1 TEXT" = back) makes
+    the same decoders emit one object per decoded frame on that port, e.g.
+      {"family":"SOLD","ctrl":"M_R_SELECTTEMP","ctrl_id":80,"fid":10,
+       "fields":{"c":350.0,"uti":"0x0C4E"}}
+    Numbers stay numbers, hex values/bit names/texts are strings, missing
+    values null. Status lines stay plain text (filter them with OUT -STATUS).
+  • Binary telemetry per port: "OUT S1 BIN" (persisted) sends each decoded line
+    as a compact record instead: B5 <len> <body> <crc8 poly 07 over len+body>,
+    body = <record id> <family> <ctrl> <fid> then (field id<<3 | type) + value
+    as varints; temperatures are fixed point ×10 (zigzag), hex/counters plain
+    varints, texts length-prefixed. A BIN port gets nothing but these records
+    and replies to its own commands. "OUT SCHEMA" lists the frame format, the
+    record/field IDs (append-only) and the sent/dropped counters.
+  • Binary RPC on Serial1: "RPC ON" (persisted, from either console) switches
+    Serial1 from the text CLI to COBS frames terminated by 00:
+      request  <op> <id lo> <id hi> <args> <crc16 lo> <crc16 hi>
+      response <op|80> <id lo> <id hi> <status> <data> <crc16>
+    (CRC-16/CCITT-FALSE; frames with a bad CRC are dropped unanswered). Ops:
+    01 PING, 02 STATUS, 10 JBC <ctrl> <payload> (reply: station ctrl +
+    payload), 20 CFG_GET <key>, 21 CFG_SET <key> <val> (keys in jbc_rpc.h;
+    key 8 = 0 returns to the text CLI). JBC requests share the Serial1 TX
+    queue, rate limit and reply routing with text commands, so several can be
+    in flight and are matched by ID. Status: 0 OK, 1 bad op, 2 bad args,
+    3 queue full, 4 rate limited, 5 no link, 6 timeout, 7 truncated.
+    No text output reaches Serial1 while RPC is on; "RPC OFF" on USB ends it.
+    Replies are never dropped: Serial1 blocks while RPC is on, whatever TXBUF
+    policy is set.
   • Mega/ADK: TX1=18, RX1=19.
   • IMPORTANT: Only Arduino MEGA 2560 ADK or Arduino MEGA with USB Host Shield 2.0!
 
@@ -57,6 +131,30 @@
   • USBCLI: USB-originated JBC TX is read-only by default; enable with “USBCLI ON”.
   • CLI echo shows real FIDs and backend tag ([SOLD_CLI_SEND] …).
     For P01, FID=0 is logged as a placeholder.
+  • Tagged commands: "#42 M_R_SLEEPTEMP 0 T245" – every output line belonging to
+    this request (echo, errors, the station's reply) starts with "#42 ", so a
+    client can keep several commands in flight. Without a reply within 1.5 s a
+    tagged "[CLI] Keine Antwort" line closes the request. On a JSON port the
+    reply object carries "tag":42 instead of the prefix.
+  • Scripts (EEPROM 64..1023): "SCRIPT REC <name> [gap ms]" stores the following
+    M_ lines of that console already encoded instead of sending them, "SCRIPT END"
+    saves. "SCRIPT RUN <name>" plays one step at a time (next step after the reply
+    or timeout plus gap) and ends with a summary (ok/nack/no reply/duration).
+    "SCRIPT AUTO <name> ON" runs it 1.5 s after every link-up + FW. Also LIST,
+    SHOW, DEL, GAP, STOP, ABORT. A script only runs on the backend it was recorded for.
+  • "SWEEP [p0[-p1]] M_R_SELECTTEMP; M_R_SLEEPTEMP T245" sends up to 4 read
+    commands for every port (default: all ports from the FW string; the port is
+    inserted as the first argument), keeps 4 requests in flight (P01: 1) and
+    prints one line per port with all decoded replies once they are in. Each
+    command is encoded once at start; the frames go through the console's
+    command queue like typed lines (one slot stays free for them).
+  • Rate limit: each console has a token bucket for JBC command lines (default
+    10/s, burst 16, persisted). Throttled lines are dropped with a "[CLI]
+    gedrosselt" line and counted; "RATE" shows/sets it ("RATE S1 10 20",
+    0 = unlimited), "RATE RESET" clears the counters. SWEEP and SCRIPT RUN
+    frames take a token of the starting console each and wait for one when
+    the bucket is empty (autorun scripts are not limited); a line the full
+    queue refuses gets its token back.
   • Optional byte logging: CLI_DEBUG_RX (0/1).
   • Non-ASCII: CLI passes bytes ≥0x80; supports Backspace/DEL and CR/LF.
 
@@ -77,7 +175,10 @@
   Dependencies
   ------------
   • Usb.h, usbhub.h, CP210x.h
-  • jbc_commands_full.h, jbc_cmd_names.h, jbc_payload_decode.h, jbc_console_map.h
+  • jbc_commands_full.h, jbc_cmd_names.h, jbc_payload_decode.h, jbc_console_map.h, jbc_script.h
+  • jbc_commands_full.h, jbc_cmd_tables.h, jbc_ctrl_meta.h are generated from tools/jbc_commands.spec,
+    jbc_bin_schema.h (binary record/field IDs) from tools/jbc_bin_schema.spec
+    (python3 tools/gen_jbc_tables.py; it refuses to change an existing ID)
 
 
   Deutsch:
@@ -120,9 +221,85 @@
 
   Dual-Konsole (wichtig)
   ----------------------
-  • Alle Prints gehen gleichzeitig auf USB (Serial) und Serial1.
+  • Alle Prints gehen gleichzeitig auf USB (Serial) und Serial1, außer Antworten:
+    CLI-Antworten und die Antwort der Station auf ein CLI-Kommando (Zuordnung
+    über FID, bei P01 über Ctrl) gehen nur an die fragende Konsole.
+  • JBC-Kommandos werden je Konsole gepuffert (je 4) und im Round-Robin
+    gesendet, eines pro loop()-Durchlauf. Gepuffert wird schon kodiert (Fehler
+    kommen sofort) mit einem kurzen Echo für die [*_CLI_SEND]-Zeile. Ist der Link
+    down oder der FW-Bootstrap noch nicht durch, bleibt die Zeile selbst liegen
+    (max. 63 Zeichen) und geht danach in Reihenfolge raus; was älter als 10 s
+    ist (CLI_HOLD_MS), wird mit "[CLI] verworfen" gemeldet.
   • Eingaben werden von beiden Ports gelesen und mit Präfix geloggt:
       [USB UART] bzw. [S1 UART].
+  • Ausgaben laufen je Port über einen 256-Byte-Puffer (CON_TXBUF), den loop()
+    leert, soweit der UART Platz hat – kurze Bursts halten die Firmware nicht
+    mehr an. Ist ein Puffer voll, entscheidet die Politik je Port: BLOCK (warten,
+    Standard), OLD (älteste noch nicht gesendete Zeile verwerfen) oder NEW (neue
+    Zeile verwerfen). Zeilen werden nie abgeschnitten. Ein Port mit binärer
+    Ausgabe (OUT ... BIN, RPC) blockiert immer, seine Datensätze enden nicht mit
+    einem Zeilenende. "TXBUF" zeigt Füllstand,
+    Spitze und Verwerf-Zähler; "TXBUF S1 OLD" setzt die Politik (persistiert).
+    Jede Zeile wird zuerst in einem 128-Byte-Zeilenpuffer (CON_LINEBUF)
+    gesammelt, dann einmal geroutet/gefiltert und mit einem Aufruf je Port
+    geschrieben. "PERF" zeigt die Zeit je dekodiertem Frame und je Ausgabezeile.
+    Zahlen, Hex-Bytes und Festkommawerte (°C, %) formatiert jbc_fmt.h
+    (Nibble-Tabelle, ohne Division, ohne Float) statt Print::print;
+    "PERF FMT" misst beides mit denselben Werten und prüft, dass dieselben
+    Bytes herauskommen.
+  • Rückstau (SHED): kommt ein Port 0,5 s lang nicht hinterher (bei jeder
+    Prüfung alle 100 ms Puffer über 3/4 voll, verworfene Zeilen oder
+    BLOCK-Wartezeiten), wird seine Ausgabe um eine Stufe reduziert; ein
+    einzelner Schwall wie HELP zählt nicht. Stufe 1 pausiert HEX/[RAW] und
+    [TX]/[RX]. Stufe 2 ersetzt zusätzlich die CONTIMODE_SENDING-Zeilen je Port
+    durch eine CONTIMODE_SUMMARY-Zeile je Burst (seq, ports, active, max_c,
+    max_pct, changes). Nach 5 s ohne solchen Dauerdruck geht es eine Stufe
+    zurück. Jeder Wechsel wird als "[SHED] S1 level=…" gemeldet. "SHED" zeigt
+    den Zustand, "SHED OFF" schaltet die Automatik ab (nicht persistiert).
+  • Conti nur bei Änderung (CONTIDELTA): "CONTIDELTA <°C> <%> [hb_s]" gibt
+    eine CONTIMODE_SENDING-Zeile je Port nur aus, wenn sich eine Temperatur um
+    mindestens das °C-Totband, Leistung/Flow um mindestens das %-Totband
+    geändert hat, Flags/Status anders sind, changes nicht 0 ist oder der Port
+    hb_s Sekunden stumm war (Herzschlag, 0 = keiner). Verglichen wird mit der
+    zuletzt ausgegebenen Zeile des Ports, entschieden einmal je Burst für alle
+    Formate und gemerkt nur, wenn eine Konsole die Port-Zeile wirklich
+    bekommen hat (nicht bei CONTISEND OFF, SHED-Summe oder OUT-Maske ohne
+    CONTI). "CONTIDELTA ON|OFF" schaltet um (Default aus, 2,0 °C, 2,0 %, 60 s;
+    persistiert), "CONTIDELTA" zeigt gezeigte/übersprungene Port-Zeilen.
+  • Ausgabefilter je Port: jede Zeile hat eine Kategorie (REPLY, SYN, CONTI, TXRX,
+    HEX, STATUS), jeder Port eine persistierte Maske. "OUT S1 1" = nur Antworten,
+    Contimode-Telemetrie und Status; "OUT USB 3" = alles; "OUT S1 -STATUS +SYN"
+    ändert einzelne Kategorien. An die fragende Konsole geroutete Antworten und
+    Meldungen gehen immer durch (deren [TX]/HEX-Zeilen folgen der Maske).
+    HEX/LOG/SYN ON bestimmen weiterhin, ob solche Zeilen entstehen.
+  • JSON Lines je Port: "OUT S1 JSON" (persistiert, "OUT S1 TEXT" = zurück) lässt
+    dieselben Decoder je dekodiertem Frame ein Objekt auf diesem Port ausgeben, z. B.
+      {"family":"SOLD","ctrl":"M_R_SELECTTEMP","ctrl_id":80,"fid":10,
+       "fields":{"c":350.0,"uti":"0x0C4E"}}
+    Zahlen bleiben Zahlen, Hex-Werte/Bit-Namen/Texte werden Strings, fehlende
+    Werte null. Statuszeilen bleiben Text (ausblenden mit OUT -STATUS).
+  • Binär-Telemetrie je Port: "OUT S1 BIN" (persistiert) sendet jede dekodierte
+    Zeile stattdessen als kompakten Datensatz: B5 <len> <body> <crc8 Poly 07 über
+    len+body>, body = <Datensatz-ID> <Familie> <ctrl> <fid>, dann je Feld
+    (Feld-ID<<3 | Typ) + Wert als Varints; Temperaturen Festkomma ×10 (zigzag),
+    Hex-Werte/Zähler als Varint, Texte mit Längenbyte. Ein BIN-Port bekommt nur
+    diese Datensätze und Antworten auf seine eigenen Befehle. "OUT SCHEMA" listet
+    Rahmenformat, Datensatz-/Feld-IDs (nur angehängt) und Zähler sent/dropped.
+  • Binäres RPC auf Serial1: "RPC ON" (persistiert, von jeder Konsole) stellt
+    Serial1 von der Text-CLI auf COBS-Rahmen mit abschließender 00 um:
+      Anfrage  <op> <id lo> <id hi> <args> <crc16 lo> <crc16 hi>
+      Antwort  <op|80> <id lo> <id hi> <status> <daten> <crc16>
+    (CRC-16/CCITT-FALSE; Rahmen mit falscher CRC werden ohne Antwort verworfen).
+    Ops: 01 PING, 02 STATUS, 10 JBC <ctrl> <payload> (Antwort: Ctrl + Payload
+    der Station), 20 CFG_GET <key>, 21 CFG_SET <key> <wert> (Schlüssel in
+    jbc_rpc.h; Schlüssel 8 = 0 schaltet zurück auf Text). JBC-Anfragen teilen
+    Warteschlange, Drossel und Antwort-Routing von Serial1 mit den Text-
+    Kommandos, mehrere dürfen offen sein und werden über die ID zugeordnet.
+    Status: 0 OK, 1 Op unbekannt, 2 Argumente, 3 Warteschlange voll,
+    4 gedrosselt, 5 kein Link, 6 Timeout, 7 gekürzt.
+    Solange RPC an ist, geht keine Text-Ausgabe an Serial1; "RPC OFF" über USB.
+    Antworten werden nie verworfen: Serial1 blockiert dann unabhängig von der
+    TXBUF-Politik.
   • Mega/ADK: TX1=18, RX1=19.
   • WICHTIG: Nur Arduino MEGA 2560 ADK oder Arduino MEGA 2560 mit USB Host Shield 2.0 kompatibel.
 
@@ -138,6 +315,31 @@
             Mit „USBCLI ON“ freigeben.
   • CLI-Echo zeigt echte FIDs und Backend-Tag ([SOLD_CLI_SEND] …).
     Bei P01 wird FID=0 als Platzhalter geloggt.
+  • Getaggte Kommandos: "#42 M_R_SLEEPTEMP 0 T245" – jede Ausgabezeile zu dieser
+    Anfrage (Echo, Fehler, Antwort der Station) beginnt mit "#42 "; ein Client kann
+    so mehrere Kommandos gleichzeitig offen halten. Ohne Antwort in 1,5 s schließt
+    eine getaggte Zeile "[CLI] Keine Antwort" die Anfrage ab. Auf einem JSON-Port
+    trägt das Antwort-Objekt statt des Präfixes "tag":42.
+  • Skripte (EEPROM 64..1023): "SCRIPT REC <name> [abstand ms]" speichert die folgenden
+    M_-Zeilen dieser Konsole fertig kodiert, statt sie zu senden; "SCRIPT END" sichert.
+    "SCRIPT RUN <name>" spielt Schritt für Schritt ab (nächster Schritt nach Antwort
+    bzw. Timeout + Abstand) und endet mit einer Zusammenfassung (ok/nack/ohne
+    Antwort/Dauer). "SCRIPT AUTO <name> ON" startet es 1,5 s nach jedem Link-Up + FW.
+    Dazu LIST, SHOW, DEL, GAP, STOP, ABORT. Ein Skript läuft nur auf dem Backend,
+    für das es aufgezeichnet wurde.
+  • "SWEEP [p0[-p1]] M_R_SELECTTEMP; M_R_SLEEPTEMP T245" schickt bis zu 4 Lesebefehle
+    an jeden Port (Standard: alle Ports laut FW-String; der Port wird als erstes
+    Argument eingesetzt), hält 4 Anfragen gleichzeitig offen (P01: 1) und gibt je
+    Port eine Zeile mit allen dekodierten Antworten aus, sobald sie da sind. Jeder
+    Befehl wird beim Start einmal kodiert; die Frames laufen wie getippte Zeilen
+    durch die Warteschlange der Konsole (ein Platz bleibt für diese frei).
+  • Drossel: jede Konsole hat einen Token-Bucket für JBC-Kommandozeilen (Standard
+    10/s, Burst 16, persistiert). Gedrosselte Zeilen werden mit "[CLI] gedrosselt"
+    verworfen und gezählt; "RATE" zeigt/setzt ("RATE S1 10 20", 0 = unbegrenzt),
+    "RATE RESET" setzt die Zähler zurück. SWEEP- und SCRIPT-RUN-Frames kosten je ein
+    Token der startenden Konsole und warten bei leerem Eimer (Autorun-Skripte sind
+    nicht gedrosselt); eine Zeile, die die volle Warteschlange abweist, bekommt ihr
+    Token zurück.
   • Optionales Byte-Logging: CLI_DEBUG_RX (0/1).
   • Nicht-ASCII/Sonderzeichen: CLI lässt Bytes ≥0x80 passieren; Backspace/DEL,
     CR/LF werden unterstützt.
@@ -159,7 +361,10 @@
   Abhängigkeiten
   --------------
   • Usb.h, usbhub.h, CP210x.h
-  • jbc_commands_full.h, jbc_cmd_names.h, jbc_payload_decode.h, jbc_console_map.h
+  • jbc_commands_full.h, jbc_cmd_names.h, jbc_payload_decode.h, jbc_console_map.h, jbc_script.h
+  • jbc_commands_full.h, jbc_cmd_tables.h, jbc_ctrl_meta.h werden aus tools/jbc_commands.spec,
+    jbc_bin_schema.h (Datensatz-/Feld-IDs der Binär-Telemetrie) aus tools/jbc_bin_schema.spec
+    erzeugt (python3 tools/gen_jbc_tables.py; bestehende IDs ändert er nicht)
 */
 
 
@@ -167,6 +372,38 @@
 
 #include <Arduino.h>
 
+// Konsolen als Bitmaske (Ausgabeziele, Quelle einer CLI-Zeile)
+enum : uint8_t { CON_USB = 0x01, CON_S1 = 0x02, CON_ALL = 0x03 };
+static const uint16_t CLI_NO_TAG = 0xFFFF;   // Zeile ohne "#<tag>"
+
+// Sende-Puffer je Konsole und Verhalten, wenn er voll ist
+#ifndef CON_TXBUF
+#define CON_TXBUF 256
+#endif
+// Zeilenpuffer: eine Ausgabezeile wird gesammelt und einmal je Konsole geschrieben
+#ifndef CON_LINEBUF
+#define CON_LINEBUF 128
+#endif
+static_assert(CON_LINEBUF <= 255, "CON_LINEBUF: Füllstand (_line_n) ist uint8_t");
+enum : uint8_t { TXP_BLOCK = 0, TXP_DROP_OLD = 1, TXP_DROP_NEW = 2 };
+
+// Ausgabe-Kategorien; je Konsole eine Maske (REPLY/SYN/CONTI == jbc_decode::SINK_*)
+enum : uint8_t {
+  CAT_REPLY  = 0x01,   // dekodierte Antworten/Events
+  CAT_SYN    = 0x02,   // M_SYN-Zeilen
+  CAT_CONTI  = 0x04,   // Contimode-Telemetrie
+  CAT_TXRX   = 0x08,   // [TX]/[RX]
+  CAT_HEX    = 0x10,   // HEX-/[RAW]-Dumps
+  CAT_STATUS = 0x20,   // alles andere (Link, Proto, AUTO, CFG, ...)
+  CAT_ALL    = 0x3F,
+  CAT_CONTI_SUM = 0x40,   // Conti-Summe je Burst: nur für gedrosselte Konsolen (SHED), nicht in OUT
+  CAT_FRAME  = CAT_REPLY | CAT_SYN | CAT_CONTI | CAT_CONTI_SUM   // Frame-Dekodes (je Konsole Text, JSON oder binär)
+};
+// Drosselstufe je Konsole bei Rückstau (SHED): 1 = ohne HEX/TXRX, 2 = Conti nur als Summe
+enum : uint8_t { SHED_OFF = 0, SHED_DEBUG = 1, SHED_CONTI = 2 };
+// Darstellung der Frame-Dekodes je Konsole (jbc_decode::g_fmt)
+enum : uint8_t { FMT_TEXT = 0, FMT_JSON = 1, FMT_BIN = 2 };
+
 #if defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
   // „Echte“ Ports benennen
   HardwareSerial& USBSER = ::Serial;
@@ -174,7 +411,7 @@
 
   class DualSerial : public Stream {
   public:
-    DualSerial(HardwareSerial& a, HardwareSerial& b) : _a(&a), _b(&b) {}
+    DualSerial(HardwareSerial& a, HardwareSerial& b) : _a(&a), _b(&b) { _s[0].hw = &a; _s[1].hw = &b; }
 
     void begin(unsigned long baud) { _a->begin(baud); _b->begin(baud); }
     void end()                     { _a->end();       _b->end();       }
@@ -190,12 +427,112 @@
       if (_b->available()) return _b->peek();
       return -1;
     }
-    void flush(void) override { _a->flush(); _b->flush(); }
+    void flush(void) override {
+      line_flush();
+      for (uint8_t i=0; i<2; i++) while (_s[i].count) drain(_s[i], true);
+      _a->flush(); _b->flush();
+    }
+
+    // Aus loop(): Sende-Puffer so weit leeren, wie die HW-Puffer Platz haben (blockiert nie)
+    void pump() {
+      line_flush();   // angefangene Zeile (ohne '\n') nicht liegen lassen
+      for (uint8_t i=0; i<2; i++){
+        uint16_t before = _s[i].count;
+        drain(_s[i], false);
+        if (_s[i].count && _s[i].count != before) drain(_s[i], false);   // Rest hinter dem Ring-Umbruch
+      }
+    }
+
+    // Sink i (0 = USB, 1 = S1)
+    void     set_policy(uint8_t i, uint8_t p) { _s[i].policy = p; }
+    uint8_t  policy(uint8_t i) const  { return _s[i].policy; }
+    uint16_t queued(uint8_t i) const  { return _s[i].count; }
+    uint16_t peak(uint8_t i) const    { return _s[i].peak; }
+    uint32_t drops(uint8_t i) const   { return _s[i].drops; }
+    uint32_t stalls(uint8_t i) const  { return _s[i].stalls; }
+    bool     framed(uint8_t i) const  { return _s[i].framed; }
+    void     clear_stats()            { for (uint8_t i=0; i<2; i++){ _s[i].drops = _s[i].stalls = 0; _s[i].peak = _s[i].count; } }
+
+    // Ausgabe nur an einen Teil der Konsolen (CON_USB = a, CON_S1 = b); 0 = beide
+    void    set_sinks(uint8_t m) { line_flush(); _sinks = m ? m : (uint8_t)CON_ALL; }
+    uint8_t sinks() const        { return _sinks; }
+
+    // Getaggte CLI-Anfrage: jede Textzeile beginnt mit "#<tag> " (JSON: Feld "tag"); CLI_NO_TAG = aus
+    uint16_t tag() const { return _tag_id; }
+    void set_tag(uint16_t t) {
+      _tag_id = t;
+      _tag_len = 0;
+      if (t == CLI_NO_TAG) return;
+      char d[5]; uint8_t n = 0;
+      do { d[n++] = (char)('0' + t % 10); t /= 10; } while (t);
+      _tag[_tag_len++] = '#';
+      while (n) _tag[_tag_len++] = d[--n];
+      _tag[_tag_len++] = ' ';
+    }
+
+    // Kategorie der folgenden Ausgabe (liefert die vorige); Maske je Konsole (0 = USB, 1 = S1)
+    uint8_t set_cat(uint8_t c)             { line_flush(); uint8_t o = _cat; _cat = c; return o; }
+    void    set_mask(uint8_t i, uint8_t m) { line_flush(); _mask[i] = m; }
+    uint8_t mask(uint8_t i) const          { return _mask[i]; }
+
+    // Drosselstufe (SHED_*) je Konsole; wirkt zusätzlich zur Maske
+    void    set_shed(uint8_t i, uint8_t l) { line_flush(); _shed[i] = l; }
+    uint8_t shed(uint8_t i) const          { return _shed[i]; }
+    uint8_t cat_mask(uint8_t i) const {
+      uint8_t m = _mask[i];
+      if (_shed[i] >= SHED_DEBUG) m &= (uint8_t)~(CAT_HEX | CAT_TXRX);
+      if (_shed[i] >= SHED_CONTI && (m & CAT_CONTI)) m ^= CAT_CONTI | CAT_CONTI_SUM;   // Port-Zeilen -> Summe
+      return m;
+    }
 
-    size_t write(uint8_t c) override { _a->write(c); _b->write(c); return 1; }
+    // Konsolen (CON_*), die Frame-Dekodes als JSON Lines bzw. binär bekommen;
+    // pass = Fassung (FMT_*) der laufenden Ausgabe, FMT_TEXT = normal
+    void    set_formats(uint8_t json, uint8_t bin) { line_flush(); _json = json; _bin = bin; frame_sinks(); }
+    uint8_t fmt_sinks(uint8_t f) const {
+      return f == FMT_JSON ? _json : f == FMT_BIN ? _bin : (uint8_t)(CON_ALL & ~(_json | _bin | _rpc));
+    }
+    // Konsolen im RPC-Modus bekommen nur noch raw() (RPC-Antworten), keine normale Ausgabe
+    void    set_rpc(uint8_t m) { line_flush(); _rpc = m; frame_sinks(); }
+    void    raw(uint8_t m, const uint8_t* p, size_t n) {
+      line_flush();
+      if (m & CON_USB) sink_write(_s[0], p, n);
+      if (m & CON_S1)  sink_write(_s[1], p, n);
+    }
+    void    set_pass(uint8_t f) { line_flush(); _pass = f; _bol = true; }
+
+    // Konsolen, an die die nächste Ausgabe ginge (Routing + Kategorie-Maske)
+    uint8_t targets() const {
+      // an eine Konsole geroutet (CLI): Antworten und Meldungen gehen immer durch
+      uint8_t m = _sinks, always = (m == CON_ALL) ? 0 : (CAT_REPLY | CAT_STATUS);
+      if (!((cat_mask(0) | always) & _cat)) m &= (uint8_t)~CON_USB;
+      if (!((cat_mask(1) | always) & _cat)) m &= (uint8_t)~CON_S1;
+      return m;
+    }
+
+    // Mehrere Zeilen zu einer zusammenziehen: Zeilenende -> " | " vor dem nächsten Zeichen
+    void set_join(bool on) { _join = on; _join_sep = false; }
+
+    // Zeichen landen im Zeilenpuffer; Routing/Maske werden erst beim Zeilenende einmal ausgewertet
+    size_t write(uint8_t c) override {
+      if (_pass == FMT_BIN) return put(&c, 1) ? 1 : 0;   // Datensätze ohne Tag/Join; 0 = an niemanden
+      if (_join){
+        if (c == '\r') return 1;
+        if (c == '\n') { _join_sep = true; return 1; }
+        if (_join_sep) { _join_sep = false; line_add((const uint8_t*)" | ", 3); }
+      }
+      if (_bol && _tag_len && _pass == FMT_TEXT) line_add((const uint8_t*)_tag, _tag_len);   // JSON: in rec_open()
+      _bol = (c == '\n');
+      line_add(&c, 1);
+      return 1;
+    }
     size_t write(const uint8_t* buf, size_t size) override {
-      _a->write(buf, size); _b->write(buf, size); return size;
+      if (_pass == FMT_BIN) return put(buf, size) ? size : 0;
+      if (_tag_len || _join) { for (size_t i=0; i<size; i++) write(buf[i]); return size; }
+      line_add(buf, size);
+      if (size) _bol = (buf[size-1] == '\n');
+      return size;
     }
+    uint32_t lines() const { return _lines; }
 
 
     using Print::write;
@@ -204,19 +541,228 @@
     operator bool() const { return true; }
 
   private:
+    // Ring je Konsole; verworfen wird immer zeilenweise, eine angefangene Zeile nie abgeschnitten
+    struct Sink {
+      HardwareSerial* hw;
+      uint8_t  buf[CON_TXBUF];
+      uint16_t head = 0, count = 0;   // head = nächster freier Platz
+      uint16_t cur = 0;               // Bytes der unfertigen (neuesten) Zeile im Ring
+      uint16_t peak = 0;
+      uint32_t drops = 0;             // verworfene Zeilen
+      uint32_t stalls = 0;            // Ring voll und nichts verwerfbar: auf die HW gewartet
+      uint8_t  policy = TXP_BLOCK;
+      bool     cur_sent = false;      // Teil der unfertigen Zeile ist schon raus
+      bool     tx_mid = false;        // HW steht mitten in einer Zeile
+      bool     skip = false;          // DROP_NEW: Rest der Zeile verwerfen
+      bool     framed = false;        // binäre Datensätze bzw. RPC-Rahmen (ohne '\n'): nie verwerfen, immer BLOCK
+    };
+
+    static uint16_t tail(const Sink& s) { return (uint16_t)((s.head + CON_TXBUF - s.count) % CON_TXBUF); }
+
+    // Zusammenhängenden Teil ab tail an die HW; blocking: mindestens ein Stück, notfalls wartend
+    static void drain(Sink& s, bool blocking) {
+      if (!s.count) return;
+      uint16_t t = tail(s);
+      uint16_t n = s.count;
+      if (n > CON_TXBUF - t) n = CON_TXBUF - t;
+      if (!blocking) {
+        int room = s.hw->availableForWrite();
+        if (room <= 0) return;
+        if (n > (uint16_t)room) n = (uint16_t)room;
+      }
+      s.hw->write(s.buf + t, n);
+      s.tx_mid = (s.buf[(t + n - 1) % CON_TXBUF] != '\n');
+      s.count -= n;
+      if (s.count < s.cur) { s.cur = s.count; s.cur_sent = true; }
+    }
+
+    // Bytes [off, off+len) ab tail entfernen (die off Bytes davor rücken nach)
+    static void erase(Sink& s, uint16_t off, uint16_t len) {
+      uint16_t t = tail(s);
+      for (uint16_t i = off; i-- > 0; )
+        s.buf[(t + i + len) % CON_TXBUF] = s.buf[(t + i) % CON_TXBUF];
+      s.count -= len;
+    }
+
+    // Offset des nächsten '\n' ab from im Bereich fertiger Zeilen, sonst 0xFFFF
+    static uint16_t find_nl(const Sink& s, uint16_t from) {
+      uint16_t t = tail(s), done = s.count - s.cur;
+      for (uint16_t i = from; i < done; i++) if (s.buf[(t + i) % CON_TXBUF] == '\n') return i;
+      return 0xFFFF;
+    }
+
+    // Älteste noch nicht angefangene Zeile verwerfen
+    static bool drop_oldest(Sink& s) {
+      uint16_t from = 0;
+      if (s.tx_mid) {                               // laufende Zeile zu Ende senden lassen
+        uint16_t e = find_nl(s, 0);
+        if (e == 0xFFFF) return false;
+        from = e + 1;
+      }
+      uint16_t e = find_nl(s, from);
+      if (e == 0xFFFF) return false;
+      erase(s, from, e + 1 - from);
+      s.drops++;
+      return true;
+    }
+
+    // Ring voll: Platz schaffen; false = neues Byte verwerfen (DROP_NEW)
+    static bool make_room(Sink& s) {
+      const uint8_t pol = s.framed ? (uint8_t)TXP_BLOCK : s.policy;   // '\n' trennt dort keine Datensätze
+      if (pol == TXP_DROP_OLD && drop_oldest(s)) return true;
+      if (pol == TXP_DROP_NEW && !s.cur_sent) {   // unfertige Zeile samt Rest verwerfen
+        s.head  = (uint16_t)((s.head + CON_TXBUF - s.cur) % CON_TXBUF);
+        s.count -= s.cur;
+        s.cur   = 0;
+        s.skip  = true;
+        s.drops++;
+        return false;
+      }
+      drain(s, true);                                // BLOCK (bzw. nichts Verwerfbares)
+      s.stalls++;
+      return true;
+    }
+
+    static void sink_write(Sink& s, const uint8_t* p, size_t n) {
+      // schneller Weg: nichts gepuffert -> so viel wie die HW nimmt direkt, nur der Rest in den Ring
+      if (!s.count && !s.skip) {
+        int room = s.hw->availableForWrite();
+        if (room > 0) {
+          size_t k = (n <= (size_t)room) ? n : (size_t)room;
+          s.hw->write(p, k);
+          s.tx_mid = (p[k - 1] != '\n');
+          if (k == n) return;
+          p += k; n -= k;
+          s.cur_sent = s.tx_mid;   // Rest gehört zu einer schon angefangenen Zeile
+        }
+      }
+      // Rest stückweise in den Ring: je Stück bis Platz-/Ring-Ende oder '\n'
+      while (n) {
+        if (s.skip) {                                   // DROP_NEW: bis zum Zeilenende verwerfen
+          const uint8_t* nl = (const uint8_t*)memchr(p, '\n', n);
+          if (!nl) break;
+          s.skip = false;
+          n -= (size_t)(nl - p) + 1; p = nl + 1;
+          continue;
+        }
+        if (s.count == CON_TXBUF && !make_room(s)) continue;
+        size_t k = CON_TXBUF - s.count, w = CON_TXBUF - s.head;
+        if (k > w) k = w;
+        if (k > n) k = n;
+        const uint8_t* nl = (const uint8_t*)memchr(p, '\n', k);
+        if (nl) k = (size_t)(nl - p) + 1;
+        memcpy(s.buf + s.head, p, k);
+        s.head = (uint16_t)((s.head + k) % CON_TXBUF);
+        s.count += (uint16_t)k;
+        p += k; n -= k;
+        if (nl) { s.cur = 0; s.cur_sent = false; } else s.cur += (uint16_t)k;
+      }
+      if (s.count > s.peak) s.peak = s.count;
+    }
+
+    // Konsolen mit binären Datensätzen oder RPC-Rahmen (COBS, Ende 00) blockieren statt zu verwerfen. Beim Wechsel wird der Ring
+    // erst geleert, damit keine Zeilenpolitik alte Datensätze (bzw. Datensätze alte Zeilen) trifft.
+    void frame_sinks() {
+      for (uint8_t i=0; i<2; i++){
+        Sink& s = _s[i];
+        const bool f = ((_bin | _rpc) >> i) & 1;
+        if (f == s.framed) continue;
+        while (s.count) drain(s, true);
+        s.cur = 0; s.cur_sent = s.tx_mid = s.skip = false;
+        s.framed = f;
+      }
+    }
+
+    // An den Zeilenpuffer anhängen; bei '\n' oder vollem Puffer ausgeben
+    void line_add(const uint8_t* p, size_t n) {
+      while (n) {
+        size_t k = CON_LINEBUF - _line_n;
+        if (k > n) k = n;
+        const uint8_t* nl = (const uint8_t*)memchr(p, '\n', k);
+        if (nl) k = (size_t)(nl - p) + 1;
+        memcpy(_line + _line_n, p, k);
+        _line_n += k; p += k; n -= k;
+        if (nl) _lines++;
+        if (nl || _line_n == CON_LINEBUF) line_flush();
+      }
+    }
+    void line_flush() {
+      if (!_line_n) return;
+      put(_line, _line_n);
+      _line_n = 0;
+    }
+
+    // liefert die Konsolen (CON_*), an die es ging
+    uint8_t put(const uint8_t* buf, size_t size) {
+      if (!size) return 0;
+      uint8_t m = targets();
+      if (_pass || (_cat & CAT_FRAME)) m &= fmt_sinks(_pass);   // jede Fassung der Frames nur an ihre Konsolen
+      if (!_pass && _sinks == CON_ALL) m &= (uint8_t)~_bin;      // Binär-Konsolen: sonst nur Antworten an sie selbst
+      m &= (uint8_t)~_rpc;
+      if (m & CON_USB) sink_write(_s[0], buf, size);
+      if (m & CON_S1)  sink_write(_s[1], buf, size);
+      return m;
+    }
+
     HardwareSerial* _a;
     HardwareSerial* _b;
+    uint8_t _sinks = CON_ALL;
+    bool    _bol = true;       // nächstes Zeichen beginnt eine Zeile
+    char    _tag[7];           // "#65534 "
+    uint8_t _tag_len = 0;
+    uint16_t _tag_id = CLI_NO_TAG;
+    bool    _join = false, _join_sep = false;
+    uint8_t _cat = CAT_STATUS;
+    uint8_t _mask[2] = { CAT_ALL, CAT_ALL };
+    uint8_t _shed[2] = { SHED_OFF, SHED_OFF };
+    uint8_t _json = 0, _bin = 0, _rpc = 0;
+    uint8_t _pass = FMT_TEXT;
+    uint8_t _line[CON_LINEBUF];
+    uint8_t _line_n = 0;
+    uint32_t _lines = 0;       // ausgegebene Zeilen (PERF)
+    Sink    _s[2];
   };
 
   // Ab hier wird *jede* Verwendung von Serial (auch in später inkludierten Headers)
   // auf die Dual-Konsole umgebogen:
   DualSerial Console(USBSER, AUXSER);
   #define Serial Console
+  static inline void con_route(uint8_t m){ Console.set_sinks(m); }
+  static inline void con_tag(uint16_t t){ Console.set_tag(t); }
+  static inline uint16_t con_cur_tag(){ return Console.tag(); }
+  static inline void con_join(bool on){ Console.set_join(on); }
+  static inline void con_pump(){ Console.pump(); }
+  static inline void con_set_policy(uint8_t i, uint8_t p){ Console.set_policy(i, p); }
+  static inline uint8_t con_cat(uint8_t c){ return Console.set_cat(c); }
+  static inline void con_set_mask(uint8_t i, uint8_t m){ Console.set_mask(i, m); }
+  static inline void con_set_formats(uint8_t json, uint8_t bin){ Console.set_formats(json, bin); }
+  static inline uint8_t con_fmt_targets(uint8_t f){ return Console.targets() & Console.fmt_sinks(f); }
+  static inline void con_pass(uint8_t f){ Console.set_pass(f); }
+  static inline void con_set_rpc(uint8_t m){ Console.set_rpc(m); }
+  static inline void con_raw(uint8_t m, const uint8_t* p, uint8_t n){ Console.raw(m, p, n); }
+  static inline uint32_t con_lines(){ return Console.lines(); }
+  static inline uint8_t con_shed_max(){ const uint8_t a = Console.shed(0), b = Console.shed(1); return a > b ? a : b; }
 #else
   #warning "Dual-Konsole braucht einen AVR mit Serial1 (z. B. ATmega2560/1280)."
   HardwareSerial& USBSER = ::Serial;
   HardwareSerial& AUXSER = ::Serial1;
+  static inline void con_route(uint8_t){}
+  static inline void con_tag(uint16_t){}
+  static inline uint16_t con_cur_tag(){ return CLI_NO_TAG; }
+  static inline void con_join(bool){}
+  static inline void con_pump(){}
+  static inline void con_set_policy(uint8_t, uint8_t){}
+  static inline uint8_t con_cat(uint8_t){ return CAT_STATUS; }
+  static inline void con_set_mask(uint8_t, uint8_t){}
+  static inline void con_set_formats(uint8_t, uint8_t){}
+  static inline uint8_t con_fmt_targets(uint8_t f){ return f == FMT_TEXT ? CON_ALL : 0; }
+  static inline void con_pass(uint8_t){}
+  static inline void con_set_rpc(uint8_t){}
+  static inline void con_raw(uint8_t m, const uint8_t* p, uint8_t n){ if (m & CON_S1) AUXSER.write(p, n); }
+  static inline uint32_t con_lines(){ return 0; }
+  static inline uint8_t con_shed_max(){ return SHED_OFF; }
 #endif
+static inline void con_reset(){ con_route(CON_ALL); con_tag(CLI_NO_TAG); con_cat(CAT_STATUS); }
 // ============================================================================
 
 struct Cfg;
@@ -232,12 +778,20 @@ struct Cfg;
 #include "jbc_cmd_names.h"       // Namen + Backend-/Print-Mapper (JBC_PRINT_*)
 #include "jbc_payload_decode.h"  // << NEU: Payload-Dekoder/Pretty-Printer
 #include "jbc_console_map.h"     // << NEU: CLI-Map (Text -> (ctrl,payload))
+#include "jbc_script.h"          // Kommando-Skripte im EEPROM
+#include "jbc_rpc.h"             // Binäres RPC (COBS + CRC16) auf Serial1
 
 using namespace jbc_cmd;
 
 bool jbc_decode::g_log_show_fid = true;
 int  jbc_decode::g_log_cur_fid  = -1;
+int  jbc_decode::g_log_cur_ctrl = -1;
+Backend jbc_decode::g_log_cur_be = BK_UNKNOWN;
+uint8_t jbc_decode::g_fmt = FMT_TEXT;
+uint16_t jbc_decode::g_log_cur_tag = CLI_NO_TAG;
+bool jbc_decode::g_fx = true;
 bool jbc_decode::g_show_conti_send = true;   // Default, wird in setup() aus EEPROM überschrieben
+uint8_t jbc_decode::g_sink_interest = jbc_decode::SINK_DECODE | jbc_decode::SINK_CONTI; // via sink_interest_update()
 
 
 #define SERIAL_BAUD     250000
@@ -274,6 +828,10 @@ Adafruit_NeoPixel strip(NUM_LEDS, LED_PIN, NEO_GRBW + NEO_KHZ800);
 // --- USB-Status verzögert setzen ---
 #define USB_SET_DELAY_MS 5000   // 5 s nach FW
 
+// --- Skripte (SCRIPT RUN / Autorun) ---
+#define SCRIPT_AUTORUN_DELAY_MS 1500   // Autorun 1,5 s nach FW
+#define SCRIPT_GAP_DEFAULT_MS   200    // Abstand Antwort → nächster Schritt
+
 // ---- Bridge-Info ----
 #ifndef BRIDGE_FW
 #define BRIDGE_FW    "V4.11.0RC"                 
@@ -295,40 +853,138 @@ Adafruit_NeoPixel strip(NUM_LEDS, LED_PIN, NEO_GRBW + NEO_KHZ800);
 #define CFGF_AUTO_USB_C  0x01
 #define CFGF_SHOW_CONTI  0x02   // neu: CONTIMODE-Logs anzeigen?
 #define CFGF_USBCLI_EN  0x04   // USB-CLI darf JBC senden?
+#define CFGF_S1_RPC     0x08   // Serial1 spricht binäres RPC statt Text-CLI
+#define CFGF_TXP_SHIFT  4      // Bits 4..5 USB, 6..7 S1: TXP_* (Sende-Puffer voll)
 
 // ===== CLI: EINMALIGE GLOBALS & PRÄFIX =====
 
 
 static bool g_cli_from_usb         = false; // Quelle der aktuellen CLI-Zeile: true=USB, false=Serial1
+static uint16_t g_cli_tag          = CLI_NO_TAG; // "#<tag>" der aktuellen CLI-Zeile
 
 static inline const __FlashStringHelper* cli_src_prefix(){
   return g_cli_from_usb ? F("[USB UART]") : F("[S1 UART]");
 }
+static inline uint8_t cli_src_con(){ return g_cli_from_usb ? CON_USB : CON_S1; }
+
+// Ausgabe-Kontext der aktuellen CLI-Zeile: nur an die fragende Konsole, ggf. mit Tag
+static inline void cli_ctx_begin(){ con_route(cli_src_con()); con_tag(g_cli_tag); }
+
+// ---- Antwort-Routing: gesendetes CLI-Kommando -> fragende Konsole ----
+// P02: Zuordnung über die FID (Station antwortet mit derselben FID), P01: über Ctrl (ältester Eintrag).
+#define CLI_PENDING_MAX       8
+#define CLI_REPLY_TIMEOUT_MS  1500
+struct CliPending {
+  uint32_t t_sent;
+  uint16_t tag;    // CLI_NO_TAG = ungetaggt
+  uint8_t  fid;    // P01: 0
+  uint8_t  ctrl;
+  uint8_t  con;    // CON_USB / CON_S1, 0 = frei
+  bool     rpc;    // RPC-Anfrage: tag = Request-ID, Antwort als RPC-Rahmen
+};
+static CliPending g_cli_pending[CLI_PENDING_MAX];
+
+static void rpc_respond(uint16_t id, uint8_t op, uint8_t st, const uint8_t* a=nullptr, uint8_t an=0,
+                        const uint8_t* b=nullptr, uint8_t bn=0);   // RPC, siehe unten
+
+static void cli_pending_add(uint8_t fid, uint8_t ctrl, uint8_t con, uint16_t tag, bool rpc=false){
+  CliPending* slot = &g_cli_pending[0];          // freier Slot, sonst der älteste
+  for (uint8_t i=0; i<CLI_PENDING_MAX; i++){
+    CliPending& p = g_cli_pending[i];
+    if (!p.con){ slot = &p; break; }
+    if ((int32_t)(p.t_sent - slot->t_sent) < 0) slot = &p;
+  }
+  slot->t_sent = millis(); slot->tag = tag; slot->fid = fid; slot->ctrl = ctrl; slot->con = con; slot->rpc = rpc;
+}
+
+// Ausgabe-Kontext für ein empfangenes Frame setzen; passender Eintrag wird verbraucht.
+// RPC-Anfragen bekommen das Frame als Antwort-Rahmen, die Text-Ausgabe bleibt dann normal.
+static void cli_reply_route(uint8_t fid, uint8_t ctrl, bool p01, const uint8_t* d, uint8_t len){
+  CliPending* hit = nullptr;
+  for (uint8_t i=0; i<CLI_PENDING_MAX; i++){
+    CliPending& p = g_cli_pending[i];
+    if (!p.con) continue;
+    if (p01 ? (p.ctrl != ctrl) : (p.fid != fid)) continue;
+    if (!hit || (int32_t)(p.t_sent - hit->t_sent) < 0) hit = &p;
+  }
+  if (!hit) return;
+  const uint8_t con = hit->con;
+  hit->con = 0;
+  if (hit->rpc){
+    const bool trunc = len > jbc_rpc::DATA_MAX - 1;
+    rpc_respond(hit->tag, jbc_rpc::OP_JBC, trunc ? jbc_rpc::ST_TRUNC : jbc_rpc::ST_OK,
+                &ctrl, 1, d, trunc ? jbc_rpc::DATA_MAX - 1 : len);
+    return;
+  }
+  con_route(con);
+  con_tag(hit->tag);
+}
+
+// Abgelaufene (all: alle) Einträge freigeben; getaggte Anfragen bekommen eine Abschlusszeile
+static void cli_pending_expire(bool all){
+  uint32_t now = millis();
+  for (uint8_t i=0; i<CLI_PENDING_MAX; i++){
+    CliPending& p = g_cli_pending[i];
+    if (!p.con || (!all && now - p.t_sent <= CLI_REPLY_TIMEOUT_MS)) continue;
+    if (p.rpc) rpc_respond(p.tag, jbc_rpc::OP_JBC, all ? jbc_rpc::ST_NOLINK : jbc_rpc::ST_TIMEOUT, &p.ctrl, 1);
+    else if (p.tag != CLI_NO_TAG){
+      con_route(p.con); con_tag(p.tag);
+      Serial.print(p.con == CON_USB ? F("[USB UART]") : F("[S1 UART]"));
+      Serial.print(F(" [CLI] Keine Antwort <fid=")); Serial.print(p.fid);
+      Serial.print(F("> ctrl=0x")); Serial.println(p.ctrl, HEX);
+      con_reset();
+    }
+    p.con = 0;
+  }
+}
 // ---------- Persistente Konfiguration (EEPROM) ----------
 
 
+#define CFG_VERSION 6
+#define RATE_DEFAULT_PER_S  10  // CLI-Kommandos je Sekunde und Konsole
+#define RATE_DEFAULT_BURST  16
+
 struct Cfg {
   uint16_t magic;   // "JC" = 0x4A43
-  uint8_t  version; // 1
+  uint8_t  version; // CFG_VERSION
   uint8_t  flags;   // Bit0: AUTO_USB_C (1=an)
-  uint8_t  crc;     // XOR über die ersten Bytes
+  uint8_t  rate[2]; // v2: Token-Bucket je Quelle [0]=USB [1]=S1, Kommandos/s (0 = unbegrenzt)
+  uint8_t  burst[2];
+  uint8_t  out_mask[2]; // v3: CAT_* je Konsole [0]=USB [1]=S1
+  uint8_t  json;        // v4: CON_*, die Frames als JSON Lines bekommen
+  uint8_t  bin;         // v5: CON_*, die Frames als Binär-Datensätze bekommen (vor json)
+  uint8_t  delta_on;    // v6: CONTIDELTA (Conti-Port-Zeilen nur bei Änderung)
+  uint8_t  delta_dc;    //     Totband °C ×10
+  uint8_t  delta_pm;    //     Totband ‰
+  uint8_t  delta_hb;    //     Herzschlag s (0 = keiner)
+  uint8_t  crc;     // XOR über alle Bytes davor
 };
 
 static Cfg g_cfg;
 static bool auto_usb_c = true; // Laufzeit-Flag (spiegelt EEPROM)
 static bool show_contisend = true;  // Laufzeit-Flag (wird aus EEPROM geladen)
 static bool g_usb_jbc_send_enabled = false; // USB darf JBC senden? Default: nein (read-only)
+static bool g_s1_rpc = false;               // Serial1 im RPC-Modus (spiegelt EEPROM)
 
 static uint8_t cfg_crc(const Cfg& c){
   const uint8_t* p = (const uint8_t*)&c;
-  uint8_t x=0; for (size_t i=0;i<sizeof(Cfg)-1;i++) x ^= p[i];
+  uint8_t x=0; for (size_t i=0;i<offsetof(Cfg, crc);i++) x ^= p[i];
   return x;
 }
 
 static void cfg_set_defaults(){
   g_cfg.magic   = 0x4A43; // 'J','C'
-  g_cfg.version = 1;
+  g_cfg.version = CFG_VERSION;
   g_cfg.flags   = CFGF_AUTO_USB_C | CFGF_SHOW_CONTI;  // beide an
+  g_cfg.rate[0] = g_cfg.rate[1]   = RATE_DEFAULT_PER_S;
+  g_cfg.burst[0] = g_cfg.burst[1] = RATE_DEFAULT_BURST;
+  g_cfg.out_mask[0] = g_cfg.out_mask[1] = CAT_ALL;
+  g_cfg.json    = 0;
+  g_cfg.bin     = 0;
+  g_cfg.delta_on = 0;
+  g_cfg.delta_dc = 20;   // 2,0 °C
+  g_cfg.delta_pm = 20;   // 2,0 %
+  g_cfg.delta_hb = 60;
   g_cfg.crc     = cfg_crc(g_cfg);
 }
 
@@ -339,13 +995,33 @@ static void cfg_save(){
 
 static void cfg_load(){
   EEPROM.get(0, g_cfg);
-  if (g_cfg.magic != 0x4A43 || g_cfg.version != 1 || cfg_crc(g_cfg) != g_cfg.crc){
+  // Ältere Version: Felder werden nur angehängt -> gültigen alten Teil übernehmen, Rest Defaults
+  static const uint8_t CFG_LEN_V[CFG_VERSION] = { 0, 4, 8, 10, 11, 12 };   // Bytes vor crc in v1..v5
+  if (g_cfg.magic == 0x4A43 && g_cfg.version >= 1 && g_cfg.version < CFG_VERSION){
+    uint8_t n = CFG_LEN_V[g_cfg.version], x = 0;
+    for (uint8_t i=0; i<n; i++) x ^= EEPROM.read(i);
+    if (x == EEPROM.read(n)){
+      cfg_set_defaults();
+      for (uint8_t i=3; i<n; i++) ((uint8_t*)&g_cfg)[i] = EEPROM.read(i);   // ab flags
+      cfg_save();
+    }
+  }
+  if (g_cfg.magic != 0x4A43 || g_cfg.version != CFG_VERSION || cfg_crc(g_cfg) != g_cfg.crc){
     cfg_set_defaults();
     cfg_save();
   }
   auto_usb_c               = (g_cfg.flags & CFGF_AUTO_USB_C)  != 0;
   show_contisend           = (g_cfg.flags & CFGF_SHOW_CONTI)  != 0;
   g_usb_jbc_send_enabled   = (g_cfg.flags & CFGF_USBCLI_EN)   != 0;  // NEU
+  g_s1_rpc                 = (g_cfg.flags & CFGF_S1_RPC)      != 0;
+  con_set_rpc(g_s1_rpc ? CON_S1 : 0);
+  for (uint8_t i=0; i<2; i++){
+    con_set_policy(i, (g_cfg.flags >> (CFGF_TXP_SHIFT + 2*i)) & 0x03);
+    con_set_mask(i, g_cfg.out_mask[i]);
+  }
+  con_set_formats(g_cfg.json & ~g_cfg.bin, g_cfg.bin);
+  jbc_decode::ContiDelta& cd = jbc_decode::g_conti_delta;
+  cd.on = g_cfg.delta_on; cd.db_dc = g_cfg.delta_dc; cd.db_pm = g_cfg.delta_pm; cd.hb_s = g_cfg.delta_hb;
 }
 
 static void cfg_set_auto_usb_c(bool on){
@@ -365,6 +1041,85 @@ static void cfg_set_usbcli(bool on){
   g_usb_jbc_send_enabled = on;
   cfg_save();
 }
+static void cfg_set_s1_rpc(bool on){
+  if (on) g_cfg.flags |=  CFGF_S1_RPC;
+  else    g_cfg.flags &= ~CFGF_S1_RPC;
+  g_s1_rpc = on;
+  con_set_rpc(on ? CON_S1 : 0);
+  cfg_save();
+}
+static void cfg_set_txpolicy(uint8_t i, uint8_t p){
+  uint8_t sh = CFGF_TXP_SHIFT + 2*i;
+  g_cfg.flags = (uint8_t)((g_cfg.flags & ~(0x03 << sh)) | (p << sh));
+  con_set_policy(i, p);
+  cfg_save();
+}
+static void cfg_set_out_mask(uint8_t i, uint8_t m){
+  g_cfg.out_mask[i] = m;
+  con_set_mask(i, m);
+  cfg_save();
+}
+static void cfg_set_fmt(uint8_t con, uint8_t f){
+  g_cfg.json &= (uint8_t)~con; g_cfg.bin &= (uint8_t)~con;
+  if (f == FMT_JSON) g_cfg.json |= con;
+  if (f == FMT_BIN)  g_cfg.bin  |= con;
+  con_set_formats(g_cfg.json, g_cfg.bin);
+  cfg_save();
+}
+static void cfg_set_conti_delta(bool on, uint8_t db_dc, uint8_t db_pm, uint8_t hb_s){
+  jbc_decode::ContiDelta& cd = jbc_decode::g_conti_delta;
+  if (on && !cd.on) cd.valid = 0;   // erster Burst zeigt alle Ports
+  g_cfg.delta_on = cd.on    = on;
+  g_cfg.delta_dc = cd.db_dc = db_dc;
+  g_cfg.delta_pm = cd.db_pm = db_pm;
+  g_cfg.delta_hb = cd.hb_s  = hb_s;
+  cfg_save();
+}
+static void cfg_set_rate(uint8_t src, uint8_t per_s, uint8_t burst){
+  g_cfg.rate[src]  = per_s;
+  g_cfg.burst[src] = burst ? burst : 1;
+  cfg_save();
+}
+
+// ---- Token-Bucket je CLI-Quelle (vor der Warteschlange) ----
+struct RateBucket {
+  uint32_t milli;       // Tokens × 1000
+  uint32_t t_last;
+  uint32_t passed, throttled;
+  bool     quiet;       // Drossel-Meldung schon ausgegeben (bis wieder eins durchgeht)
+};
+static RateBucket g_rate[2];   // [0]=USB [1]=S1
+
+// Token nehmen; false = gedrosselt. wait: der Aufrufer (SWEEP, Skript) versucht es später
+// erneut, das zählt nicht als gedrosselt.
+static bool rate_take(uint8_t src, bool wait = false){
+  RateBucket& b = g_rate[src];
+  uint32_t now = millis(), cap = (uint32_t)g_cfg.burst[src] * 1000;
+  if (!g_cfg.rate[src]) { b.passed++; return true; }
+  if (!b.t_last) b.milli = cap;                       // erster Aufruf: voller Eimer
+  uint32_t dt = now - b.t_last;
+  if (dt > 60000) dt = 60000;                         // gegen Überlauf, Eimer ist dann ohnehin voll
+  b.milli += dt * g_cfg.rate[src];
+  if (b.milli > cap) b.milli = cap;
+  b.t_last = now ? now : 1;
+  if (b.milli < 1000) { if (!wait) b.throttled++; return false; }
+  b.milli -= 1000;
+  b.passed++;
+  if (!wait) b.quiet = false;
+  return true;
+}
+
+// Token zurück, wenn nach rate_take() doch nichts eingereiht wurde
+static void rate_give(uint8_t src){
+  RateBucket& b = g_rate[src];
+  if (b.passed) b.passed--;
+  if (!g_cfg.rate[src]) return;
+  uint32_t cap = (uint32_t)g_cfg.burst[src] * 1000;
+  b.milli = (b.milli + 1000 > cap) ? cap : b.milli + 1000;
+}
+
+// Konsole -> Bucket; Autorun (CON_ALL) hat keinen
+static inline int8_t rate_src(uint8_t con){ return con == CON_USB ? 0 : con == CON_S1 ? 1 : -1; }
 
 
 static bool     s_relay   = false;
@@ -393,6 +1148,12 @@ static const __FlashStringHelper* mcu_name(){
 
 // Globale Portanzahl der Station (Default 1)
 uint8_t jbc_decode::g_station_ports = 1;
+// Identität aus M_FIRMWARE (einmal geparst, Cache je Link)
+jbc_name::StationIdentity jbc_name::g_station;
+// Gelernte Payload-Layouts (Conti-Stride, DATETIME) je Link
+jbc_decode::LayoutProfile jbc_decode::g_layout;
+// Conti nur bei Änderung: Einstellungen (aus EEPROM) + zuletzt gezeigte Werte je Port
+jbc_decode::ContiDelta jbc_decode::g_conti_delta;
 
 
 // --- P01 Retry-Cycle ---
@@ -457,12 +1218,51 @@ enum Proto { PROTO_AUTO, PROTO_P02, PROTO_P01 };
 static Proto g_proto = PROTO_AUTO;
 static uint32_t t_proto_probe_due = 0;  // Fallback-Timer für P01
 
+// ---- Skript-Runner: ein Skript zur Zeit, Schritt -> Antwort (oder Timeout) -> Pause -> nächster ----
+enum : uint8_t { SR_IDLE, SR_WAIT, SR_OK, SR_NACK };
+struct ScriptRun {
+  uint16_t addr;       // Header des laufenden Skripts, 0 = keins
+  uint16_t pos, lim;   // nächster Schritt / Ende der Schritte
+  uint16_t gap_ms;
+  uint32_t t_start;
+  uint32_t t_due;      // SR_WAIT: Timeout, sonst nächster Schritt
+  uint8_t  step, steps;
+  uint8_t  ok, nack, lost;
+  uint8_t  fid, ctrl;  // erwartete Antwort
+  uint8_t  state;
+  uint8_t  con;        // Ausgabe an (CON_ALL bei Autorun)
+  uint16_t tag;
+  bool     autorun;
+  const __FlashStringHelper* stop;   // != nullptr: beim nächsten Tick mit diesem Grund beenden
+  char     name[jbc_script::NAME_LEN + 1];
+};
+static ScriptRun g_script_run;
+static uint32_t  g_script_auto_due = 0;   // Autorun-Zeitpunkt nach FW, 0 = keiner
+
+// RX-Hook: Antwort auf den laufenden Schritt? (P02 über FID, P01 über Ctrl bzw. NACK)
+static void script_on_frame(uint8_t fid, uint8_t ctrl, const uint8_t* d, uint8_t len, bool p01){
+  ScriptRun& r = g_script_run;
+  if (!r.addr || r.state != SR_WAIT) return;
+  bool nack_ctrl = jbc_decode::is_nack_ctrl(g_backend, ctrl);
+  if (p01 ? (ctrl != r.ctrl && !nack_ctrl) : (fid != r.fid)) return;
+  bool nack = nack_ctrl ||
+              (jbc_meta::ctrl_is(g_backend, ctrl, jbc_meta::CM_EXPECT_ACK) && len && d[0] == 0x15);
+  r.state = nack ? SR_NACK : SR_OK;
+}
+
+static bool sweep_on_frame(uint8_t fid, uint8_t ctrl, const uint8_t* d, uint8_t len, bool p01);   // SWEEP, siehe unten
+static void sweep_dispatch(uint16_t ref, const uint8_t* e);
+static void sweep_drop(uint16_t ref);
+
 // --- Hotplug & Silence helpers ---
 static void reset_link_state(){
   stAddr = 0x00;
   link_up = false;
   hs_seen = false;
   g_backend = BK_UNKNOWN;
+  jbc_name::g_station = jbc_name::StationIdentity();
+  jbc_decode::g_layout = jbc_decode::LayoutProfile();
+  jbc_decode::g_conti_delta.valid = 0;
   t_last_syn = 0;
   last_hs_ts = 0;
   fw_ok = false; t_fw_next = 0; fw_retry_gap = FW_RETRY_MS_MIN;
@@ -477,6 +1277,9 @@ static void reset_link_state(){
   usb_status_read_sent = false;
   fw_bootstrap_done = false;   // Bootstrap beim neuen Link wieder erlauben
   reset_fid_seq();
+  cli_pending_expire(true);   // FIDs beginnen neu, offene Anfragen abschließen
+  if (g_script_run.addr) g_script_run.stop = F("abgebrochen (Link-Reset)");
+  g_script_auto_due = 0;
   conti_auto_done = false;
   s_relay = false; s_last_on = 0; relay_write(false);
   strip.setPixelColor(1, strip.Color(0,0,0,0)); strip.show();
@@ -512,11 +1315,54 @@ void jbc_decode::jbc_conti_signal(bool instant_any_on){
   }
 }
 
+// Wird von decode_conti_burst() vor Port-, Summen- bzw. Changes-Zeilen aufgerufen
+bool jbc_decode::jbc_conti_lines(uint8_t which){
+  if (!(which & CONTI_PORTS) && con_shed_max() < SHED_CONTI) return false;   // Summe nur bei Drosselung
+  con_cat((uint8_t)(((which & CONTI_PORTS) ? CAT_CONTI : 0) | ((which & CONTI_SUM) ? CAT_CONTI_SUM : 0)));
+  return con_fmt_targets(jbc_decode::g_fmt) != 0;
+}
+
 
+// ---- PERF: Rechenzeit der Frame-Ausgabe (Dekodieren + Formatieren + Puffern) ----
+struct Perf {
+  uint32_t frames, lines;
+  uint32_t us, max_us;
+};
+static Perf g_perf;
+
+// Pretty-Print eines Frames (Kategorie = Sink-Klasse): derselbe Decoder läuft je Darstellung
+// (Text/JSON/binär) einmal, aber nur, wenn eine Konsole sie bekommt. Seiteneffekte (Relais,
+// Portzahl) nur im ersten Durchlauf; ohne Abnehmer genau ein stummer Durchlauf (binär, der
+// Datensatz geht an niemanden und zählt nicht als gesendet).
 static inline bool dec_print_with_fid(uint8_t fid, Backend be, uint8_t ctrl, const uint8_t* d, uint8_t len){
+  const uint32_t t0 = micros(), l0 = con_lines();
   jbc_decode::set_current_fid(fid);
-  bool handled = jbc_decode::print(be, ctrl, d, len);
+  jbc_decode::set_current_ctrl(be, ctrl);
+  jbc_decode::g_log_cur_tag = con_cur_tag();   // Antwort auf eine getaggte Zeile
+  uint8_t c = jbc_decode::frame_sink_class(be, fid, ctrl);
+  if (c == CAT_CONTI){
+    c |= CAT_CONTI_SUM;   // Port-Zeilen oder (gedrosselt) Summe; wählt der Decoder
+    jbc_decode::conti_delta_frame(be, d, len, millis());   // CONTIDELTA: einmal je Burst, nicht je Darstellung
+  }
+  uint8_t cat = con_cat(c);
+  bool handled = false;
+  for (uint8_t f = FMT_TEXT; f <= FMT_BIN; f++){
+    if (!con_fmt_targets(f) && (!jbc_decode::g_fx || f != FMT_BIN)) continue;
+    con_pass(f); jbc_decode::g_fmt = f;
+    handled = jbc_decode::print(be, ctrl, d, len);
+    jbc_decode::g_fx = false;
+  }
+  con_pass(FMT_TEXT); jbc_decode::g_fmt = FMT_TEXT; jbc_decode::g_fx = true;
+  if (c & CAT_CONTI) jbc_decode::conti_delta_commit(be, d, len, millis());
+  con_cat(cat);
+  jbc_decode::set_current_ctrl(BK_UNKNOWN, -1);
   jbc_decode::set_current_fid(-1);
+  jbc_decode::g_log_cur_tag = CLI_NO_TAG;
+  const uint32_t dt = micros() - t0;
+  g_perf.frames++;
+  g_perf.lines += con_lines() - l0;
+  g_perf.us += dt;
+  if (dt > g_perf.max_us) g_perf.max_us = dt;
   return handled;
 }
 
@@ -674,23 +1520,16 @@ static void led_status_tick(){
 
 // ---------------------------------------------------------
 
-static inline bool is_usb_connectstatus_read(uint8_t ctrl){
-  using namespace jbc_cmd;
-  return ctrl == SOLD_02::M_R_USB_CONNECTSTATUS
-      || ctrl == HA_02::M_R_USB_CONNECTSTATUS
-      || ctrl == PH_02::M_R_USB_CONNECTSTATUS
-      || ctrl == FE_02::M_R_USB_CONNECTSTATUS
-      || ctrl == SF_02::M_R_USB_CONNECTSTATUS;
+// USB-Status Ctrls je Backend (SOLD_01 hat keine -> nie true)
+static inline bool is_usb_connectstatus_read(Backend be, uint8_t ctrl){
+  return (jbc_meta::ctrl_meta(be, ctrl) & (jbc_meta::CM_USB_STATUS | jbc_meta::CM_READ))
+      == (jbc_meta::CM_USB_STATUS | jbc_meta::CM_READ);
 }
 
 // (a) Unified Write-ACK (optional, nur fürs hübsche Log)
-static inline bool is_usb_connectstatus_write(uint8_t ctrl){
-  using namespace jbc_cmd;
-  return ctrl == SOLD_02::M_W_USB_CONNECTSTATUS
-      || ctrl == HA_02::M_W_USB_CONNECTSTATUS
-      || ctrl == PH_02::M_W_USB_CONNECTSTATUS
-      || ctrl == FE_02::M_W_USB_CONNECTSTATUS
-      || ctrl == SF_02::M_W_USB_CONNECTSTATUS;
+static inline bool is_usb_connectstatus_write(Backend be, uint8_t ctrl){
+  return (jbc_meta::ctrl_meta(be, ctrl) & (jbc_meta::CM_USB_STATUS | jbc_meta::CM_WRITE))
+      == (jbc_meta::CM_USB_STATUS | jbc_meta::CM_WRITE);
 }
 
 // Debug toggles
@@ -699,23 +1538,37 @@ static bool DBG_HEX=false;
 bool jbc_decode::g_log_show_syn = false;   // default: M_SYN stumm
 
 static bool g_log_show_txrx = false;   // [TX]/[RX]-Zeilen anzeigen?
-static String g_tx_ctx_pending;       // nächste CLI-Zeile, die gesendet wird
 
+// Sink-Interesse aus den Toggles neu berechnen (nach jeder Änderung von SYN/CONTISEND aufrufen)
+static void sink_interest_update(){
+  uint8_t m = jbc_decode::SINK_DECODE;   // Antworten/Events sieht immer jemand (ESPHome, CLI-Antworten)
+  if (jbc_decode::g_log_show_syn)    m |= jbc_decode::SINK_SYN;
+  if (jbc_decode::g_show_conti_send) m |= jbc_decode::SINK_CONTI;
+  // SYN/CONTI nur dekodieren, wenn eine Konsole die Kategorie sehen will
+  m &= (uint8_t)(jbc_decode::SINK_DECODE | g_cfg.out_mask[0] | g_cfg.out_mask[1]);
+  jbc_decode::g_sink_interest = m;
+}
+// ---- CLI-Zeilen: feste Puffer je Port, kein Heap ----
+#define CLI_LINE_MAX 128
+struct CliLine {
+  char    buf[CLI_LINE_MAX + 1];
+  uint8_t len;
+  bool    overflow;   // Zeile zu lang → Rest bis CR/LF verwerfen
+};
+
+static const char* g_tx_ctx_pending = nullptr;   // Echo der CLI-Zeile, die gerade gesendet wird (Eintrag der Warteschlange)
 
 
 
 
-static inline void print_cli_cmd_with_fid(uint8_t fid, const String& s, Backend be){
-  String s_norm = s; 
-  s_norm.trim();
-  while (s_norm.indexOf("  ") != -1) s_norm.replace("  ", " ");
 
+static inline void print_cli_cmd_with_fid(uint8_t fid, const char* s, Backend be){
   Serial.print(cli_src_prefix()); Serial.print(' ');
   Serial.print('[');
   Serial.print(jbc_decode::fam_tag(be));
   Serial.print(F("_CLI_SEND]"));
   Serial.print(F(" <fid=")); Serial.print(fid); Serial.print(F(">  cmd=\""));
-  Serial.print(s_norm);
+  Serial.print(s);
   Serial.println('"');
 }
 
@@ -724,9 +1577,11 @@ static inline void print_cli_cmd_with_fid(uint8_t fid, const String& s, Backend
 
 static void dump_hex(const char* tag,const uint8_t* b,size_t n){
   if(!DBG_HEX) return;
-  Serial.print(tag); Serial.print(" ["); Serial.print(n); Serial.println("]");
-  for(size_t i=0;i<n;i++){ if(b[i]<16) Serial.print('0'); Serial.print(b[i],HEX); Serial.print(' '); }
+  uint8_t cat = con_cat(CAT_HEX);
+  Serial.print(tag); Serial.print(" ["); jbc_fmt::print_u(Serial, n); Serial.println("]");
+  jbc_fmt::print_bytes(Serial, b, n); if (n) Serial.print(' ');
   Serial.println();
+  con_cat(cat);
 }
 
 
@@ -786,13 +1641,15 @@ static void send_ctrl(uint8_t dst,uint8_t ctrl,const uint8_t* data=nullptr,uint8
   uint8_t inner[300]; size_t n=0;
   uint8_t usefid = (fid==0xFF)? next_fid() : fid;
   build_p02(pcAddr, dst, usefid, ctrl, data?data:nullptr, len, inner, n);
-  if (jbc_decode::g_log_show_syn || !jbc_decode::is_syn_ctrl(ctrl)) {
+  if (jbc_decode::g_log_show_syn || !jbc_decode::is_syn_ctrl(g_backend, ctrl)) {
     if (g_log_show_txrx) {
+      uint8_t cat = con_cat(CAT_TXRX);
       JBC_PRINT_TX(g_backend, ctrl, usefid, dst);
+      con_cat(cat);
     }
-    if (g_tx_ctx_pending.length()) {
+    if (g_tx_ctx_pending) {
       print_cli_cmd_with_fid(usefid, g_tx_ctx_pending, g_backend);
-      g_tx_ctx_pending = "";
+      g_tx_ctx_pending = nullptr;
     }
   }
   send_frame_p02(inner,n,"TX P02");
@@ -826,8 +1683,10 @@ static void build_p01(uint8_t src,uint8_t dst,uint8_t ctrl,
 static void send_ctrl_p01(uint8_t dst,uint8_t ctrl,const uint8_t* data=nullptr,uint8_t len=0){
   uint8_t inner[300]; size_t n=0;
   build_p01(pcAddr, dst, ctrl, data?data:nullptr, len, inner, n);
-  if (g_log_show_txrx && (jbc_decode::g_log_show_syn || !jbc_decode::is_syn_ctrl(ctrl))) {
+  if (g_log_show_txrx && (jbc_decode::g_log_show_syn || !jbc_decode::is_syn_ctrl(g_backend, ctrl))) {
+    uint8_t cat = con_cat(CAT_TXRX);
     JBC_PRINT_TX(g_backend, ctrl, /*fid*/0, dst); // FID=0 als Platzhalter
+    con_cat(cat);
   }
   send_frame_p02(inner,n,"TX P01");
 }
@@ -981,7 +1840,7 @@ static void auto_enable_contimode(){
 }
 
 // Decoder
-static void on_inner_frame(const uint8_t* f,size_t n){
+static void handle_inner_frame(const uint8_t* f,size_t n){
   if ( (n < (g_proto == PROTO_P01 ? 7 : 8)) || xor_bcc(f, n) != 0 ) return;
   t_last_rx_valid = millis();
 
@@ -1028,6 +1887,10 @@ static void on_inner_frame(const uint8_t* f,size_t n){
     d    = &f[5];
   }
 
+  // Antwort auf ein CLI-Kommando nur an die fragende Konsole (on_inner_frame stellt zurück)
+  cli_reply_route(fid, ctrl, g_proto == PROTO_P01, d, len);
+  script_on_frame(fid, ctrl, d, len, g_proto == PROTO_P01);
+
   // Bei P01: sobald ein gültiges Frame ankommt, Link als UP markieren
   if (g_proto == PROTO_P01 && !link_up){
     link_up = true;
@@ -1035,10 +1898,15 @@ static void on_inner_frame(const uint8_t* f,size_t n){
   }
 
 
-  if ((jbc_decode::g_log_show_syn || !jbc_decode::is_syn_ctrl(ctrl)) && g_log_show_txrx) {
+  if (g_log_show_txrx && (jbc_decode::g_log_show_syn || !jbc_decode::is_syn_ctrl(g_backend, ctrl))) {
+    uint8_t cat = con_cat(CAT_TXRX);
     JBC_PRINT_RX(g_backend, src, ctrl, fid, len);
+    con_cat(cat);
   }
 
+  // SWEEP-Antwort: gesammelt, Ausgabe je Port in sweep_tick()
+  if (sweep_on_frame(fid, ctrl, d, len, g_proto == PROTO_P01)) return;
+
   // Adresse lernen aus sinnvollen Frames
   if(src && src!=stAddr){
     switch(ctrl){
@@ -1077,23 +1945,18 @@ static void on_inner_frame(const uint8_t* f,size_t n){
     return;
   }
 
-  // Parse FW string (ohne eigene Prints; Ausgabe über Decoder)
+  // Parse FW string (einmal, ohne Heap; Ausgabe über Decoder)
   if (ctrl==BASE::M_FIRMWARE && len>0){
-    String s; s.reserve(len);
-    for(uint8_t i=0;i<len;i++) s += (char)d[i];
-
-    // Model extrahieren
-    int a = s.indexOf(':'), b = s.indexOf(':', a+1);
-    String model = (a>0 && b>a) ? s.substring(a+1, b) : String();
+    const jbc_name::StationIdentity& id = jbc_name::station_identity(d, len);
 
     // Spezialfall: PDE -> nicht akzeptieren, weiter FW anfragen
-    if (model.startsWith("PDE")){
+    if (id.is_pde()){
       fw_ok = false;
       return;
     }
 
     // Backend setzen und FW akzeptieren
-    g_backend = jbc_name::backend_from_fwline(s);
+    g_backend = id.backend;
     fw_ok = true;
 
     // Hübsch ausgeben
@@ -1152,6 +2015,7 @@ static void on_inner_frame(const uint8_t* f,size_t n){
         }
       }
       auto_enable_contimode();
+      g_script_auto_due = millis() + SCRIPT_AUTORUN_DELAY_MS;   // Autorun-Skripte nach dem Bootstrap
       fw_bootstrap_done = true;
     }
     return;
@@ -1166,20 +2030,34 @@ static void on_inner_frame(const uint8_t* f,size_t n){
   }
 
   // --- USB-Status Hooks (READ, nur Familien mit USB-Status) ---
-  if (is_usb_connectstatus_read(ctrl)) {
+  if (is_usb_connectstatus_read(g_backend, ctrl)) {
     usb_status_known = true;
     usb_status_is_C  = (len>=2 && d[0]==':' && (d[1]=='C' || d[1]=='c'));
   }
 
   // --- USB-Status Write-ACK (familienübergreifend, ohne SOLD_01) ---
-  if (is_usb_connectstatus_write(ctrl) && len>=1 && d[0]==0x06) {
+  if (is_usb_connectstatus_write(g_backend, ctrl) && len>=1 && d[0]==0x06) {
     Serial.println(F("[AUTO] USB_CONNECTSTATUS write ACK"));
   }
 
+  // Lazy-Decoding: Frame ohne Abnehmer -> nur Minimal-Parsing (Adresse/Liveness sind oben erledigt)
+  const uint8_t sink = jbc_decode::frame_sink_class(g_backend, fid, ctrl);
+  if (!(jbc_decode::g_sink_interest & sink)) {
+    if (sink != jbc_decode::SINK_CONTI) return;
+    uint8_t agg = 0;
+    // Relais-Eingang immer; nur bei Changes (selten) voll dekodieren -> CONTIMODE_CHANGES bleibt sichtbar
+    if (jbc_decode::conti_relay_input(g_backend, d, len, agg) && !agg) return;
+  }
+
   // -> generischer Pretty-Print
   if (dec_print_with_fid(fid, g_backend, ctrl, d, len)) return;
 }
 
+static void on_inner_frame(const uint8_t* f,size_t n){
+  handle_inner_frame(f, n);
+  con_reset();
+}
+
 
 
 
@@ -1263,7 +2141,9 @@ static void proto_probe_tick(){
 
 // --- CLI-Callback, den die Map nutzt ---
 static void jbc_send_from_cli(uint8_t ctrl, const uint8_t* payload, uint8_t len){
-  send_ctrl_by_proto(dst_current(), ctrl, payload, len);
+  uint8_t fid = (g_proto == PROTO_P01) ? 0 : next_fid();
+  cli_pending_add(fid, ctrl, cli_src_con(), g_cli_tag);   // Antwort später nur an diese Konsole
+  send_ctrl_by_proto(dst_current(), ctrl, payload, len, fid);
 }
 
 
@@ -1277,9 +2157,24 @@ static void print_cli_help(){
   Serial.println(F("  FID ON | FID OFF   (FID in Pretty-Prints an/aus)"));
   Serial.println(F("  TXRX ON | TXRX OFF (Alias für LOG ON/OFF)"));
   Serial.println(F("  CONTISEND ON | CONTISEND OFF   (nur [_CONTIMODE_SENDING] zeigen/verbergen)"));
+  Serial.println(F("  CONTIDELTA | CONTIDELTA ON|OFF | CONTIDELTA <°C> <%> [hb_s] (Conti-Ports nur bei Änderung)"));
   Serial.println(F("  USBCLI ON | USBCLI OFF  (JBC-Senden über USB erlauben/verbieten)"));
   Serial.println(F("  USBAUTO ON | USBAUTO OFF   (automatisches Setzen von USB_CONNECTSTATUS=':C')"));
   Serial.println(F("  Prefixe in Ausgaben: [USB] / [S1]"));
+  Serial.println(F("  #<tag> <Befehl>    (Antwortzeilen beginnen mit \"#<tag> \")"));
+  Serial.println(F("  SCRIPT LIST | SHOW <n> | DEL <n> | RUN <n> | STOP"));
+  Serial.println(F("  SCRIPT REC <n> [ms] ... SCRIPT END | ABORT   (M_-Zeilen aufnehmen statt senden)"));
+  Serial.println(F("  SCRIPT AUTO <n> ON|OFF | GAP <n> <ms>   (Autorun nach Link-Up + FW)"));
+  Serial.println(F("  SWEEP [p0[-p1]] M_CMD [args] [; M_CMD ...]   (Lesebefehle je Port, eine Zeile pro Port)"));
+  Serial.println(F("  RATE | RATE USB|S1 <pro_s> [burst] | RATE RESET   (Drossel je Konsole, 0 = aus)"));
+  Serial.println(F("  TXBUF | TXBUF USB|S1 BLOCK|OLD|NEW | TXBUF RESET   (Sende-Puffer voll: warten/älteste/neue Zeile verwerfen)"));
+  Serial.println(F("  SHED | SHED ON|OFF (Ausgabe bei Rückstau automatisch drosseln: HEX/TXRX, dann Conti-Summe)"));
+  Serial.println(F("  OUT | OUT USB|S1 0..3 | OUT USB|S1 +KAT -KAT   (Ausgabe je Konsole: REPLY SYN CONTI TXRX HEX STATUS ALL)"));
+  Serial.println(F("  OUT USB|S1 JSON | OUT USB|S1 TEXT           (dekodierte Frames als JSON Lines / Text)"));
+  Serial.println(F("  OUT USB|S1 BIN | OUT SCHEMA                (Frames als Binär-Datensätze / Schema der IDs)"));
+  Serial.println(F("  RPC | RPC ON | RPC OFF   (Serial1: binäres RPC mit COBS + CRC16 statt Text-CLI)"));
+  Serial.println(F("  PERF | PERF RESET   (Rechenzeit je dekodiertem Frame / je Ausgabezeile)"));
+  Serial.println(F("  PERF FMT            (Zahlenformatierung: Print::print vs. jbc_fmt)"));
   Serial.println(F("JBC Kommandos:"));
   Serial.println(F("  z.B.  M_INF_PORT 0"));
   Serial.println(F("        M_R_DEVICEIDORIGINAL"));
@@ -1288,26 +2183,1276 @@ static void print_cli_help(){
 
 
 
-static void cli_process(const String &line_in){
-  // Normalisieren
-  String u = line_in, clean; clean.reserve(u.length());
-  for (size_t i=0;i<u.length();++i){
-    uint8_t uc = (uint8_t)u[i];
+// Zeile in place normalisieren: Steuerzeichen raus, Tab → Space, Mehrfach-Spaces zusammenfassen, trimmen
+static char* cli_normalize(char* s){
+  char* w = s;
+  for (char* r = s; *r; ++r){
+    uint8_t uc = (uint8_t)*r;
     if (uc == '\t') uc = ' ';
-    if (uc >= 32 && uc != 127) clean += (char)uc;  // ≥128 zulassen
+    if (uc < 32 || uc == 127) continue;          // ≥128 zulassen
+    if (uc == ' ' && (w == s || w[-1] == ' ')) continue;
+    *w++ = (char)uc;
+  }
+  if (w > s && w[-1] == ' ') --w;
+  *w = '\0';
+  return s;
+}
+
+static inline bool cli_is(const char* s, PGM_P kw){ return !strcasecmp_P(s, kw); }
+
+static void print_cli_unknown(const char* line){
+  Serial.print(cli_src_prefix()); Serial.print(F(" [CLI] Unbekannter Befehl: \""));
+  Serial.print(line);
+  Serial.println(F("\"  — 'HELP' eingeben."));
+}
+
+// ---- JBC-Kommandos: begrenzte Warteschlange je Konsole, Round-Robin zum Senden ----
+// Eintrag: [ctrl][len][payload][Echo-Text '\0'] – kodiert wird schon beim Einreihen. Vor Link-Up
+// + FW ist das Backend noch offen, dann steht dort die Zeile selbst (max. CLI_Q_ENTRY-1 Zeichen).
+#define CLI_Q_DEPTH 4
+#define CLI_Q_ENTRY 64
+#define CLI_HOLD_MS 10000   // max. Wartezeit auf Link-Up + FW-Bootstrap
+static_assert(CLI_Q_ENTRY >= 2 + jbc_rpc::PAYLOAD_MAX + 12, "CLI_Q_ENTRY: Kodierung + kurzes Echo");
+struct CliQueue {
+  uint8_t  e[CLI_Q_DEPTH][CLI_Q_ENTRY];
+  uint16_t tag[CLI_Q_DEPTH];    // RPC-Eintrag: Request-ID; SWEEP: Lauf<<8 | Slot
+  uint32_t t_in[CLI_Q_DEPTH];   // Zeitpunkt des Einreihens
+  uint8_t  head;
+  uint8_t count;
+  uint8_t  rpc;                 // Bit i: e[i] ist eine RPC-Anfrage (ohne Echo)
+  uint8_t  txt;                 // Bit i: e[i] ist noch Text (vor Link-Up gepuffert)
+  uint8_t  swp;                 // Bit i: e[i] ist eine SWEEP-Anfrage (ohne Echo)
+};
+static CliQueue cli_q_usb, cli_q_s1;
+static bool     cli_rr_usb = true;   // USB beim nächsten Dispatch zuerst?
+
+// Senden erst nach Link-Up und abgeschlossenem FW-Bootstrap (Backend/Adresse bekannt)
+static inline bool cli_link_ready(){ return link_up && fw_bootstrap_done; }
+
+// SendFn für jbc_cli::handle: Kodierung als [ctrl][len][payload] nach s_cli_enc abgreifen statt senden
+static uint8_t* s_cli_enc;
+static void cli_capture(uint8_t ctrl, const uint8_t* payload, uint8_t len){
+  s_cli_enc[0] = ctrl; s_cli_enc[1] = len;
+  memcpy(s_cli_enc + 2, payload, len);
+}
+
+// Echo-Text eines Eintrags (Zeile bzw. hinter der Kodierung)
+static inline const char* cli_q_echo(const CliQueue& q, uint8_t i){
+  const uint8_t* e = q.e[i];
+  return (const char*)((q.txt >> i) & 1 ? e : e + 2 + e[1]);
+}
+
+static bool cli_enqueue(const char* line){
+  CliQueue& q = g_cli_from_usb ? cli_q_usb : cli_q_s1;
+  if (q.count >= CLI_Q_DEPTH){
+    Serial.print(cli_src_prefix()); Serial.print(F(" [CLI] Warteschlange voll – verworfen: \""));
+    Serial.print(line); Serial.println('"');
+    return false;
+  }
+  const uint8_t i = (uint8_t)(q.head + q.count) % CLI_Q_DEPTH, bit = (uint8_t)(1u << i);
+  uint8_t* e = q.e[i];
+  if (cli_link_ready()){
+    char buf[CLI_LINE_MAX + 1];   // handle() zerlegt die Zeile
+    strlcpy(buf, line, sizeof buf);
+    s_cli_enc = e;
+    if (!jbc_cli::handle(buf, g_backend, dst_current(), cli_capture)){ print_cli_unknown(line); return false; }
+    char* t = (char*)e + 2 + e[1];
+    const uint8_t room = (uint8_t)(CLI_Q_ENTRY - 2 - e[1]);
+    if (strlcpy(t, line, room) >= room) { t[room - 3] = '.'; t[room - 2] = '.'; }   // Echo gekürzt
+    q.txt &= (uint8_t)~bit;
+  } else {
+    if (strlen(line) >= CLI_Q_ENTRY){
+      Serial.print(cli_src_prefix()); Serial.print(F(" [CLI] vor Link-Up max. "));
+      Serial.print(CLI_Q_ENTRY - 1); Serial.print(F(" Zeichen – verworfen: \""));
+      Serial.print(line); Serial.println('"');
+      return false;
+    }
+    strlcpy((char*)e, line, CLI_Q_ENTRY);
+    q.txt |= bit;
+  }
+  q.tag[i] = g_cli_tag;
+  q.t_in[i] = millis();
+  q.count++;
+  if (!cli_link_ready()){
+    Serial.print(cli_src_prefix()); Serial.print(F(" [CLI] Link nicht bereit – gepuffert ("));
+    Serial.print(q.count); Serial.print('/'); Serial.print(CLI_Q_DEPTH); Serial.println(')');
+  }
+  return true;
+}
+
+// Fertig kodierten Eintrag (RPC, SWEEP) anhängen; liefert das Bit des Platzes, 0 = voll
+static uint8_t cli_enqueue_enc(CliQueue& q, uint16_t tag, uint8_t ctrl, const uint8_t* payload, uint8_t len){
+  if (q.count >= CLI_Q_DEPTH) return 0;
+  const uint8_t i = (uint8_t)(q.head + q.count) % CLI_Q_DEPTH, bit = (uint8_t)(1u << i);
+  uint8_t* e = q.e[i];
+  e[0] = ctrl; e[1] = len;
+  memcpy(e + 2, payload, len);
+  e[2 + len] = '\0';   // kein Echo
+  q.tag[i] = tag;
+  q.t_in[i] = millis();
+  q.rpc &= (uint8_t)~bit; q.txt &= (uint8_t)~bit; q.swp &= (uint8_t)~bit;
+  q.count++;
+  return bit;
+}
+
+// RPC-Anfrage (Serial1) in dieselbe Warteschlange; false = voll
+static bool cli_enqueue_rpc(uint16_t id, uint8_t ctrl, const uint8_t* payload, uint8_t len){
+  const uint8_t bit = cli_enqueue_enc(cli_q_s1, id, ctrl, payload, len);
+  cli_q_s1.rpc |= bit;
+  return bit != 0;
+}
+
+// Zu lange gepufferte Kommandos (Link kam nicht rechtzeitig) verwerfen und melden
+static void cli_queue_expire(bool from_usb, CliQueue& q){
+  while (q.count && millis() - q.t_in[q.head] > CLI_HOLD_MS){
+    const uint8_t bit = (uint8_t)(1u << q.head);
+    if (q.rpc & bit){
+      q.rpc &= (uint8_t)~bit;
+      rpc_respond(q.tag[q.head], jbc_rpc::OP_JBC, jbc_rpc::ST_NOLINK, q.e[q.head], 1);
+      q.head = (uint8_t)(q.head + 1) % CLI_Q_DEPTH;
+      q.count--;
+      continue;
+    }
+    if (q.swp & bit){   // SWEEP zählt ihn als "ohne Antwort"
+      q.swp &= (uint8_t)~bit;
+      sweep_drop(q.tag[q.head]);
+      q.head = (uint8_t)(q.head + 1) % CLI_Q_DEPTH;
+      q.count--;
+      continue;
+    }
+    g_cli_from_usb = from_usb;
+    g_cli_tag = q.tag[q.head];
+    cli_ctx_begin();
+    Serial.print(cli_src_prefix()); Serial.print(F(" [CLI] verworfen (kein Link nach "));
+    Serial.print(CLI_HOLD_MS / 1000); Serial.print(F(" s): \""));
+    Serial.print(cli_q_echo(q, q.head)); Serial.println('"');
+    q.txt &= (uint8_t)~(1u << q.head);
+    con_reset();
+    q.head = (uint8_t)(q.head + 1) % CLI_Q_DEPTH;
+    q.count--;
+  }
+}
+
+static void cli_dispatch_one(bool from_usb, CliQueue& q){
+  const uint8_t* e = q.e[q.head];   // bleibt bis zum nächsten Einreihen gültig
+  const char* echo = cli_q_echo(q, q.head);
+  g_cli_tag  = q.tag[q.head];
+  const uint8_t bit = (uint8_t)(1u << q.head);
+  const bool rpc = q.rpc & bit, txt = q.txt & bit, swp = q.swp & bit;
+  q.rpc &= (uint8_t)~bit; q.txt &= (uint8_t)~bit; q.swp &= (uint8_t)~bit;
+  q.head = (uint8_t)(q.head + 1) % CLI_Q_DEPTH;
+  q.count--;
+
+  g_cli_from_usb = from_usb;
+  if (swp){ sweep_dispatch(g_cli_tag, e); return; }
+  if (rpc){   // RPC: fertig kodiert, [TX]-Zeilen normal an alle
+    uint8_t fid = (g_proto == PROTO_P01) ? 0 : next_fid();
+    cli_pending_add(fid, e[0], CON_S1, g_cli_tag, true);
+    send_ctrl_by_proto(dst_current(), e[0], e + 2, e[1], fid);
+    return;
+  }
+  cli_ctx_begin();
+  g_tx_ctx_pending = echo;   // Echo mit echter FID
+  if (!txt) jbc_send_from_cli(e[0], e + 2, e[1]);
+  else {   // vor Link-Up gepuffert: jetzt mit dem bekannten Backend kodieren
+    char line[CLI_Q_ENTRY];   // handle() zerlegt die Zeile
+    memcpy(line, e, sizeof line);
+    if (!jbc_cli::handle(line, g_backend, dst_current(), jbc_send_from_cli)) print_cli_unknown(echo);
+  }
+  g_tx_ctx_pending = nullptr;
+  con_reset();
+}
+
+// Höchstens ein Kommando je loop(); die andere Konsole ist danach zuerst dran
+static void cli_dispatch_tick(){
+  cli_queue_expire(true,  cli_q_usb);
+  cli_queue_expire(false, cli_q_s1);
+  if (!cli_link_ready()) return;
+  CliQueue& a = cli_rr_usb ? cli_q_usb : cli_q_s1;
+  CliQueue& b = cli_rr_usb ? cli_q_s1  : cli_q_usb;
+  if      (a.count) cli_dispatch_one(cli_rr_usb,  a);
+  else if (b.count) cli_dispatch_one(!cli_rr_usb, b);
+  else return;
+  cli_rr_usb = !g_cli_from_usb;
+}
+
+// ======================================================
+//      Skripte: SCRIPT REC/END aufzeichnen, SCRIPT RUN / Autorun abspielen
+// ======================================================
+struct ScriptRec {
+  bool     active;
+  bool     from_usb;   // nur Zeilen dieser Konsole werden aufgenommen
+  uint16_t addr;       // Header-Platz = Ende der Kette bei REC
+  uint16_t pos;        // nächster freier Schritt-Platz
+  jbc_script::Hdr hdr;
+};
+static ScriptRec g_script_rec;
+
+static void print_script_name(const jbc_script::Hdr& h){
+  for (uint8_t i=0; i<jbc_script::NAME_LEN && h.name[i]; i++) Serial.print(h.name[i]);
+}
+
+// Name prüfen (1..8 Zeichen A-Z 0-9 _) und in Großbuchstaben nach out
+static bool script_name_ok(const char* n, char* out){
+  uint8_t i = 0;
+  for (; n[i]; i++){
+    char c = (char)toupper((unsigned char)n[i]);
+    if (i >= jbc_script::NAME_LEN || !(isalnum((unsigned char)c) || c == '_')) return false;
+    out[i] = c;
   }
-  clean.trim();
-  while (clean.indexOf("  ") != -1) clean.replace("  ", " ");
-  while (clean.startsWith(">") || clean.startsWith("#") || clean.startsWith("$")) { clean.remove(0,1); clean.trim(); }
-  if (!clean.length()) return;
+  memset(out + i, 0, jbc_script::NAME_LEN - i);
+  return i > 0;
+}
 
-  String up = clean; up.toUpperCase();
-  int posM = up.indexOf("M_"); if (posM > 0) { clean = clean.substring(posM); up = up.substring(posM); }
+// SendFn für jbc_cli::handle während der Aufnahme: Schritt ins EEPROM statt auf den Bus
+static void script_rec_step(uint8_t ctrl, const uint8_t* payload, uint8_t len){
+  ScriptRec& r = g_script_rec;
+  Serial.print(cli_src_prefix());
+  if (r.pos + 2 + len >= jbc_script::END || r.hdr.steps == 255){   // 1 Byte für die Endmarke
+    Serial.println(F(" [SCRIPT] EEPROM voll – Schritt verworfen"));
+    return;
+  }
+  EEPROM.update(r.pos++, ctrl);
+  EEPROM.update(r.pos++, len);
+  for (uint8_t i=0; i<len; i++) EEPROM.update(r.pos++, payload[i]);
+  r.hdr.steps++;
+  Serial.print(F(" [SCRIPT] + ")); Serial.print(r.hdr.steps); Serial.print(' ');
+  jbc_name::print_cmd_name((Backend)r.hdr.backend, ctrl);
+  Serial.print(F(" (")); Serial.print(len); Serial.println(F(" Bytes)"));
+}
+
+// Ablauf vorbereiten (Schritte sendet script_tick); Rückgabe: Fehlertext oder nullptr
+static const __FlashStringHelper* script_start(uint16_t a, const jbc_script::Hdr& h, uint8_t con, uint16_t tag, bool autorun){
+  if (h.backend != BK_UNKNOWN && h.backend != g_backend) return F("für anderes Backend aufgezeichnet");
+  if (!jbc_script::valid(a, h)) return F("CRC falsch");
+  ScriptRun& r = g_script_run;
+  memset(&r, 0, sizeof r);
+  r.addr = a; r.pos = jbc_script::body(a); r.lim = jbc_script::next(a, h);
+  r.gap_ms = h.gap_ms; r.steps = h.steps;
+  r.t_start = r.t_due = millis();
+  r.con = con; r.tag = tag; r.autorun = autorun;
+  memcpy(r.name, h.name, jbc_script::NAME_LEN);
+  return nullptr;
+}
+
+// nächstes Autorun-Skript ab Adresse from starten
+static void script_start_auto(uint16_t from){
+  jbc_script::Hdr h;
+  for (uint16_t a = from; jbc_script::read_hdr(a, h); a = jbc_script::next(a, h)){
+    if (!(h.flags & jbc_script::F_AUTORUN)) continue;
+    if (h.backend != BK_UNKNOWN && h.backend != g_backend) continue;
+    const __FlashStringHelper* err = script_start(a, h, CON_ALL, CLI_NO_TAG, true);
+    if (!err){ Serial.print(F("[SCRIPT] Autorun ")); print_script_name(h); Serial.println(); return; }
+    Serial.print(F("[SCRIPT] ")); print_script_name(h); Serial.print(F(": ")); Serial.println(err);
+  }
+}
+
+static void script_report(const __FlashStringHelper* why){
+  ScriptRun& r = g_script_run;
+  con_route(r.con); con_tag(r.tag);
+  Serial.print(F("[SCRIPT] ")); Serial.print(r.name); Serial.print(' '); Serial.print(why);
+  Serial.print(F(": ")); Serial.print(r.step); Serial.print('/'); Serial.print(r.steps);
+  Serial.print(F(" Schritte, ok=")); Serial.print(r.ok);
+  Serial.print(F(" nack=")); Serial.print(r.nack);
+  Serial.print(F(" ohne_antwort=")); Serial.print(r.lost);
+  Serial.print(F(" dauer=")); Serial.print(millis() - r.t_start); Serial.println(F("ms"));
+  con_reset();
+}
+
+static void script_tick(){
+  ScriptRun& r = g_script_run;
+  uint32_t now = millis();
+
+  // Autorun nur, wenn gerade kein Skript (manuell) läuft – sonst entfällt er für diesen Link-Up
+  if (g_script_auto_due && (int32_t)(now - g_script_auto_due) >= 0){
+    g_script_auto_due = 0;
+    if (!r.addr && link_up && fw_ok) script_start_auto(jbc_script::BASE);
+  }
+  if (!r.addr) return;
+  if (r.stop){ script_report(r.stop); r.addr = 0; return; }
+
+  // Ergebnis des letzten Schritts verbuchen, dann Pause
+  if (r.state == SR_WAIT){
+    if ((int32_t)(now - r.t_due) < 0) return;
+    r.lost++;
+  }
+  else if (r.state == SR_OK)   r.ok++;
+  else if (r.state == SR_NACK) r.nack++;
+  if (r.state != SR_IDLE){ r.state = SR_IDLE; r.t_due = now + r.gap_ms; }
+  if ((int32_t)(now - r.t_due) < 0) return;
+
+  if (r.step >= r.steps){
+    uint16_t a = r.addr; bool autorun = r.autorun;
+    script_report(F("fertig"));
+    r.addr = 0;
+    if (autorun){ jbc_script::Hdr h; if (jbc_script::read_hdr(a, h)) script_start_auto(jbc_script::next(a, h)); }
+    return;
+  }
+  if (!link_up){ r.stop = F("abgebrochen (kein Link)"); return; }
+  const int8_t src = rate_src(r.con);
+  if (src >= 0 && !rate_take((uint8_t)src, true)) return;   // Schritt wartet auf ein Token
+
+  uint8_t ctrl, len, buf[jbc_script::STEP_MAX];
+  if (!jbc_script::read_step(r.pos, r.lim, ctrl, buf, len)){ r.stop = F("abgebrochen (EEPROM)"); return; }
+  r.step++;
+
+  uint8_t fid = (g_proto == PROTO_P01) ? 0 : next_fid();
+  con_route(r.con); con_tag(r.tag);
+  Serial.print(F("[SCRIPT] ")); Serial.print(r.name); Serial.print(' ');
+  Serial.print(r.step); Serial.print('/'); Serial.print(r.steps); Serial.print(' ');
+  jbc_name::print_cmd_name(g_backend, ctrl);
+  Serial.print(F(" <fid=")); Serial.print(fid); Serial.println('>');
+  cli_pending_add(fid, ctrl, r.con, r.tag);   // Antwort-Routing wie bei CLI-Kommandos
+  send_ctrl_by_proto(dst_current(), ctrl, buf, len, fid);
+  con_reset();
+
+  r.fid = fid; r.ctrl = ctrl;
+  r.state = SR_WAIT;
+  r.t_due = now + CLI_REPLY_TIMEOUT_MS;
+}
+
+static void script_list(){
+  jbc_script::Hdr h; uint16_t a = jbc_script::BASE;
+  for (; jbc_script::read_hdr(a, h); a = jbc_script::next(a, h)){
+    Serial.print(cli_src_prefix()); Serial.print(F(" [SCRIPT] ")); print_script_name(h);
+    Serial.print(F(" schritte=")); Serial.print(h.steps);
+    Serial.print(F(" bytes=")); Serial.print(h.len);
+    Serial.print(F(" gap=")); Serial.print(h.gap_ms); Serial.print(F("ms backend="));
+    Serial.print(jbc_name::backend_name((Backend)h.backend));
+    Serial.print(F(" auto=")); Serial.print((h.flags & jbc_script::F_AUTORUN) ? F("ON") : F("OFF"));
+    if (!jbc_script::valid(a, h)) Serial.print(F(" CRC-FEHLER"));
+    Serial.println();
+  }
+  Serial.print(cli_src_prefix()); Serial.print(F(" [SCRIPT] frei: "));
+  Serial.print(jbc_script::END - a); Serial.println(F(" Bytes"));
+}
+
+static void script_show(uint16_t a, const jbc_script::Hdr& h){
+  uint16_t p = jbc_script::body(a), lim = jbc_script::next(a, h);
+  uint8_t ctrl, len, buf[jbc_script::STEP_MAX];
+  for (uint8_t i=1; i<=h.steps && jbc_script::read_step(p, lim, ctrl, buf, len); i++){
+    Serial.print(cli_src_prefix()); Serial.print(F(" [SCRIPT] ")); Serial.print(i); Serial.print(' ');
+    jbc_name::print_cmd_name((Backend)h.backend, ctrl);
+    if (len) { Serial.print(' '); jbc_fmt::print_bytes(Serial, buf, len); }
+    Serial.println();
+  }
+}
+
+// Aufnahme: JBC-Zeile der aufnehmenden Konsole kodieren und speichern
+static void script_rec_line(char* line){
+  if (!jbc_cli::handle(line, (Backend)g_script_rec.hdr.backend, dst_current(), script_rec_step)){
+    Serial.print(cli_src_prefix()); Serial.println(F(" [SCRIPT] Zeile nicht aufgenommen"));
+  }
+}
+
+// "SCRIPT <sub> [name] [arg]"
+static void script_cli(char* args){
+  char* tok[4];
+  uint8_t n = jbc_cli::split_tokens(args, tok, 4);
+  const char* sub = n ? tok[0] : "";
+  char name[jbc_script::NAME_LEN];
+  jbc_script::Hdr h;
+  uint16_t a = 0;
+  ScriptRec& rec = g_script_rec;
+
+  Serial.print(cli_src_prefix()); Serial.print(F(" [SCRIPT] "));
+
+  if (!n || cli_is(sub, PSTR("LIST"))){ Serial.println(F("Liste")); script_list(); return; }
+
+  if (cli_is(sub, PSTR("END")) || cli_is(sub, PSTR("ABORT"))){
+    if (!rec.active || rec.from_usb != g_cli_from_usb){ Serial.println(F("keine Aufnahme aktiv")); return; }
+    rec.active = false;
+    if (cli_is(sub, PSTR("ABORT")) || !rec.hdr.steps){ Serial.println(F("Aufnahme verworfen")); return; }
+    rec.hdr.len = (uint16_t)(rec.pos - jbc_script::body(rec.addr));
+    EEPROM.update(rec.pos, 0xFF);          // neues Ende der Kette
+    jbc_script::write_hdr(rec.addr, rec.hdr);
+    print_script_name(rec.hdr); Serial.print(F(" gespeichert: ")); Serial.print(rec.hdr.steps);
+    Serial.print(F(" Schritte, ")); Serial.print(rec.hdr.len); Serial.println(F(" Bytes"));
+    return;
+  }
+  if (cli_is(sub, PSTR("STOP"))){
+    if (!g_script_run.addr){ Serial.println(F("kein Skript aktiv")); return; }
+    g_script_run.stop = F("gestoppt");
+    Serial.println(F("Stopp angefordert"));
+    return;
+  }
+
+  // ab hier: <sub> <name> ...
+  if (!cli_is(sub, PSTR("REC")) && !cli_is(sub, PSTR("RUN")) && !cli_is(sub, PSTR("SHOW")) &&
+      !cli_is(sub, PSTR("DEL")) && !cli_is(sub, PSTR("AUTO")) && !cli_is(sub, PSTR("GAP"))) n = 0;
+  if (!n){
+    Serial.println(F("Syntax: SCRIPT LIST|REC <name> [ms]|END|ABORT|RUN <name>|STOP|SHOW|DEL <name>|AUTO <name> ON|OFF|GAP <name> <ms>"));
+    return;
+  }
+  if (n < 2 || !script_name_ok(tok[1], name)){ Serial.println(F("Name fehlt/ungültig (1..8 Zeichen A-Z 0-9 _)")); return; }
+  if (!cli_is(sub, PSTR("REC"))) a = jbc_script::find(tok[1], h);
+
+  if (cli_is(sub, PSTR("REC"))){
+    if (rec.active){ Serial.println(F("Aufnahme läuft bereits")); return; }
+    if (jbc_script::find(tok[1], h)){ Serial.println(F("Name existiert – erst SCRIPT DEL")); return; }
+    memset(&rec, 0, sizeof rec);
+    rec.addr = jbc_script::end_addr();
+    rec.pos  = jbc_script::body(rec.addr);
+    if (rec.pos + 3 >= jbc_script::END){ Serial.println(F("EEPROM voll")); return; }
+    memcpy(rec.hdr.name, name, jbc_script::NAME_LEN);
+    rec.hdr.backend = g_backend;
+    rec.hdr.gap_ms  = (n >= 3) ? (uint16_t)atol(tok[2]) : SCRIPT_GAP_DEFAULT_MS;
+    rec.from_usb    = g_cli_from_usb;
+    rec.active      = true;
+    print_script_name(rec.hdr); Serial.print(F(": Aufnahme für "));
+    Serial.print(jbc_name::backend_name(g_backend));
+    Serial.println(F(" – JBC-Zeilen werden gespeichert statt gesendet, SCRIPT END beendet"));
+    return;
+  }
+  if (!a){ Serial.println(F("unbekanntes Skript")); return; }
+
+  if (cli_is(sub, PSTR("RUN"))){
+    if (g_cli_from_usb && !g_usb_jbc_send_enabled){ Serial.println(F("JBC-Senden über USB ist deaktiviert (USBCLI ON)")); return; }
+    if (g_script_run.addr){ Serial.println(F("es läuft bereits ein Skript")); return; }
+    if (!link_up){ Serial.println(F("kein Link")); return; }
+    const __FlashStringHelper* err = script_start(a, h, cli_src_con(), g_cli_tag, false);
+    print_script_name(h);
+    if (err){ Serial.print(F(": ")); Serial.println(err); return; }
+    Serial.print(F(" gestartet: ")); Serial.print(h.steps);
+    Serial.print(F(" Schritte, Abstand ")); Serial.print(h.gap_ms); Serial.println(F("ms"));
+    return;
+  }
+  if (cli_is(sub, PSTR("SHOW"))){
+    print_script_name(h); Serial.print(F(" (")); Serial.print(jbc_name::backend_name((Backend)h.backend));
+    Serial.println(')');
+    script_show(a, h);
+    return;
+  }
+  if (cli_is(sub, PSTR("DEL"))){
+    if (g_script_run.addr || rec.active){ Serial.println(F("nicht während RUN/REC")); return; }
+    jbc_script::remove(a);
+    print_script_name(h); Serial.println(F(" gelöscht"));
+    return;
+  }
+  // write_hdr() berechnet die CRC neu: ein kaputtes Skript würde sonst stillschweigend gültig
+  if ((cli_is(sub, PSTR("AUTO")) || cli_is(sub, PSTR("GAP"))) && n >= 3 && !jbc_script::valid(a, h)){
+    print_script_name(h); Serial.println(F(": CRC falsch, nicht geändert (SCRIPT DEL)"));
+    return;
+  }
+  if (cli_is(sub, PSTR("AUTO")) && n >= 3){
+    if (cli_is(tok[2], PSTR("ON"))) h.flags |= jbc_script::F_AUTORUN;
+    else                            h.flags &= (uint8_t)~jbc_script::F_AUTORUN;
+    jbc_script::write_hdr(a, h);
+    print_script_name(h); Serial.print(F(" auto=")); Serial.println((h.flags & jbc_script::F_AUTORUN) ? F("ON") : F("OFF"));
+    return;
+  }
+  if (cli_is(sub, PSTR("GAP")) && n >= 3){
+    h.gap_ms = (uint16_t)atol(tok[2]);
+    jbc_script::write_hdr(a, h);
+    print_script_name(h); Serial.print(F(" gap=")); Serial.print(h.gap_ms); Serial.println(F("ms"));
+    return;
+  }
+  Serial.println(F("Syntax: SCRIPT AUTO <name> ON|OFF | SCRIPT GAP <name> <ms>"));
+}
+
+// ======================================================
+//      SWEEP: Lesebefehle über einen Portbereich, eine Ergebniszeile je Port
+// ======================================================
+#define SWEEP_CMDS    4     // Befehle je SWEEP
+#define SWEEP_SLOTS   16    // Ports × Befehle
+#define SWEEP_WINDOW  4     // gleichzeitig offene Anfragen (P02; P01 ohne FID: 1)
+#define SWEEP_PAYLOAD 8     // Payload je Lesebefehl (kodiert)
+#define SWEEP_POOL    128   // Antwort-Payloads bis zur Ausgabe, nach jedem Port verdichtet
+
+enum : uint8_t { SW_OPEN, SW_QUEUED, SW_SENT, SW_DATA, SW_LOST };
+struct SweepSlot {
+  uint16_t t_sent;                    // millis() & 0xFFFF, reicht für CLI_REPLY_TIMEOUT_MS
+  uint8_t  fid, ctrl, off, len, state;
+};
+// Einmal beim Start kodiert; je Port wird nur das Port-Byte ersetzt
+struct SweepCmd {
+  uint8_t ctrl, len;
+  uint8_t poff;                       // Index des Port-Bytes, 0xFF = nur ein Port
+  uint8_t payload[SWEEP_PAYLOAD];
+};
+struct Sweep {
+  SweepCmd  cmd[SWEEP_CMDS];
+  uint8_t   ncmd, p0, nports, nslots;
+  uint8_t   next_send, next_port;     // nächster einzureihender Slot / nächster auszugebender Port
+  uint8_t   con;
+  uint8_t   gen;                      // Lauf-Nummer: alte Einträge in der Warteschlange erkennen
+  uint16_t  tag;
+  uint8_t   pool_used;
+  uint8_t   lost;
+  uint32_t  t_start;
+  bool      active;
+  SweepSlot slot[SWEEP_SLOTS];
+  uint8_t   pool[SWEEP_POOL];
+};
+static_assert(SWEEP_POOL <= 255, "SWEEP_POOL: off/len sind uint8_t");
+static Sweep g_sweep;
+
+// "CMD [args]" für Port p nach enc ([ctrl][len][payload]) kodieren: Port ist immer CLI-Argument 1
+static bool sweep_encode(const char* cmd, uint8_t port, uint8_t* enc){
+  char line[CLI_LINE_MAX + 8];
+  const char* args = strchr(cmd, ' ');
+  size_t n = args ? (size_t)(args - cmd) : strlen(cmd);
+  memcpy(line, cmd, n);
+  line[n++] = ' ';
+  utoa(port, line + n, 10);
+  if (args) strcat(line, args);
+  s_cli_enc = enc;
+  return jbc_cli::handle(line, g_backend, dst_current(), cli_capture);
+}
+
+static inline CliQueue& sweep_queue(){ return g_sweep.con == CON_USB ? cli_q_usb : cli_q_s1; }
+
+// nächsten Slot in die Warteschlange der startenden Konsole; gesendet wird in cli_dispatch_one()
+static bool sweep_enqueue_next(){
+  Sweep& sw = g_sweep;
+  const SweepCmd& c = sw.cmd[sw.next_send % sw.ncmd];
+  uint8_t payload[SWEEP_PAYLOAD];
+  memcpy(payload, c.payload, c.len);
+  if (c.poff != 0xFF) payload[c.poff] = (uint8_t)(sw.p0 + sw.next_send / sw.ncmd);
+  CliQueue& q = sweep_queue();
+  const uint8_t bit = cli_enqueue_enc(q, (uint16_t)((sw.gen << 8) | sw.next_send), c.ctrl, payload, c.len);
+  if (!bit) return false;
+  q.swp |= bit;
+  SweepSlot& sl = sw.slot[sw.next_send++];
+  sl.ctrl  = c.ctrl;   // auch für "–", falls der Eintrag nie gesendet wird
+  sl.state = SW_QUEUED;
+  return true;
+}
+
+// Eintrag ist dran (aus cli_dispatch_one); veraltete Einträge werden still verworfen
+static void sweep_dispatch(uint16_t ref, const uint8_t* e){
+  Sweep& sw = g_sweep;
+  const uint8_t i = (uint8_t)ref;
+  if (!sw.active || (uint8_t)(ref >> 8) != sw.gen || i >= sw.nslots || sw.slot[i].state != SW_QUEUED) return;
+  SweepSlot& sl = sw.slot[i];
+  sl.fid    = (g_proto == PROTO_P01) ? 0 : next_fid();
+  sl.ctrl   = e[0];
+  sl.t_sent = (uint16_t)millis();
+  sl.state  = SW_SENT;
+  g_cli_tag = sw.tag;
+  send_ctrl_by_proto(dst_current(), e[0], e + 2, e[1], sl.fid);
+}
+
+// Eintrag lief in der Warteschlange ab (cli_queue_expire)
+static void sweep_drop(uint16_t ref){
+  Sweep& sw = g_sweep;
+  const uint8_t i = (uint8_t)ref;
+  if (!sw.active || (uint8_t)(ref >> 8) != sw.gen || i >= sw.nslots || sw.slot[i].state != SW_QUEUED) return;
+  sw.slot[i].state = SW_LOST; sw.lost++;
+}
+
+// Antwort einem gesendeten Slot zuordnen; true = verbraucht (kein Einzel-Print)
+static bool sweep_on_frame(uint8_t fid, uint8_t ctrl, const uint8_t* d, uint8_t len, bool p01){
+  Sweep& sw = g_sweep;
+  if (!sw.active) return false;
+  for (uint8_t i = (uint8_t)(sw.next_port * sw.ncmd); i < sw.next_send; i++){
+    SweepSlot& sl = sw.slot[i];
+    if (sl.state != SW_SENT) continue;
+    if (p01 ? (ctrl != sl.ctrl && !jbc_decode::is_nack_ctrl(g_backend, ctrl)) : (fid != sl.fid)) continue;
+    if (sw.pool_used + len > SWEEP_POOL) len = (uint8_t)(SWEEP_POOL - sw.pool_used);   // abgeschnitten
+    memcpy(sw.pool + sw.pool_used, d, len);
+    sl.off = sw.pool_used; sl.len = len;
+    sl.ctrl = ctrl;
+    sw.pool_used = (uint8_t)(sw.pool_used + len);
+    sl.state = SW_DATA;
+    return true;
+  }
+  return false;
+}
+
+// Payload eines ausgegebenen Slots aus dem Pool nehmen, spätere Antworten nachrücken
+static void sweep_pool_free(const SweepSlot& gone){
+  Sweep& sw = g_sweep;
+  if (!gone.len) return;
+  const uint8_t end = (uint8_t)(gone.off + gone.len);
+  memmove(sw.pool + gone.off, sw.pool + end, sw.pool_used - end);
+  sw.pool_used = (uint8_t)(sw.pool_used - gone.len);
+  for (uint8_t i = 0; i < sw.next_send; i++){
+    SweepSlot& sl = sw.slot[i];
+    if (sl.state == SW_DATA && sl.len && sl.off >= end) sl.off = (uint8_t)(sl.off - gone.len);
+  }
+}
+
+static void sweep_print_port(uint8_t pi){
+  Sweep& sw = g_sweep;
+  Serial.print(F("[SWEEP] P")); Serial.print(sw.p0 + pi); Serial.print(F(": "));
+  con_join(true);
+  for (uint8_t c=0; c<sw.ncmd; c++){
+    SweepSlot& sl = sw.slot[pi * sw.ncmd + c];
+    const uint8_t* d = sw.pool + sl.off;
+    bool done = sl.state == SW_DATA && jbc_decode::decode_payload_and_print(g_backend, sl.ctrl, d, sl.len);
+    if (!done){
+      jbc_name::print_cmd_name(g_backend, sl.ctrl);
+      if (sl.state == SW_DATA){ Serial.print(F(" = ")); jbc_decode::print_hex(d, sl.len); Serial.println(); }
+      else                      Serial.println(F(" –"));   // keine Antwort
+    }
+    if (sl.state == SW_DATA){ sweep_pool_free(sl); sl.len = 0; }
+  }
+  con_join(false);
+  Serial.println();
+}
+
+static void sweep_tick(){
+  Sweep& sw = g_sweep;
+  if (!sw.active) return;
+  uint32_t now = millis();
+
+  // offene Anfragen zählen, Timeouts verbuchen; ohne Link ist auch Eingereihtes verloren
+  uint8_t open = 0;
+  for (uint8_t i = (uint8_t)(sw.next_port * sw.ncmd); i < sw.next_send; i++){
+    SweepSlot& sl = sw.slot[i];
+    if (sl.state != SW_QUEUED && sl.state != SW_SENT) continue;
+    if (!link_up || (sl.state == SW_SENT && (uint16_t)((uint16_t)now - sl.t_sent) > CLI_REPLY_TIMEOUT_MS)){
+      sl.state = SW_LOST; sw.lost++;
+    }
+    else open++;
+  }
+
+  // Fenster auffüllen; ein Platz der Warteschlange bleibt für Einzelbefehle frei, und
+  // jeder Frame kostet ein Token der startenden Konsole (gedrosselt: im nächsten Tick weiter)
+  uint8_t window = (g_proto == PROTO_P01) ? 1 : SWEEP_WINDOW;
+  const int8_t src = rate_src(sw.con);
+  while (cli_link_ready() && open < window && sw.next_send < sw.nslots &&
+         sweep_queue().count < CLI_Q_DEPTH - 1 && (src < 0 || rate_take((uint8_t)src, true))){
+    if (!sweep_enqueue_next()){ if (src >= 0) rate_give((uint8_t)src); break; }
+    open++;
+  }
+
+  // fertige Ports in Reihenfolge ausgeben
+  con_route(sw.con); con_tag(sw.tag);
+  while (sw.next_port < sw.nports){
+    uint8_t first = (uint8_t)(sw.next_port * sw.ncmd), c = 0;
+    for (; c < sw.ncmd && first + c < sw.next_send && sw.slot[first + c].state >= SW_DATA; c++) {}
+    if (c < sw.ncmd) break;
+    sweep_print_port(sw.next_port++);
+  }
+  if (sw.next_port == sw.nports){
+    Serial.print(F("[SWEEP] fertig: ")); Serial.print(sw.nports); Serial.print(F(" Ports x "));
+    Serial.print(sw.ncmd); Serial.print(F(" Befehle, ohne Antwort=")); Serial.print(sw.lost);
+    Serial.print(F(" dauer=")); Serial.print(now - sw.t_start); Serial.println(F("ms"));
+    sw.active = false;
+  }
+  con_reset();
+}
+
+// "SWEEP [p0[-p1]] CMD [args] [; CMD [args] ...]"
+static void sweep_msg(){ Serial.print(cli_src_prefix()); Serial.print(F(" [SWEEP] ")); }
+
+static void sweep_cli(char* args){
+  Sweep& sw = g_sweep;
+  if (g_cli_from_usb && !g_usb_jbc_send_enabled){ sweep_msg(); Serial.println(F("JBC-Senden über USB ist deaktiviert (USBCLI ON)")); return; }
+  if (sw.active){ sweep_msg(); Serial.println(F("es läuft bereits ein SWEEP")); return; }
+  if (!cli_link_ready()){ sweep_msg(); Serial.println(F("kein Link")); return; }
+
+  while (*args == ' ') ++args;
+  uint8_t p0 = 0, p1 = (uint8_t)(jbc_decode::g_station_ports - 1);
+  if (isdigit((unsigned char)*args)){
+    char* e;
+    p0 = p1 = (uint8_t)strtoul(args, &e, 10);
+    if (*e == '-') p1 = (uint8_t)strtoul(e + 1, &e, 10);
+    args = e;
+    while (*args == ' ') ++args;
+  }
+  if (p1 < p0 || p1 >= jbc_decode::g_station_ports){
+    sweep_msg(); Serial.print(F("Ports 0..")); Serial.print(jbc_decode::g_station_ports - 1); Serial.println(F(" erlaubt"));
+    return;
+  }
+
+  // Befehlsliste an Ort und Stelle zerlegen (';' trennt)
+  char* cmd[SWEEP_CMDS];
+  uint8_t ncmd = 0;
+  for (char* p = args; *p && ncmd < SWEEP_CMDS; ){
+    while (*p == ' ' || *p == ';') ++p;
+    if (!*p) break;
+    cmd[ncmd++] = p;
+    char* e = strchr(p, ';');
+    char* end = e ? e : p + strlen(p);
+    while (end > p && end[-1] == ' ') --end;
+    *end = '\0';
+    if (!e) break;
+    p = e + 1;
+  }
+  const uint8_t nports = (uint8_t)(p1 - p0 + 1);
+  if (!ncmd || nports * ncmd > SWEEP_SLOTS){
+    sweep_msg(); Serial.print(F("Syntax: SWEEP [p0[-p1]] M_CMD [args] [; M_CMD ...]  (max. "));
+    Serial.print(SWEEP_SLOTS); Serial.println(F(" Anfragen)"));
+    return;
+  }
+
+  // jeden Befehl einmal kodieren: nur Lesebefehle mit Port, Port als einzelnes Payload-Byte
+  const uint8_t gen = sw.gen;
+  memset(&sw, 0, sizeof sw);
+  sw.gen = (uint8_t)(gen + 1);
+  for (uint8_t c=0; c<ncmd; c++){
+    uint8_t a[2 + jbc_rpc::PAYLOAD_MAX], b[2 + jbc_rpc::PAYLOAD_MAX];
+    if (!sweep_encode(cmd[c], p0, a)) return;   // handle() hat den Fehler gemeldet
+    if (!jbc_meta::ctrl_is(g_backend, a[0], jbc_meta::CM_PORT) ||
+         jbc_meta::ctrl_is(g_backend, a[0], jbc_meta::CM_EXPECT_ACK)){
+      sweep_msg(); Serial.print(F("nur Lesebefehle mit Port: "));
+      jbc_name::print_cmd_name(g_backend, a[0]); Serial.println();
+      return;
+    }
+    SweepCmd& sc = sw.cmd[c];
+    sc.ctrl = a[0]; sc.len = a[1]; sc.poff = 0xFF;
+    if (nports > 1){
+      if (!sweep_encode(cmd[c], p1, b)) return;
+      for (uint8_t i=0; i<a[1] && b[1] == a[1]; i++){
+        if (a[2 + i] == b[2 + i]) continue;
+        if (sc.poff != 0xFF || a[2 + i] != p0 || b[2 + i] != p1){ sc.poff = 0xFE; break; }
+        sc.poff = i;
+      }
+    }
+    if (sc.len > SWEEP_PAYLOAD || (nports > 1 && sc.poff >= SWEEP_PAYLOAD)){
+      sweep_msg(); Serial.print(F("nicht für mehrere Ports kodierbar: "));
+      jbc_name::print_cmd_name(g_backend, sc.ctrl); Serial.println();
+      return;
+    }
+    memcpy(sc.payload, a + 2, sc.len);
+  }
+  sw.ncmd    = ncmd;
+  sw.p0      = p0;
+  sw.nports  = nports;
+  sw.nslots  = (uint8_t)(nports * ncmd);
+  sw.con     = cli_src_con();
+  sw.tag     = g_cli_tag;
+  sw.t_start = millis();
+  sw.active  = true;
+  sweep_msg(); Serial.print(sw.nports); Serial.print(F(" Ports x ")); Serial.print(sw.ncmd); Serial.println(F(" Befehle"));
+}
+
+// ======================================================
+//      RATE: Token-Bucket je Konsole anzeigen/setzen
+// ======================================================
+static void rate_print(uint8_t src){
+  const RateBucket& b = g_rate[src];
+  Serial.print(cli_src_prefix()); Serial.print(F(" [RATE] "));
+  Serial.print(src ? F("S1 ") : F("USB"));
+  if (g_cfg.rate[src]){
+    Serial.print(F(" rate=")); Serial.print(g_cfg.rate[src]); Serial.print(F("/s burst=")); Serial.print(g_cfg.burst[src]);
+  } else {
+    Serial.print(F(" rate=unbegrenzt"));
+  }
+  Serial.print(F(" ok=")); Serial.print(b.passed);
+  Serial.print(F(" gedrosselt=")); Serial.println(b.throttled);
+}
+
+// "RATE" | "RATE USB|S1 <pro_s> [burst]" (0 = unbegrenzt, persistiert) | "RATE RESET"
+static void rate_cli(char* args){
+  char* tok[3];
+  uint8_t n = jbc_cli::split_tokens(args, tok, 3);
+  if (n == 1 && cli_is(tok[0], PSTR("RESET"))){
+    for (uint8_t i=0; i<2; i++){ g_rate[i].passed = g_rate[i].throttled = 0; }
+  }
+  else if (n >= 2 && (cli_is(tok[0], PSTR("USB")) || cli_is(tok[0], PSTR("S1")))){
+    uint8_t src = cli_is(tok[0], PSTR("S1")) ? 1 : 0;
+    unsigned long r = strtoul(tok[1], nullptr, 10);
+    unsigned long b = (n >= 3) ? strtoul(tok[2], nullptr, 10) : g_cfg.burst[src];
+    cfg_set_rate(src, (uint8_t)(r > 255 ? 255 : r), (uint8_t)(b > 255 ? 255 : b));
+    g_rate[src].t_last = 0;   // Eimer neu füllen
+  }
+  else if (n){
+    Serial.print(cli_src_prefix()); Serial.println(F(" [RATE] Syntax: RATE | RATE USB|S1 <pro_s> [burst] | RATE RESET"));
+    return;
+  }
+  rate_print(0);
+  rate_print(1);
+}
+
+// ======================================================
+//      CONTIDELTA: Conti-Port-Zeilen nur bei Änderung
+// ======================================================
+static void contidelta_print(){
+  const jbc_decode::ContiDelta& cd = jbc_decode::g_conti_delta;
+  Serial.print(cli_src_prefix()); Serial.print(F(" [CONTIDELTA] "));
+  Serial.print(cd.on ? F("ON") : F("OFF"));
+  Serial.print(F(" db_c="));   jbc_fmt::print_fix(Serial, cd.db_dc, 1);
+  Serial.print(F(" db_pct=")); jbc_fmt::print_fix(Serial, cd.db_pm, 1);
+  Serial.print(F(" hb_s="));   Serial.print(cd.hb_s);
+  Serial.print(F(" shown="));  Serial.print(cd.shown);
+  Serial.print(F(" skipped=")); Serial.println(cd.skipped);
+}
+
+// "2", "2.5" -> Zehntel (höchstens 25.5); false = keine Zahl
+static bool parse_tenths(const char* s, uint8_t& v){
+  char* e;
+  unsigned long t = strtoul(s, &e, 10) * 10;
+  if (e == s) return false;
+  if (*e == '.' || *e == ',') { if (e[1] >= '0' && e[1] <= '9') t += (unsigned long)(e[1] - '0'); e += 2; }
+  if (*e || t > 255) return false;
+  v = (uint8_t)t;
+  return true;
+}
+
+// "CONTIDELTA" | "CONTIDELTA ON|OFF" | "CONTIDELTA <°C> <%> [hb_s]" (persistiert) | "CONTIDELTA RESET"
+static void contidelta_cli(char* args){
+  jbc_decode::ContiDelta& cd = jbc_decode::g_conti_delta;
+  char* tok[3];
+  uint8_t n = jbc_cli::split_tokens(args, tok, 3);
+  uint8_t dc = cd.db_dc, pm = cd.db_pm;
+  if      (n == 1 && cli_is(tok[0], PSTR("RESET"))) cd.shown = cd.skipped = 0;
+  else if (n == 1 && cli_is(tok[0], PSTR("ON")))    cfg_set_conti_delta(true,  dc, pm, cd.hb_s);
+  else if (n == 1 && cli_is(tok[0], PSTR("OFF")))   cfg_set_conti_delta(false, dc, pm, cd.hb_s);
+  else if (n >= 2 && parse_tenths(tok[0], dc) && parse_tenths(tok[1], pm)){
+    unsigned long hb = (n >= 3) ? strtoul(tok[2], nullptr, 10) : cd.hb_s;
+    cfg_set_conti_delta(true, dc, pm, (uint8_t)(hb > 255 ? 255 : hb));
+  }
+  else if (n){
+    Serial.print(cli_src_prefix()); Serial.println(F(" [CONTIDELTA] Syntax: CONTIDELTA | CONTIDELTA ON|OFF | CONTIDELTA <°C> <%> [hb_s] | CONTIDELTA RESET"));
+    return;
+  }
+  contidelta_print();
+}
+
+// ======================================================
+//      TXBUF: Sende-Puffer je Konsole (Füllstand, Verwerfen, Politik)
+// ======================================================
+#if defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
+static void txbuf_print(uint8_t i){
+  static const char* const pol[] = { "BLOCK", "OLD", "NEW" };
+  Serial.print(cli_src_prefix()); Serial.print(F(" [TXBUF] "));
+  Serial.print(i ? F("S1 ") : F("USB"));
+  Serial.print(F(" policy=")); Serial.print(pol[Console.policy(i)]);
+  if (Console.framed(i) && Console.policy(i) != TXP_BLOCK) Serial.print(F(" (binär/RPC: BLOCK)"));
+  Serial.print(F(" queued=")); Serial.print(Console.queued(i));
+  Serial.print(F(" peak=")); Serial.print(Console.peak(i)); Serial.print('/'); Serial.print(CON_TXBUF);
+  Serial.print(F(" drops=")); Serial.println(Console.drops(i));
+}
+
+// "TXBUF" | "TXBUF USB|S1 BLOCK|OLD|NEW" (persistiert) | "TXBUF RESET"
+static void txbuf_cli(char* args){
+  char* tok[2];
+  uint8_t n = jbc_cli::split_tokens(args, tok, 2);
+  if (n == 1 && cli_is(tok[0], PSTR("RESET"))) Console.clear_stats();
+  else if (n == 2 && (cli_is(tok[0], PSTR("USB")) || cli_is(tok[0], PSTR("S1")))){
+    uint8_t i = cli_is(tok[0], PSTR("S1")) ? 1 : 0;
+    if      (cli_is(tok[1], PSTR("BLOCK"))) cfg_set_txpolicy(i, TXP_BLOCK);
+    else if (cli_is(tok[1], PSTR("OLD")))   cfg_set_txpolicy(i, TXP_DROP_OLD);
+    else if (cli_is(tok[1], PSTR("NEW")))   cfg_set_txpolicy(i, TXP_DROP_NEW);
+    else n = 0xFF;
+  }
+  else if (n) n = 0xFF;
+  if (n == 0xFF){
+    Serial.print(cli_src_prefix()); Serial.println(F(" [TXBUF] Syntax: TXBUF | TXBUF USB|S1 BLOCK|OLD|NEW | TXBUF RESET"));
+    return;
+  }
+  txbuf_print(0);
+  txbuf_print(1);
+}
+#else
+static void txbuf_cli(char*){ Serial.println(F("[TXBUF] nur mit Dual-Konsole")); }
+#endif
+
+// ======================================================
+//      SHED: Ausgabe bei Rückstau je Konsole stufenweise drosseln
+// ======================================================
+// Druck je Tick = Ring über SHED_HIGH, oder seit dem letzten Tick verworfene Zeilen / Warten
+// auf die HW (BLOCK). Erst SHED_STEP_MS Druck am Stück zählt (ein einzelner Schwall wie HELP
+// oder ein Burst nicht): eine Stufe hoch; SHED_HOLD_MS ohne solchen Dauerdruck: eine zurück.
+// So läuft der RX-Pfad weiter, statt dauernd in sink_write() zu warten.
+#if defined(__AVR_ATmega2560__) || defined(__AVR_ATmega1280__)
+#define SHED_TICK_MS  100
+#define SHED_STEP_MS  500
+#define SHED_HOLD_MS  5000
+#define SHED_HIGH     (CON_TXBUF * 3 / 4)
+struct Shed {
+  bool     on = true;
+  uint8_t  ticks[2]    = { 0, 0 };           // Ticks mit Druck am Stück
+  uint32_t drops[2]    = { 0, 0 };           // Zählerstände beim letzten Tick
+  uint32_t stalls[2]   = { 0, 0 };
+  uint32_t t_calm[2]   = { 0, 0 };           // seit hier kein Dauerdruck (bzw. letzter Stufenwechsel)
+  uint32_t t_tick      = 0;
+};
+static Shed g_shed;
+
+static const __FlashStringHelper* shed_name(uint8_t l){
+  if (l == SHED_CONTI) return F("HEX/TXRX pausiert, Conti nur als Summe");
+  if (l == SHED_DEBUG) return F("HEX/TXRX pausiert");
+  return F("volle Ausgabe");
+}
+static void shed_print(uint8_t i){
+  Serial.print(i ? F("S1 ") : F("USB"));
+  Serial.print(F(" level=")); Serial.print(Console.shed(i));
+  Serial.print(F(" (")); Serial.print(shed_name(Console.shed(i))); Serial.print(')');
+  Serial.print(F(" queued=")); Serial.print(Console.queued(i)); Serial.print('/'); Serial.print(CON_TXBUF);
+  Serial.print(F(" drops=")); Serial.print(Console.drops(i));
+  Serial.print(F(" stalls=")); Serial.println(Console.stalls(i));
+}
+// Stufe wechseln und an allen Konsolen melden (Kategorie STATUS, geht auch gedrosselt durch)
+static void shed_set(uint8_t i, uint8_t l, uint32_t now){
+  Console.set_shed(i, l);
+  g_shed.ticks[i] = 0;
+  g_shed.t_calm[i] = now;
+  Serial.print(F("[SHED] ")); shed_print(i);
+}
+
+static void shed_tick(){
+  const uint32_t now = millis();
+  if (now - g_shed.t_tick < SHED_TICK_MS) return;
+  g_shed.t_tick = now;
+  for (uint8_t i=0; i<2; i++){
+    const uint32_t d = Console.drops(i), st = Console.stalls(i);
+    const bool press = Console.queued(i) >= SHED_HIGH || d != g_shed.drops[i] || st != g_shed.stalls[i];
+    g_shed.drops[i] = d; g_shed.stalls[i] = st;
+    if (!g_shed.on) continue;
+    const uint8_t l = Console.shed(i);
+    g_shed.ticks[i] = press ? (uint8_t)(g_shed.ticks[i] + 1) : 0;
+    if (g_shed.ticks[i] >= SHED_STEP_MS / SHED_TICK_MS){
+      if (l < SHED_CONTI) shed_set(i, l + 1, now);
+      else { g_shed.ticks[i] = 0; g_shed.t_calm[i] = now; }   // schon ganz unten: nur Ruhe abwarten
+    }
+    else if (l && now - g_shed.t_calm[i] >= SHED_HOLD_MS) shed_set(i, l - 1, now);
+  }
+}
+
+// "SHED" | "SHED ON|OFF" (OFF: sofort volle Ausgabe, keine Automatik)
+static void shed_cli(char* args){
+  while (*args == ' ') args++;
+  if (cli_is(args, PSTR("ON")))  g_shed.on = true;
+  else if (cli_is(args, PSTR("OFF"))){
+    g_shed.on = false;
+    for (uint8_t i=0; i<2; i++) Console.set_shed(i, SHED_OFF);
+  }
+  else if (*args){
+    Serial.print(cli_src_prefix()); Serial.println(F(" [SHED] Syntax: SHED | SHED ON|OFF"));
+    return;
+  }
+  Serial.print(cli_src_prefix()); Serial.print(F(" [SHED] auto=")); Serial.println(g_shed.on ? F("ON") : F("OFF"));
+  for (uint8_t i=0; i<2; i++){ Serial.print(cli_src_prefix()); Serial.print(F(" [SHED] ")); shed_print(i); }
+}
+#else
+static void shed_tick(){}
+static void shed_cli(char*){ Serial.println(F("[SHED] nur mit Dual-Konsole")); }
+#endif
+
+// ======================================================
+//      OUT: Kategorien/Verbosity je Konsole
+// ======================================================
+static const char CAT_NAMES[] PROGMEM = "REPLY\0SYN\0CONTI\0TXRX\0HEX\0STATUS\0";
+static const uint8_t OUT_LEVEL[] = {                 // OUT <konsole> 0..3
+  CAT_REPLY,                                         // 0: nur Antworten
+  CAT_REPLY | CAT_CONTI | CAT_STATUS,                // 1: + Telemetrie, Status
+  CAT_REPLY | CAT_CONTI | CAT_STATUS | CAT_TXRX | CAT_SYN,   // 2: + [TX]/[RX], SYN
+  CAT_ALL                                            // 3: + HEX/[RAW]
+};
+
+// Kategorie-Name -> Bit (ALL = alle), 0 = unbekannt
+static uint8_t cat_from_name(const char* n){
+  if (cli_is(n, PSTR("ALL"))) return CAT_ALL;
+  PGM_P p = CAT_NAMES;
+  for (uint8_t bit = 1; pgm_read_byte(p); bit <<= 1, p += strlen_P(p) + 1)
+    if (!strcasecmp_P(n, p)) return bit;
+  return 0;
+}
+
+static void out_print(uint8_t i){
+  uint8_t m = g_cfg.out_mask[i];
+  Serial.print(cli_src_prefix()); Serial.print(F(" [OUT] "));
+  Serial.print(i ? F("S1 ") : F("USB"));
+  Serial.print(F(" mask=0x")); if (m < 16) Serial.print('0'); Serial.print(m, HEX);
+  PGM_P p = CAT_NAMES;
+  for (uint8_t bit = 1; pgm_read_byte(p); bit <<= 1, p += strlen_P(p) + 1){
+    if (!(m & bit)) continue;
+    Serial.print(' '); Serial.print((const __FlashStringHelper*)p);
+  }
+  const uint8_t con = i ? CON_S1 : CON_USB;
+  Serial.print((g_cfg.bin & con) ? F(" frames=BIN") : (g_cfg.json & con) ? F(" frames=JSON") : F(" frames=TEXT"));
+  Serial.println();
+}
+
+// Schema der Binär-Datensätze: Rahmenformat, Zähler, dann je Name "rec <id> <name>" bzw. "field <id> <name>"
+static void out_schema_list(const __FlashStringHelper* what, PGM_P p){
+  uint8_t id = 1;
+  for (; pgm_read_byte(p); p += strlen_P(p) + 1, id++){
+    Serial.print(F("[BIN] ")); Serial.print(what); Serial.print(' '); Serial.print(id);
+    Serial.print(' '); Serial.println((const __FlashStringHelper*)p);
+  }
+}
+static void out_schema(){
+  Serial.println(F("[BIN] frame: B5 len body crc8(len+body, poly 07)"));
+  Serial.println(F("[BIN] body: rec(varint) family ctrl fid {key(varint)=(field<<3)|type value}"));
+  Serial.println(F("[BIN] types: 0=uint 1=hex 2=fix1 3=fix2 (zigzag varint) 4=str 5=bytes (len+data) 6=null; id 0 = name follows (len+data)"));
+  Serial.print(F("[BIN] schema recs=")); Serial.print(jbc_bin::REC_COUNT);
+  Serial.print(F(" fields=")); Serial.print(jbc_bin::FIELD_COUNT);
+  Serial.print(F(" sent=")); Serial.print(jbc_bin::g_rec.sent);
+  Serial.print(F(" dropped=")); Serial.println(jbc_bin::g_rec.dropped);
+  out_schema_list(F("rec"), jbc_bin::REC_NAMES);
+  out_schema_list(F("field"), jbc_bin::FIELD_NAMES);
+}
+
+// "OUT" | "OUT USB|S1 <0..3>" | "OUT USB|S1 +KAT -KAT ..." | "OUT USB|S1 JSON|BIN|TEXT" (persistiert) | "OUT SCHEMA"
+static void out_cli(char* args){
+  char* tok[8];
+  uint8_t n = jbc_cli::split_tokens(args, tok, 8);
+  if (n == 1 && cli_is(tok[0], PSTR("SCHEMA"))) { out_schema(); return; }
+  if (n >= 2 && (cli_is(tok[0], PSTR("USB")) || cli_is(tok[0], PSTR("S1")))){
+    uint8_t i = cli_is(tok[0], PSTR("S1")) ? 1 : 0;
+    uint8_t m = g_cfg.out_mask[i];
+    int8_t  fmt = -1;
+    for (uint8_t k=1; k<n; k++){
+      const char* t = tok[k];
+      if (isdigit((unsigned char)t[0]) && !t[1] && t[0] <= '3') { m = OUT_LEVEL[t[0] - '0']; continue; }
+      if (cli_is(t, PSTR("TEXT"))) { fmt = FMT_TEXT; continue; }
+      if (cli_is(t, PSTR("JSON"))) { fmt = FMT_JSON; continue; }
+      if (cli_is(t, PSTR("BIN")))  { fmt = FMT_BIN;  continue; }
+      uint8_t c = (t[0] == '+' || t[0] == '-') ? cat_from_name(t + 1) : 0;
+      if (!c){
+        Serial.print(cli_src_prefix()); Serial.print(F(" [OUT] Unbekannt: ")); Serial.println(t);
+        return;
+      }
+      if (t[0] == '+') m |= c; else m &= (uint8_t)~c;
+    }
+    if (fmt >= 0) cfg_set_fmt(i ? CON_S1 : CON_USB, (uint8_t)fmt);
+    cfg_set_out_mask(i, m);
+    sink_interest_update();
+  }
+  else if (n){
+    Serial.print(cli_src_prefix());
+    Serial.println(F(" [OUT] Syntax: OUT | OUT USB|S1 0..3 | OUT USB|S1 +KAT -KAT | OUT USB|S1 JSON|BIN|TEXT | OUT SCHEMA  (REPLY SYN CONTI TXRX HEX STATUS ALL)"));
+    return;
+  }
+  out_print(0);
+  out_print(1);
+}
+
+// ======================================================
+//      RPC: binäre Anfragen auf Serial1 (COBS + CRC16, siehe jbc_rpc.h)
+// ======================================================
+static jbc_rpc::Rx g_rpc_rx;
+static uint32_t    g_rpc_frames = 0, g_rpc_sent = 0;
+static bool        g_rpc_leave = false;   // nach der laufenden Antwort zurück zur Text-CLI
+
+// Antwort <op|0x80> <id> <status> <a...> <b...> <crc> als COBS-Rahmen an Serial1
+static void rpc_respond(uint16_t id, uint8_t op, uint8_t st, const uint8_t* a, uint8_t an,
+                        const uint8_t* b, uint8_t bn){
+  if (!g_s1_rpc) return;   // Modus inzwischen verlassen
+  uint8_t raw[4 + jbc_rpc::DATA_MAX + 2];
+  static uint8_t enc[sizeof(raw) + 2];
+  uint8_t n = 0;
+  raw[n++] = (uint8_t)(op | jbc_rpc::OP_RESP);
+  raw[n++] = (uint8_t)id; raw[n++] = (uint8_t)(id >> 8);
+  raw[n++] = st;
+  if (an + bn > jbc_rpc::DATA_MAX) an = bn = 0;
+  if (an) { memcpy(raw + n, a, an); n += an; }
+  if (bn) { memcpy(raw + n, b, bn); n += bn; }
+  const uint16_t crc = jbc_rpc::crc16(raw, n);
+  raw[n++] = (uint8_t)crc; raw[n++] = (uint8_t)(crc >> 8);
+  con_raw(CON_S1, enc, jbc_rpc::cobs_encode(raw, n, enc));
+  g_rpc_sent++;
+}
+
+static bool rpc_cfg_get(uint8_t key, uint8_t& v){
+  switch (key){
+    case jbc_rpc::K_AUTO_USB_C: v = auto_usb_c; return true;
+    case jbc_rpc::K_CONTISEND:  v = show_contisend; return true;
+    case jbc_rpc::K_CONTIDELTA: v = jbc_decode::g_conti_delta.on; return true;
+    case jbc_rpc::K_USBCLI:     v = g_usb_jbc_send_enabled; return true;
+    case jbc_rpc::K_OUT_USB:    v = g_cfg.out_mask[0]; return true;
+    case jbc_rpc::K_OUT_S1:     v = g_cfg.out_mask[1]; return true;
+    case jbc_rpc::K_RATE_S1:    v = g_cfg.rate[1]; return true;
+    case jbc_rpc::K_BURST_S1:   v = g_cfg.burst[1]; return true;
+    case jbc_rpc::K_RPC:        v = g_s1_rpc && !g_rpc_leave; return true;
+    default: return false;
+  }
+}
+// Wie die gleichnamigen Text-Kommandos (persistiert)
+static bool rpc_cfg_set(uint8_t key, uint8_t v){
+  switch (key){
+    case jbc_rpc::K_AUTO_USB_C:
+      cfg_set_auto_usb_c(v);
+      if (!v) { usb_set_due_at = 0; usb_set_done = true; }
+      return true;
+    case jbc_rpc::K_CONTISEND:
+      cfg_set_show_conti(v);
+      jbc_decode::g_show_conti_send = v;
+      sink_interest_update();
+      return true;
+    case jbc_rpc::K_CONTIDELTA: {
+      const jbc_decode::ContiDelta& cd = jbc_decode::g_conti_delta;
+      cfg_set_conti_delta(v, cd.db_dc, cd.db_pm, cd.hb_s);
+      return true;
+    }
+    case jbc_rpc::K_USBCLI:     cfg_set_usbcli(v); return true;
+    case jbc_rpc::K_OUT_USB:
+    case jbc_rpc::K_OUT_S1:
+      cfg_set_out_mask(key == jbc_rpc::K_OUT_S1, v & CAT_ALL);
+      sink_interest_update();
+      return true;
+    case jbc_rpc::K_RATE_S1:    cfg_set_rate(1, v, g_cfg.burst[1]); g_rate[1].t_last = 0; return true;
+    case jbc_rpc::K_BURST_S1:   cfg_set_rate(1, g_cfg.rate[1], v); g_rate[1].t_last = 0; return true;
+    case jbc_rpc::K_RPC:        g_rpc_leave = !v; return true;
+    default: return false;
+  }
+}
+
+// Dekodierten Rahmen (inkl. CRC) ausführen
+static void rpc_handle(const uint8_t* f, uint8_t n){
+  if (n < 5 || jbc_rpc::crc16(f, n - 2) != (uint16_t)(f[n-2] | (f[n-1] << 8))) { g_rpc_rx.bad++; return; }
+  g_rpc_frames++;
+  const uint8_t  op = f[0];
+  const uint16_t id = (uint16_t)(f[1] | (f[2] << 8));
+  const uint8_t* a  = f + 3;
+  const uint8_t  an = (uint8_t)(n - 5);
+  switch (op){
+    case jbc_rpc::OP_PING:
+      rpc_respond(id, op, jbc_rpc::ST_OK, &jbc_rpc::VERSION, 1);
+      return;
+    case jbc_rpc::OP_STATUS: {
+      uint8_t pending = 0;
+      for (uint8_t i=0; i<CLI_PENDING_MAX; i++) if (g_cli_pending[i].con && g_cli_pending[i].rpc) pending++;
+      const uint32_t up = millis();
+      const uint8_t d[10] = {
+        (uint8_t)((link_up ? jbc_rpc::SF_LINK : 0) | (cli_link_ready() ? jbc_rpc::SF_READY : 0) |
+                  (g_attached ? jbc_rpc::SF_ATTACHED : 0) | (s_relay ? jbc_rpc::SF_RELAY : 0)),
+        (uint8_t)g_proto, (uint8_t)g_backend, stAddr, cli_q_s1.count, pending,
+        (uint8_t)up, (uint8_t)(up >> 8), (uint8_t)(up >> 16), (uint8_t)(up >> 24) };
+      rpc_respond(id, op, jbc_rpc::ST_OK, d, sizeof(d));
+      return;
+    }
+    case jbc_rpc::OP_JBC:
+      if (!an || an - 1 > jbc_rpc::PAYLOAD_MAX) break;
+      if (!rate_take(1))                         { rpc_respond(id, op, jbc_rpc::ST_RATE, a, 1); return; }
+      if (!cli_enqueue_rpc(id, a[0], a + 1, (uint8_t)(an - 1))) { rate_give(1); rpc_respond(id, op, jbc_rpc::ST_BUSY, a, 1); return; }
+      return;   // Antwort kommt mit dem Frame der Station (oder Timeout)
+    case jbc_rpc::OP_CFG_GET:
+    case jbc_rpc::OP_CFG_SET: {
+      uint8_t kv[2] = { an ? a[0] : (uint8_t)0, an >= 2 ? a[1] : (uint8_t)0 };
+      const bool set = (op == jbc_rpc::OP_CFG_SET);
+      if (an != (set ? 2 : 1) || (set && !rpc_cfg_set(kv[0], kv[1])) || !rpc_cfg_get(kv[0], kv[1])) break;
+      rpc_respond(id, op, jbc_rpc::ST_OK, kv, 2);
+      return;
+    }
+    default:
+      rpc_respond(id, op, jbc_rpc::ST_BAD_OP);
+      return;
+  }
+  rpc_respond(id, op, jbc_rpc::ST_BAD_ARG);
+}
+
+// Serial1 im RPC-Modus: Bytes bis zur 00 sammeln, dann ausführen
+static void rpc_feed(Stream& port){
+  while (g_s1_rpc && port.available() > 0){
+    int c = port.read();
+    if (c < 0) break;
+    uint8_t n = jbc_rpc::rx_push(g_rpc_rx, (uint8_t)c);
+    if (n) rpc_handle(g_rpc_rx.buf, n);
+    if (g_rpc_leave) { g_rpc_leave = false; cfg_set_s1_rpc(false); }
+  }
+}
+
+static void rpc_print(){
+  Serial.print(cli_src_prefix()); Serial.print(F(" [RPC] S1="));
+  Serial.print(g_s1_rpc ? F("ON") : F("OFF"));
+  Serial.print(F(" v")); Serial.print(jbc_rpc::VERSION);
+  Serial.print(F(" frames=")); Serial.print(g_rpc_frames);
+  Serial.print(F(" bad=")); Serial.print(g_rpc_rx.bad);
+  Serial.print(F(" sent=")); Serial.println(g_rpc_sent);
+}
+
+// "RPC" | "RPC ON|OFF" (Serial1 binär / Text, persistiert)
+static void rpc_cli(char* args){
+  char* tok[2];
+  uint8_t n = jbc_cli::split_tokens(args, tok, 2);
+  if (n == 1 && (cli_is(tok[0], PSTR("ON")) || cli_is(tok[0], PSTR("OFF")))){
+    const bool on = cli_is(tok[0], PSTR("ON"));
+    // Meldung vor dem Umschalten, damit sie auch Serial1 noch erreicht
+    Serial.print(cli_src_prefix()); Serial.print(F(" [RPC] S1 -> "));
+    Serial.println(on ? F("binär (COBS + CRC16)") : F("Text-CLI"));
+    g_rpc_rx.n = 0; g_rpc_rx.over = false;
+    cfg_set_s1_rpc(on);
+    return;
+  }
+  else if (n){
+    Serial.print(cli_src_prefix()); Serial.println(F(" [RPC] Syntax: RPC | RPC ON | RPC OFF"));
+    return;
+  }
+  rpc_print();
+}
+
+// "PERF": Zeit je dekodiertem Frame / je Ausgabezeile seit Start bzw. PERF RESET
+static void perf_print(){
+  const Perf& p = g_perf;
+  Serial.print(cli_src_prefix()); Serial.print(F(" [PERF] frames=")); Serial.print(p.frames);
+  Serial.print(F(" lines=")); Serial.print(p.lines);
+  Serial.print(F(" us/frame=")); Serial.print(p.frames ? p.us / p.frames : 0);
+  Serial.print(F(" us/line=")); Serial.print(p.lines ? p.us / p.lines : 0);
+  Serial.print(F(" max_us=")); Serial.println(p.max_us);
+}
+
+// "PERF FMT": Print::print gegen jbc_fmt mit denselben Werten auf einer Prüfsummen-Senke
+// (gleiche Summe = byte-gleiche Ausgabe); Zeit je FMT_BENCH_N Aufrufe
+static const uint16_t FMT_BENCH_N = 256;
+struct FmtSink : public Print {
+  uint32_t sum = 0;
+  size_t write(uint8_t c) override { sum = ((sum << 5) | (sum >> 27)) ^ c; return 1; }
+  size_t write(const uint8_t* b, size_t n) override { for (size_t i=0; i<n; i++) write(b[i]); return n; }
+};
+static uint32_t fmt_bench_val(uint16_t i){ return ((uint32_t)i * 2654435761UL) >> (i & 31); }
+static void fmt_bench_line(const __FlashStringHelper* what, uint32_t us_print, uint32_t us_fmt, bool same){
+  Serial.print(cli_src_prefix()); Serial.print(F(" [PERF] FMT ")); Serial.print(what);
+  Serial.print(F(" n=")); Serial.print(FMT_BENCH_N);
+  Serial.print(F(" print_us=")); Serial.print(us_print);
+  Serial.print(F(" fmt_us=")); Serial.print(us_fmt);
+  Serial.println(same ? F(" ok") : F(" DIFF"));
+}
+static void perf_fmt(){
+  FmtSink a, b;
+  uint32_t t0, ta, tb;
+  // Dezimal (uint32, alle Größenordnungen)
+  t0 = micros(); for (uint16_t i=0; i<FMT_BENCH_N; i++) a.print(fmt_bench_val(i));            ta = micros() - t0;
+  t0 = micros(); for (uint16_t i=0; i<FMT_BENCH_N; i++) jbc_fmt::print_u(b, fmt_bench_val(i)); tb = micros() - t0;
+  fmt_bench_line(F("dec"), ta, tb, a.sum == b.sum);
+  // Hex-Byte mit führender 0 (dump_hex / print_hex)
+  a.sum = b.sum = 0;
+  t0 = micros();
+  for (uint16_t i=0; i<FMT_BENCH_N; i++){ uint8_t v = (uint8_t)i; if (v < 16) a.print('0'); a.print(v, HEX); }
+  ta = micros() - t0;
+  t0 = micros(); for (uint16_t i=0; i<FMT_BENCH_N; i++) jbc_fmt::print_hex2(b, (uint8_t)i); tb = micros() - t0;
+  fmt_bench_line(F("hex8"), ta, tb, a.sum == b.sum);
+  // Temperatur aus UTI mit einer Nachkommastelle (kv_fix)
+  a.sum = b.sum = 0;
+  t0 = micros(); for (uint16_t i=0; i<FMT_BENCH_N; i++) a.print((uint16_t)(i * 257U) / 9.0f, 1); ta = micros() - t0;
+  t0 = micros();
+  for (uint16_t i=0; i<FMT_BENCH_N; i++) jbc_fmt::print_fix(b, jbc_decode::uti_to_dc((uint16_t)(i * 257U)), 1);
+  tb = micros() - t0;
+  fmt_bench_line(F("fix1"), ta, tb, a.sum == b.sum);
+}
+
+// "#<tag> " am Zeilenanfang (0..65534): Antworten tragen dasselbe Tag; sonst s unverändert
+static char* cli_take_tag(char* s, uint16_t& tag){
+  if (s[0] != '#' || !isdigit((unsigned char)s[1])) return s;
+  char* e;
+  unsigned long v = strtoul(s + 1, &e, 10);
+  if (v >= CLI_NO_TAG || (*e && *e != ' ')) return s;
+  tag = (uint16_t)v;
+  return *e ? e + 1 : e;
+}
+
+static void cli_process(char* line){
+  // Normalisieren, optionales Tag abtrennen
+  char* clean = cli_take_tag(cli_normalize(line), g_cli_tag);
+  con_tag(g_cli_tag);
+  while (*clean == '>' || *clean == '#' || *clean == '$') { ++clean; if (*clean == ' ') ++clean; }
+  if (!*clean) return;
+
+  // vor dem M_-Schnitt: Skriptnamen dürfen "M_" enthalten, SWEEP trägt M_-Befehle
+  if (!strncasecmp_P(clean, PSTR("SCRIPT"), 6) && (clean[6] == ' ' || !clean[6])){
+    script_cli(clean + 6);
+    return;
+  }
+  if (!strncasecmp_P(clean, PSTR("SWEEP"), 5) && (clean[5] == ' ' || !clean[5])){
+    sweep_cli(clean + 5);
+    return;
+  }
+
+  // Präfix vor dem ersten "M_" abschneiden (z.B. "ESP: M_R_...")
+  for (char* p = clean + 1; *p; ++p){
+    if ((p[0] == 'M' || p[0] == 'm') && p[1] == '_') { clean = p; break; }
+  }
 
   // Lokale Kommandos
-  if (up == "HELP") { print_cli_help(); return; }
+  if (cli_is(clean, PSTR("HELP"))) { print_cli_help(); return; }
 
-  if (up == "STATE"){
+  if (cli_is(clean, PSTR("STATE"))){
     Serial.print(cli_src_prefix()); Serial.print(' ');
     Serial.print(F("[ST] link=")); Serial.print(link_up?F("UP"):F("DOWN"));
     Serial.print(F(" stAddr=0x")); Serial.print(stAddr,HEX);
@@ -1327,31 +3472,31 @@ static void cli_process(const String &line_in){
     return;
   }
 
-  if (up == "HEX ON")  { DBG_HEX = true;  Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] HEX=ON"));  return; }
-  if (up == "HEX OFF") { DBG_HEX = false; Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] HEX=OFF")); return; }
+  if (cli_is(clean, PSTR("HEX ON")))  { DBG_HEX = true;  Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] HEX=ON"));  return; }
+  if (cli_is(clean, PSTR("HEX OFF"))) { DBG_HEX = false; Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] HEX=OFF")); return; }
 
-  if (up == "LOG ON"  || up == "TXRX ON")  { g_log_show_txrx = true;  Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] LOG=ON (TX/RX sichtbar)"));    return; }
-  if (up == "LOG OFF" || up == "TXRX OFF") { g_log_show_txrx = false; Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] LOG=OFF (TX/RX ausgeblendet)")); return; }
+  if (cli_is(clean, PSTR("LOG ON"))  || cli_is(clean, PSTR("TXRX ON")))  { g_log_show_txrx = true;  Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] LOG=ON (TX/RX sichtbar)"));    return; }
+  if (cli_is(clean, PSTR("LOG OFF")) || cli_is(clean, PSTR("TXRX OFF"))) { g_log_show_txrx = false; Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] LOG=OFF (TX/RX ausgeblendet)")); return; }
 
-  if (up == "SYN ON")  { jbc_decode::g_log_show_syn = true;  Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] SYN=ON"));  return; }
-  if (up == "SYN OFF") { jbc_decode::g_log_show_syn = false; Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] SYN=OFF")); return; }
+  if (cli_is(clean, PSTR("SYN ON")))  { jbc_decode::g_log_show_syn = true;  sink_interest_update(); Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] SYN=ON"));  return; }
+  if (cli_is(clean, PSTR("SYN OFF"))) { jbc_decode::g_log_show_syn = false; sink_interest_update(); Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] SYN=OFF")); return; }
 
-  if (up == "FID ON")  { jbc_decode::g_log_show_fid = true;  Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] FID=ON"));  return; }
-  if (up == "FID OFF") { jbc_decode::g_log_show_fid = false; Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] FID=OFF")); return; }
+  if (cli_is(clean, PSTR("FID ON")))  { jbc_decode::g_log_show_fid = true;  Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] FID=ON"));  return; }
+  if (cli_is(clean, PSTR("FID OFF"))) { jbc_decode::g_log_show_fid = false; Serial.print(cli_src_prefix()); Serial.println(F(" [DBG] FID=OFF")); return; }
 
-  if (up == "USBCLI ON") {
+  if (cli_is(clean, PSTR("USBCLI ON"))) {
     cfg_set_usbcli(true);
     Serial.print(cli_src_prefix()); Serial.println(F(" [CLI] USB JBC-Senden: ON (persistiert)"));
     return;
   }
-  if (up == "USBCLI OFF") {
+  if (cli_is(clean, PSTR("USBCLI OFF"))) {
     cfg_set_usbcli(false);
     Serial.print(cli_src_prefix()); Serial.println(F(" [CLI] USB JBC-Senden: OFF (persistiert)"));
     return;
   }
 
 
-  if (up == "USBAUTO OFF") {
+  if (cli_is(clean, PSTR("USBAUTO OFF"))) {
     cfg_set_auto_usb_c(false);
     // Noch anstehende Auto-Write-Aktion sauber abbrechen:
     usb_set_due_at = 0;
@@ -1359,7 +3504,7 @@ static void cli_process(const String &line_in){
     Serial.print(cli_src_prefix()); Serial.println(F(" [CFG] USBAUTO=OFF (':C' wird NICHT automatisch gesetzt)"));
     return;
   }
-  if (up == "USBAUTO ON") {
+  if (cli_is(clean, PSTR("USBAUTO ON"))) {
     cfg_set_auto_usb_c(true);
     // Falls bereits Link+FW ok: neuen One-Shot planen
     if (link_up && fw_ok) {
@@ -1369,36 +3514,78 @@ static void cli_process(const String &line_in){
     Serial.print(cli_src_prefix()); Serial.println(F(" [CFG] USBAUTO=ON (':C' wird automatisch gesetzt)"));
     return;
   }
-  if (up == "CONTISEND OFF") {
+  if (cli_is(clean, PSTR("CONTISEND OFF"))) {
     cfg_set_show_conti(false);
     jbc_decode::g_show_conti_send = false;   // Laufzeit-Flag sofort übernehmen
+    sink_interest_update();
     Serial.print(cli_src_prefix()); Serial.println(F(" [CFG] CONTISEND=OFF (Contimode-Zeilen stumm)"));
     return;
   }
-  if (up == "CONTISEND ON") {
+  if (!strncasecmp_P(clean, PSTR("RATE"), 4) && (clean[4] == ' ' || !clean[4])){
+    rate_cli(clean + 4);
+    return;
+  }
+  if (!strncasecmp_P(clean, PSTR("CONTIDELTA"), 10) && (clean[10] == ' ' || !clean[10])){
+    contidelta_cli(clean + 10);
+    return;
+  }
+  if (!strncasecmp_P(clean, PSTR("OUT"), 3) && (clean[3] == ' ' || !clean[3])){
+    out_cli(clean + 3);
+    return;
+  }
+  if (!strncasecmp_P(clean, PSTR("TXBUF"), 5) && (clean[5] == ' ' || !clean[5])){
+    txbuf_cli(clean + 5);
+    return;
+  }
+  if (!strncasecmp_P(clean, PSTR("SHED"), 4) && (clean[4] == ' ' || !clean[4])){
+    shed_cli(clean + 4);
+    return;
+  }
+  if (cli_is(clean, PSTR("PERF FMT"))){
+    perf_fmt();
+    return;
+  }
+  if (cli_is(clean, PSTR("PERF")) || cli_is(clean, PSTR("PERF RESET"))){
+    if (clean[4]) g_perf = Perf();
+    perf_print();
+    return;
+  }
+  if (!strncasecmp_P(clean, PSTR("RPC"), 3) && (clean[3] == ' ' || !clean[3])){
+    rpc_cli(clean + 3);
+    return;
+  }
+  if (cli_is(clean, PSTR("CONTISEND ON"))) {
     cfg_set_show_conti(true);
     jbc_decode::g_show_conti_send = true;
+    sink_interest_update();
     Serial.print(cli_src_prefix()); Serial.println(F(" [CFG] CONTISEND=ON"));
     return;
   }
 
 
   // JBC-Kommandos
-  if (up.startsWith("M_")){
+  if ((clean[0] == 'M' || clean[0] == 'm') && clean[1] == '_'){
     if (g_cli_from_usb && !g_usb_jbc_send_enabled) {
       Serial.print(cli_src_prefix()); Serial.println(F(" [CLI] JBC-Senden über USB ist deaktiviert. (USBCLI ON zum Aktivieren)"));
       return;
     }
-    g_tx_ctx_pending = clean; // Echo mit echter FID
-    if (jbc_cli::handle(clean, g_backend, dst_current(), jbc_send_from_cli)) {
+    if (g_script_rec.active && g_script_rec.from_usb == g_cli_from_usb){ script_rec_line(clean); return; }
+    uint8_t src = g_cli_from_usb ? 0 : 1;
+    if (!rate_take(src)){
+      // Getaggte Anfragen brauchen ihren Abschluss; sonst nur die erste Meldung je Drossel-Phase
+      if (g_cli_tag != CLI_NO_TAG || !g_rate[src].quiet){
+        g_rate[src].quiet = true;
+        Serial.print(cli_src_prefix()); Serial.print(F(" [CLI] gedrosselt ("));
+        Serial.print(g_cfg.rate[src]); Serial.print(F("/s, burst ")); Serial.print(g_cfg.burst[src]);
+        Serial.print(F(") – verworfen: \"")); Serial.print(clean); Serial.println('"');
+      }
       return;
     }
-    g_tx_ctx_pending = ""; // kein Match
+    if (!cli_enqueue(clean)) rate_give(src);   // gesendet wird in cli_dispatch_tick()
+    return;
   }
 
-  Serial.print(cli_src_prefix()); Serial.print(F(" [CLI] Unbekannter Befehl: \""));
-  Serial.print(clean);
-  Serial.println(F("\"  — 'HELP' eingeben."));
+  print_cli_unknown(clean);
 }
 
 
@@ -1408,20 +3595,31 @@ static void cli_process(const String &line_in){
 // Optionales Byte-Logging: 1 = an, 0 = aus
 #define CLI_DEBUG_RX 0
 
-static String cli_buf_usb, cli_buf_s1;
+static CliLine cli_line_usb, cli_line_s1;
 
-static void handle_line_from(bool from_usb, String &buf) {
-  if (!buf.length()) return;
+static void handle_line_from(bool from_usb, CliLine &l) {
+  bool overflow = l.overflow;
+  l.overflow = false;
+  if (!l.len) return;
+  l.buf[l.len] = '\0';
+  l.len = 0;
   g_cli_from_usb = from_usb;
-  #if CLI_DEBUG_RX
-    Serial.print(from_usb ? F("[USB]") : F("[S1]"));
-    Serial.print(F(" [CLI_RX line] \"")); Serial.print(buf); Serial.println('"');
-  #endif
-  cli_process(buf);
-  buf = "";
+  g_cli_tag      = CLI_NO_TAG;
+  cli_ctx_begin();   // Antworten auf lokale Kommandos nur an die fragende Konsole
+  if (overflow) {
+    Serial.print(cli_src_prefix()); Serial.print(F(" [CLI] Zeile zu lang (max "));
+    Serial.print(CLI_LINE_MAX); Serial.println(F(" Zeichen) – verworfen."));
+  } else {
+    #if CLI_DEBUG_RX
+      Serial.print(from_usb ? F("[USB]") : F("[S1]"));
+      Serial.print(F(" [CLI_RX line] \"")); Serial.print(l.buf); Serial.println('"');
+    #endif
+    cli_process(l.buf);
+  }
+  con_reset();
 }
 
-static void feed_from(Stream& port, String &buf, bool from_usb)
+static void feed_from(Stream& port, CliLine &l, bool from_usb)
 {
   while (port.available() > 0) {
     int c = port.read();
@@ -1436,18 +3634,18 @@ static void feed_from(Stream& port, String &buf, bool from_usb)
     #endif
 
     // Backspace / DEL
-    if (c == 0x08 || c == 0x7F) { if (buf.length()) buf.remove(buf.length()-1); continue; }
+    if (c == 0x08 || c == 0x7F) { if (l.len && !l.overflow) l.len--; continue; }
 
     // CR oder LF => Zeile abschließen
-    if (c == '\r' || c == '\n') { handle_line_from(from_usb, buf); continue; }
+    if (c == '\r' || c == '\n') { handle_line_from(from_usb, l); continue; }
 
     // Tab -> Space (optional)
     if (c == '\t') c = ' ';
 
     uint8_t uc = (uint8_t)c;           // wichtig auf AVR: char ist signed
     if (uc >= 32 && uc != 127) {       // alles >= 32 außer DEL erlauben (inkl. ≥128)
-      buf += (char)uc;
-      if (buf.length() > 256) { handle_line_from(from_usb, buf); }
+      if (l.len < CLI_LINE_MAX) l.buf[l.len++] = (char)uc;
+      else                      l.overflow = true;
     }
     // andere Steuerzeichen ignorieren (CR/LF/BS werden oben schon behandelt)
 
@@ -1456,8 +3654,9 @@ static void feed_from(Stream& port, String &buf, bool from_usb)
 
 static void cli_tick_dual()
 {
-  feed_from(USBSER, cli_buf_usb, /*from_usb=*/true);
-  feed_from(AUXSER, cli_buf_s1,  /*from_usb=*/false);
+  feed_from(USBSER, cli_line_usb, /*from_usb=*/true);
+  if (g_s1_rpc) rpc_feed(AUXSER);
+  else          feed_from(AUXSER, cli_line_s1,  /*from_usb=*/false);
 }
 
 
@@ -1490,7 +3689,9 @@ void setup(){
   Serial.print(F("[CFG] USB ':C' auto=")); Serial.println(auto_usb_c ? F("ON") : F("OFF"));
   Serial.print(F("[CFG] CONTIMODE logs=")); Serial.println(show_contisend ? F("ON") : F("OFF"));  // NEU
   Serial.print(F("[CFG] USBCLI=")); Serial.println(g_usb_jbc_send_enabled ? F("ON") : F("OFF"));
+  if (g_s1_rpc) Serial.println(F("[CFG] S1=RPC"));
   jbc_decode::g_show_conti_send = show_contisend;  // NEU: Flag an Decoder durchreichen
+  sink_interest_update();
 
 
 
@@ -1504,6 +3705,7 @@ void setup(){
 
 
 void loop(){
+  con_pump();   // Konsolen-Ausgabe ohne Blockieren weiterschieben
   Usb.Task();
 
   bool attached = (CP.GetAddress()!=0);
@@ -1568,6 +3770,11 @@ void loop(){
   
   
   cli_tick_dual();
+  cli_dispatch_tick();
+  script_tick();
+  sweep_tick();
+  cli_pending_expire(false);
+  shed_tick();
 
   // Silence/Hotplug Watchdog
   link_watchdog_tick();
@@ -0,0 +1,92 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+
+#pragma once
+#include <Arduino.h>
+#include "jbc_bin_schema.h"   // R_* / K_* und Namenstabellen (generiert aus tools/jbc_bin_schema.spec)
+
+// ---- Binär-Telemetrie: ein Datensatz je dekodierter Zeile ----
+// Rahmen: B5 <len> <body: len Bytes> <crc8 über len+body (Poly 0x07)>
+// Body:   <rec varint> <family u8> <ctrl u8> <fid u8> { <key varint> <wert> }*
+//         key = (Feld-ID << 3) | Typ; rec- bzw. Feld-ID 0 = nicht im Schema,
+//         dann folgt der Name als <n u8><n Bytes> direkt dahinter.
+// Varints: 7 Bit je Byte, LSB zuerst (wie protobuf); FIX*: zigzag, ×10 bzw. ×100.
+namespace jbc_bin {
+
+static const uint8_t SYNC    = 0xB5;
+static const uint8_t BODY_MAX = 96;    // längere Datensätze werden verworfen (gezählt)
+
+enum : uint8_t {
+  T_UINT = 0, T_HEX = 1, T_FIX1 = 2, T_FIX2 = 3,
+  T_STR  = 4, T_BYTES = 5, T_NULL = 6
+};
+
+// Schlüssel eines Datensatzes bzw. Felds: Schema-ID (binär) + Name (Text/JSON), an der
+// Aufrufstelle mit REC()/FLD() gebildet – die ID ist eine Konstante, zur Laufzeit wird nichts gesucht.
+struct Key { uint8_t id; const __FlashStringHelper* name; };
+
+struct Rec {
+  uint8_t  buf[BODY_MAX + 3];   // SYNC, len, body, crc
+  uint8_t  n = 0;               // Bytes in buf
+  uint8_t  str_at = 0;          // Längenbyte des offenen Strings
+  bool     over = false;
+  uint32_t sent = 0, dropped = 0;
+};
+static Rec g_rec;
+
+static inline void put(uint8_t b){
+  if (g_rec.n < sizeof(g_rec.buf) - 1) g_rec.buf[g_rec.n++] = b;
+  else g_rec.over = true;
+}
+static void varint(uint32_t v){
+  while (v >= 0x80){ put((uint8_t)(v | 0x80)); v >>= 7; }
+  put((uint8_t)v);
+}
+static inline void zigzag(int32_t v){ varint(((uint32_t)v << 1) ^ (uint32_t)(v >> 31)); }
+static void name(const __FlashStringHelper* n){
+  const char* p = reinterpret_cast<const char*>(n);
+  const uint8_t len = (uint8_t)strlen_P(p);
+  put(len);
+  for (uint8_t i=0; i<len; i++) put(pgm_read_byte(p + i));
+}
+
+static void begin(Key rec, uint8_t family, int ctrl, int fid){
+  g_rec.n = 0; g_rec.over = false;
+  put(SYNC); put(0);                       // Länge kommt in end()
+  varint(rec.id);
+  if (!rec.id) name(rec.name);
+  put(family); put((uint8_t)ctrl); put((uint8_t)fid);
+}
+static void key(Key k, uint8_t type){
+  varint(((uint32_t)k.id << 3) | type);
+  if (!k.id) name(k.name);
+}
+
+// Strings zeichenweise: Länge wird beim Schließen eingetragen
+static inline void str_open(){ g_rec.str_at = g_rec.n; put(0); }
+static inline void str_close(){
+  if (!g_rec.over) g_rec.buf[g_rec.str_at] = (uint8_t)(g_rec.n - g_rec.str_at - 1);
+}
+
+static uint8_t crc8(const uint8_t* p, uint8_t n){
+  uint8_t c = 0;
+  while (n--){
+    c ^= *p++;
+    for (uint8_t b=0; b<8; b++) c = (c & 0x80) ? (uint8_t)((c << 1) ^ 0x07) : (uint8_t)(c << 1);
+  }
+  return c;
+}
+// Datensatz abschließen; liefert die Rahmenlänge (0 = zu lang, verworfen).
+// sent zählt der Aufrufer, sobald der Datensatz wirklich bei einer Konsole ankam.
+static uint8_t end(){
+  if (g_rec.over || g_rec.n - 2 > BODY_MAX){ g_rec.dropped++; return 0; }
+  g_rec.buf[1] = (uint8_t)(g_rec.n - 2);
+  g_rec.buf[g_rec.n] = crc8(g_rec.buf + 1, (uint8_t)(g_rec.n - 1));
+  return (uint8_t)(g_rec.n + 1);
+}
+
+} // namespace jbc_bin
+
+// Schlüssel an der Aufrufstelle: FLD(tip1_c), REC(M_R_SELECTTEMP), REC_AS(PK_FW_HW, "PK/FW/HW")
+#define FLD(n)       (jbc_bin::Key{ jbc_bin::K_##n, F(#n) })
+#define REC(n)       (jbc_bin::Key{ jbc_bin::R_##n, F(#n) })
+#define REC_AS(n, s) (jbc_bin::Key{ jbc_bin::R_##n, F(s) })
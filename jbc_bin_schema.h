@@ -0,0 +1,306 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+// AUTO-GENERATED by tools/gen_jbc_tables.py aus tools/jbc_bin_schema.spec – nicht von Hand editieren.
+
+#pragma once
+#include <Arduino.h>
+
+namespace jbc_bin {
+
+// Datensätze (rec-ID), 0 = nicht im Schema
+enum : uint8_t {
+  R_CONTIMODE_SENDING     = 1,
+  R_CONTIMODE_CHANGES     = 2,
+  R_ACK                   = 3,
+  R_NACK                  = 4,
+  R_PAYLOAD               = 5,
+  R_M_R_USB_CONNECTSTATUS = 6,
+  R_M_R_DISCOVER          = 7,
+  R_M_R_PIN               = 8,
+  R_M_R_REMOTEMODE        = 9,
+  R_M_R_TEMPUNIT          = 10,
+  R_M_R_LANGUAGE          = 11,
+  R_M_R_PINENABLED        = 12,
+  R_M_R_STATIONLOCKED     = 13,
+  R_BEEP                  = 14,
+  R_M_R_BEEP              = 15,
+  R_M_R_TOOLERROR         = 16,
+  R_M_R_RBT_CONNCONFIG    = 17,
+  R_M_R_RBT_CONNECTSTATUS = 18,
+  R_M_R_CONNECTTOOL       = 19,
+  R_M_R_LEVELSTEMPS       = 20,
+  R_M_R_CARTRIDGE         = 21,
+  R_M_R_HIBERDELAY        = 22,
+  R_M_R_SLEEPDELAY        = 23,
+  R_M_R_SLEEPTEMP         = 24,
+  R_M_R_AJUSTTEMP         = 25,
+  R_M_R_TRAFOTEMP         = 26,
+  R_M_R_MOSTEMP           = 27,
+  R_M_R_POWER             = 28,
+  R_M_R_QST_STATUS        = 29,
+  R_M_R_DELAYTIME         = 30,
+  R_M_R_ETH_TCPIPCONFIG   = 31,
+  R_M_R_ETH_CONNECTSTATUS = 32,
+  R_M_R_ALARM_MAXTEMP     = 33,
+  R_M_R_ALARM_MINTEMP     = 34,
+  R_M_R_ALARM_TEMP        = 35,
+  R_M_R_MAXTEMP           = 36,
+  R_M_R_MINTEMP           = 37,
+  R_M_R_POWERLIM          = 38,
+  R_M_R_CONTIMODE         = 39,
+  R_M_R_LOCK_PORT         = 40,
+  R_M_R_QST_ACTIVATE      = 41,
+  R_M_R_TYPEOFGROUND      = 42,
+  R_M_R_STATERROR         = 43,
+  R_M_R_PERIPHCOUNT       = 44,
+  R_M_R_PERIPHCONFIG      = 45,
+  R_M_R_PERIPHSTATUS      = 46,
+  R_M_R_PLUGTIME          = 47,
+  R_M_R_WORKTIME          = 48,
+  R_M_R_SLEEPTIME         = 49,
+  R_M_R_HIBERTIME         = 50,
+  R_M_R_NOTOOLTIME        = 51,
+  R_M_R_SLEEPCYCLES       = 52,
+  R_M_R_DESOLCYCLES       = 53,
+  R_M_R_PLUGTIMEP         = 54,
+  R_M_R_WORKTIMEP         = 55,
+  R_M_R_SLEEPTIMEP        = 56,
+  R_M_R_HIBERTIMEP        = 57,
+  R_M_R_NOTOOLTIMEP       = 58,
+  R_M_R_SLEEPCYCLESP      = 59,
+  R_M_R_DESOLCYCLESP      = 60,
+  R_M_R_WORKCYCLES        = 61,
+  R_M_R_SUCTIONCYCLES     = 62,
+  R_M_R_WORKCYCLESP       = 63,
+  R_M_R_SUCTIONCYCLESP    = 64,
+  R_M_R_AIRFLOW           = 65,
+  R_AIRFLOW               = 66,
+  R_M_R_STARTMODE         = 67,
+  R_M_R_EXTTCMODE         = 68,
+  R_M_R_THEME             = 69,
+  R_M_R_HEATERSTATUS      = 70,
+  R_M_R_SUCTIONSTATUS     = 71,
+  R_M_R_PROFILEMODE       = 72,
+  R_M_R_SELECTFLOW        = 73,
+  R_M_R_SELECTEXTTEMP     = 74,
+  R_M_R_TIMETOSTOP        = 75,
+  R_M_R_MAXMINTEMP        = 76,
+  R_M_R_MAXMINFLOW        = 77,
+  R_M_R_MAXMINEXTTEMP     = 78,
+  R_M_R_DATETIME          = 79,
+  R_M_R_SELECTPOWER       = 80,
+  R_M_R_WARNING           = 81,
+  R_M_R_ACTIVEZONES       = 82,
+  R_M_R_WORKMODE          = 83,
+  R_M_R_FLOW              = 84,
+  R_M_R_SPEED             = 85,
+  R_M_R_SUCTIONLEVEL      = 86,
+  R_M_R_FILTERSTATUS      = 87,
+  R_M_R_CONNECTEDPEDAL    = 88,
+  R_M_R_RESETFILTER       = 89,
+  R_M_R_COUNTERS          = 90,
+  R_PIN                   = 91,
+  R_M_R_ACTIVATIONPEDAL   = 92,
+  R_M_R_PEDALMODE         = 93,
+  R_M_R_INTAKEACTIVATION  = 94,
+  R_M_R_SUCTIONDELAY      = 95,
+  R_M_R_LENGTH            = 96,
+  R_M_R_PROGRAM           = 97,
+  R_M_R_DISPENSERMODE     = 98,
+  R_M_R_BACKWARDMODE      = 99,
+  R_M_R_TOOLENABLED       = 100,
+  R_M_R_LENGTHUNIT        = 101,
+  R_SF_RAW                = 102,
+  R_LEVELSTEMPS_ACK       = 103,
+  R_LOCK_PORT_ACK         = 104,
+  R_M_R_DEVICENAME        = 105,
+  R_M_FIRMWARE            = 106,
+  R_PK_FW_HW              = 107,
+  R_MODEL                 = 108,
+  R_M_R_DEVICEID          = 109,
+  R_M_R_DEVICEIDORIGINAL  = 110,
+  R_M_INF_PORT            = 111,
+  R_M_R_STATUSTOOL        = 112,
+  R_M_R_SELECTTEMP        = 113,
+  R_M_R_TIPTEMP           = 114,
+  R_M_R_CURRENT           = 115,
+  R_M_R_AIRTEMP           = 116,
+  R_M_R_EXTTCTEMP         = 117,
+  R_CONTIMODE_SUMMARY     = 118,
+};
+static const uint8_t REC_COUNT = 118;
+
+// Felder (key = ID << 3 | Typ), 0 = nicht im Schema
+enum : uint8_t {
+  K_seq              = 1,
+  K_port             = 2,
+  K_tip1_c           = 3,
+  K_tip2_c           = 4,
+  K_power_pct        = 5,
+  K_flags            = 6,
+  K_changes          = 7,
+  K_air_c            = 8,
+  K_flow_set_pct     = 9,
+  K_ext_tc_c         = 10,
+  K_flow_act         = 11,
+  K_flow_act_pct     = 12,
+  K_tts              = 13,
+  K_status           = 14,
+  K_mask             = 15,
+  K_text             = 16,
+  K_raw              = 17,
+  K_mode             = 18,
+  K_present          = 19,
+  K_ack              = 20,
+  K_nack             = 21,
+  K_code             = 22,
+  K_pin              = 23,
+  K_on               = 24,
+  K_unit             = 25,
+  K_name             = 26,
+  K_src              = 27,
+  K_speed_code       = 28,
+  K_baud             = 29,
+  K_databits         = 30,
+  K_parity           = 31,
+  K_parity_raw       = 32,
+  K_stopbits         = 33,
+  K_stopbits_raw     = 34,
+  K_addr_enabled     = 35,
+  K_addr_enabled_raw = 36,
+  K_addr             = 37,
+  K_tail             = 38,
+  K_state            = 39,
+  K_state_char       = 40,
+  K_sel              = 41,
+  K_l1_on            = 42,
+  K_l1_c             = 43,
+  K_l1_uti           = 44,
+  K_l2_on            = 45,
+  K_l2_c             = 46,
+  K_l2_uti           = 47,
+  K_l3_on            = 48,
+  K_l3_c             = 49,
+  K_l3_uti           = 50,
+  K_tool             = 51,
+  K_tool_name        = 52,
+  K_nbr              = 53,
+  K_adj300_c         = 54,
+  K_adj400_c         = 55,
+  K_group            = 56,
+  K_family           = 57,
+  K_min              = 58,
+  K_c                = 59,
+  K_uti              = 60,
+  K_delta_c          = 61,
+  K_pct              = 62,
+  K_mmss             = 63,
+  K_sec              = 64,
+  K_tag              = 65,
+  K_next             = 66,
+  K_dhcp             = 67,
+  K_ip               = 68,
+  K_gw               = 69,
+  K_dns              = 70,
+  K_lowbyte_name     = 71,
+  K_count            = 72,
+  K_active           = 73,
+  K_idx              = 74,
+  K_payload          = 75,
+  K_hm               = 76,
+  K_value            = 77,
+  K_ds               = 78,
+  K_max_c            = 79,
+  K_min_c            = 80,
+  K_max_pct          = 81,
+  K_min_pct          = 82,
+  K_iso              = 83,
+  K_year             = 84,
+  K_month            = 85,
+  K_day              = 86,
+  K_hour             = 87,
+  K_sod              = 88,
+  K_connected        = 89,
+  K_ms               = 90,
+  K_tip1_uti         = 91,
+  K_tip2_uti         = 92,
+  K_power_raw        = 93,
+  K_flow_set_raw     = 94,
+  K_flow_raw         = 95,
+  K_result           = 96,
+  K_extra            = 97,
+  K_reason           = 98,
+  K_reason_name      = 99,
+  K_cmd              = 100,
+  K_arg0             = 101,
+  K_proto            = 102,
+  K_sw               = 103,
+  K_hw               = 104,
+  K_type             = 105,
+  K_ver              = 106,
+  K_ports            = 107,
+  K_vid              = 108,
+  K_pid              = 109,
+  K_w0               = 110,
+  K_w1               = 111,
+  K_w2               = 112,
+  K_w3               = 113,
+  K_tool_code        = 114,
+  K_prot_tc_c        = 115,
+  K_flow_pct         = 116,
+  K_temp_c           = 117,
+  K_heater_raw       = 118,
+  K_tool_err         = 119,
+  K_tool_err_name    = 120,
+  K_pwr1_pct         = 121,
+  K_pwr2_pct         = 122,
+  K_len              = 123,
+  K_truncated        = 124,
+  K_string           = 125,
+};
+static const uint8_t FIELD_COUNT = 125;
+
+// Namen in ID-Reihenfolge, nur für OUT SCHEMA (Text/JSON nehmen den Namen der Aufrufstelle)
+static const char REC_NAMES[] PROGMEM =
+  "CONTIMODE_SENDING\0" "CONTIMODE_CHANGES\0" "ACK\0" "NACK\0" "PAYLOAD\0"
+  "M_R_USB_CONNECTSTATUS\0" "M_R_DISCOVER\0" "M_R_PIN\0" "M_R_REMOTEMODE\0" "M_R_TEMPUNIT\0"
+  "M_R_LANGUAGE\0" "M_R_PINENABLED\0" "M_R_STATIONLOCKED\0" "BEEP\0" "M_R_BEEP\0"
+  "M_R_TOOLERROR\0" "M_R_RBT_CONNCONFIG\0" "M_R_RBT_CONNECTSTATUS\0" "M_R_CONNECTTOOL\0"
+  "M_R_LEVELSTEMPS\0" "M_R_CARTRIDGE\0" "M_R_HIBERDELAY\0" "M_R_SLEEPDELAY\0" "M_R_SLEEPTEMP\0"
+  "M_R_AJUSTTEMP\0" "M_R_TRAFOTEMP\0" "M_R_MOSTEMP\0" "M_R_POWER\0" "M_R_QST_STATUS\0"
+  "M_R_DELAYTIME\0" "M_R_ETH_TCPIPCONFIG\0" "M_R_ETH_CONNECTSTATUS\0" "M_R_ALARM_MAXTEMP\0"
+  "M_R_ALARM_MINTEMP\0" "M_R_ALARM_TEMP\0" "M_R_MAXTEMP\0" "M_R_MINTEMP\0" "M_R_POWERLIM\0"
+  "M_R_CONTIMODE\0" "M_R_LOCK_PORT\0" "M_R_QST_ACTIVATE\0" "M_R_TYPEOFGROUND\0" "M_R_STATERROR\0"
+  "M_R_PERIPHCOUNT\0" "M_R_PERIPHCONFIG\0" "M_R_PERIPHSTATUS\0" "M_R_PLUGTIME\0" "M_R_WORKTIME\0"
+  "M_R_SLEEPTIME\0" "M_R_HIBERTIME\0" "M_R_NOTOOLTIME\0" "M_R_SLEEPCYCLES\0" "M_R_DESOLCYCLES\0"
+  "M_R_PLUGTIMEP\0" "M_R_WORKTIMEP\0" "M_R_SLEEPTIMEP\0" "M_R_HIBERTIMEP\0" "M_R_NOTOOLTIMEP\0"
+  "M_R_SLEEPCYCLESP\0" "M_R_DESOLCYCLESP\0" "M_R_WORKCYCLES\0" "M_R_SUCTIONCYCLES\0"
+  "M_R_WORKCYCLESP\0" "M_R_SUCTIONCYCLESP\0" "M_R_AIRFLOW\0" "AIRFLOW\0" "M_R_STARTMODE\0"
+  "M_R_EXTTCMODE\0" "M_R_THEME\0" "M_R_HEATERSTATUS\0" "M_R_SUCTIONSTATUS\0" "M_R_PROFILEMODE\0"
+  "M_R_SELECTFLOW\0" "M_R_SELECTEXTTEMP\0" "M_R_TIMETOSTOP\0" "M_R_MAXMINTEMP\0"
+  "M_R_MAXMINFLOW\0" "M_R_MAXMINEXTTEMP\0" "M_R_DATETIME\0" "M_R_SELECTPOWER\0" "M_R_WARNING\0"
+  "M_R_ACTIVEZONES\0" "M_R_WORKMODE\0" "M_R_FLOW\0" "M_R_SPEED\0" "M_R_SUCTIONLEVEL\0"
+  "M_R_FILTERSTATUS\0" "M_R_CONNECTEDPEDAL\0" "M_R_RESETFILTER\0" "M_R_COUNTERS\0" "PIN\0"
+  "M_R_ACTIVATIONPEDAL\0" "M_R_PEDALMODE\0" "M_R_INTAKEACTIVATION\0" "M_R_SUCTIONDELAY\0"
+  "M_R_LENGTH\0" "M_R_PROGRAM\0" "M_R_DISPENSERMODE\0" "M_R_BACKWARDMODE\0" "M_R_TOOLENABLED\0"
+  "M_R_LENGTHUNIT\0" "SF_RAW\0" "LEVELSTEMPS/ACK\0" "LOCK_PORT/ACK\0" "M_R_DEVICENAME\0"
+  "M_FIRMWARE\0" "PK/FW/HW\0" "MODEL\0" "M_R_DEVICEID\0" "M_R_DEVICEIDORIGINAL\0" "M_INF_PORT\0"
+  "M_R_STATUSTOOL\0" "M_R_SELECTTEMP\0" "M_R_TIPTEMP\0" "M_R_CURRENT\0" "M_R_AIRTEMP\0"
+  "M_R_EXTTCTEMP\0" "CONTIMODE_SUMMARY\0";
+static const char FIELD_NAMES[] PROGMEM =
+  "seq\0" "port\0" "tip1_c\0" "tip2_c\0" "power_pct\0" "flags\0" "changes\0" "air_c\0"
+  "flow_set_pct\0" "ext_tc_c\0" "flow_act\0" "flow_act_pct\0" "tts\0" "status\0" "mask\0"
+  "text\0" "raw\0" "mode\0" "present\0" "ack\0" "nack\0" "code\0" "pin\0" "on\0" "unit\0"
+  "name\0" "src\0" "speed_code\0" "baud\0" "databits\0" "parity\0" "parity_raw\0" "stopbits\0"
+  "stopbits_raw\0" "addr_enabled\0" "addr_enabled_raw\0" "addr\0" "tail\0" "state\0"
+  "state_char\0" "sel\0" "l1_on\0" "l1_c\0" "l1_uti\0" "l2_on\0" "l2_c\0" "l2_uti\0" "l3_on\0"
+  "l3_c\0" "l3_uti\0" "tool\0" "tool_name\0" "nbr\0" "adj300_c\0" "adj400_c\0" "group\0"
+  "family\0" "min\0" "c\0" "uti\0" "delta_c\0" "pct\0" "mmss\0" "sec\0" "tag\0" "next\0" "dhcp\0"
+  "ip\0" "gw\0" "dns\0" "lowbyte_name\0" "count\0" "active\0" "idx\0" "payload\0" "hm\0"
+  "value\0" "ds\0" "max_c\0" "min_c\0" "max_pct\0" "min_pct\0" "iso\0" "year\0" "month\0" "day\0"
+  "hour\0" "sod\0" "connected\0" "ms\0" "tip1_uti\0" "tip2_uti\0" "power_raw\0" "flow_set_raw\0"
+  "flow_raw\0" "result\0" "extra\0" "reason\0" "reason_name\0" "cmd\0" "arg0\0" "proto\0" "sw\0"
+  "hw\0" "type\0" "ver\0" "ports\0" "vid\0" "pid\0" "w0\0" "w1\0" "w2\0" "w3\0" "tool_code\0"
+  "prot_tc_c\0" "flow_pct\0" "temp_c\0" "heater_raw\0" "tool_err\0" "tool_err_name\0"
+  "pwr1_pct\0" "pwr2_pct\0" "len\0" "truncated\0" "string\0";
+
+} // namespace jbc_bin
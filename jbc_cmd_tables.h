@@ -0,0 +1,1462 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+// AUTO-GENERATED by tools/gen_jbc_tables.py aus tools/jbc_commands.spec – nicht von Hand editieren.
+
+#pragma once
+#include <Arduino.h>
+
+namespace jbc_cli {
+
+// -------- Argument-Formate --------
+enum ArgFmt : uint8_t {
+  FMT_NONE = 0,                // keine Payload
+  FMT_PORT,                    // CLI: <port>                     → port:1
+  FMT_PORT_TOOL,               // CLI: <port> <tool>              → port:1 tool:2
+  FMT_U8,                      // CLI: <u8>                       → u8:1
+  FMT_U16,                     // CLI: <u16>                      → u16:1
+  FMT_TEMP,                    // CLI: <°C>                       → temp:1
+  FMT_U16_U16,                 // CLI: <u16> <u16>                → u16:1 u16:2
+  FMT_TEMP_TEMP,               // CLI: <°C> <°C>                  → temp:1 temp:2
+  FMT_STRING,                  // CLI: <Text>                     → str
+  FMT_RAWHEX,                  // CLI: <byte> [byte...]  (0x.. oder dezimal) → raw:1
+  FMT_IPCFG,                   // CLI: <dhcp> <ip> <mask> <gw> [dns] [port] → bool:1 ip:2 ip:3 ip:4 ip:5? u16:6?
+  FMT_W_MASK_INDEX,            // CLI: <index> <mask>             → u8:2 u8:1
+  FMT_W_PORT_U8,               // CLI: <port> <u8>                → u8:2 port:1
+  FMT_W_PORT_U16,              // CLI: <port> <u16>               → u16:2 port:1
+  FMT_W_PORT_TEMP,             // CLI: <port> <°C>                → temp:2 port:1
+  FMT_W_PORT_3TEMP,            // CLI: <port> <t1> <t2> <t3>      → temp:2 temp:3 temp:4 port:1
+  FMT_W_PORT_TOOL_U8,          // CLI: <port> <tool> <u8>         → u8:3 port:1 tool:2
+  FMT_W_PORT_TOOL_U16,         // CLI: <port> <tool> <u16>        → u16:3 port:1 tool:2
+  FMT_W_PORT_TOOL_TEMP,        // CLI: <port> <tool> <°C>         → temp:3 port:1 tool:2
+  FMT_W_PORT_TOOL_3TEMP,       // CLI: <port> <tool> <t1> <t2> <t3> → temp:3 temp:4 temp:5 port:1 tool:2
+  FMT_W_PORT_TOOL_U8_U8,       // CLI: <port> <tool> <value> <onoff> → u8:3 u8:4 port:1 tool:2
+  FMT_W_LEVELSTEMPS_S02,       // CLI: <port> <tool> <onoff> <sel> <l1_on> <l1°C> <l2_on> <l2°C> <l3_on> <l3°C> → u8:3 u8:4 u8:5 temp:6 u8:7 temp:8 u8:9 temp:10 port:1 tool:2
+  FMT_W_PORT_TOOL_TEMPDELTA,   // CLI: <port> <tool> <Δ°C>        → dtemp:3 port:1 tool:2
+  FMT_W_DT6,                   // CLI: yyyy mm dd HH MM SS        → u16:1 u8:2 u8:3 u8:4 u8:5 u8:6
+  FMT_COUNT
+};
+
+} // namespace jbc_cli
+
+namespace jbc_tbl {
+
+// arg-Byte: Bit0-5 ArgFmt, Bit6-7 erwartete Antwort
+static const uint8_t NO_CLI   = 0x3F;   // nicht über die Konsole erreichbar
+static const uint8_t FMT_MASK = 0x3F;
+enum : uint8_t { RP_NONE = 0x00, RP_ACK = 0x40, RP_DATA = 0x80, RP_MASK = 0xC0 };
+
+// Ein Eintrag je Kommando; name = Offset im Namens-Blob
+struct CmdEntry {
+  uint8_t  ctrl;
+  uint8_t  arg;
+  uint16_t name;
+};
+
+// ---- CLI-Argumentprogramme (je ArgFmt, Quelle [FORMATS]) ----
+// Programm: <min. Argumente> <op>... OP_END; op = (Typ << 4) | CLI-Argument (1..11)
+enum : uint8_t {
+  OP_END = 0,
+  OP_U8,
+  OP_BOOL,
+  OP_U16,
+  OP_TEMP,
+  OP_DTEMP,
+  OP_PORT,
+  OP_TOOL,
+  OP_IP,
+  OP_STR,
+  OP_RAW,
+};
+static const uint8_t OP_ARG_MASK = 0x0F;
+
+static const uint8_t FMT_PROG[] PROGMEM = {
+  0x00, 0x00,  // NONE
+  0x01, 0x61, 0x00,  // PORT
+  0x02, 0x61, 0x72, 0x00,  // PORT_TOOL
+  0x01, 0x11, 0x00,  // U8
+  0x01, 0x31, 0x00,  // U16
+  0x01, 0x41, 0x00,  // TEMP
+  0x02, 0x31, 0x32, 0x00,  // U16_U16
+  0x02, 0x41, 0x42, 0x00,  // TEMP_TEMP
+  0x01, 0x90, 0x00,  // STRING
+  0x01, 0xA1, 0x00,  // RAWHEX
+  0x04, 0x21, 0x82, 0x83, 0x84, 0x85, 0x36, 0x00,  // IPCFG
+  0x02, 0x12, 0x11, 0x00,  // W_MASK_INDEX
+  0x02, 0x12, 0x61, 0x00,  // W_PORT_U8
+  0x02, 0x32, 0x61, 0x00,  // W_PORT_U16
+  0x02, 0x42, 0x61, 0x00,  // W_PORT_TEMP
+  0x04, 0x42, 0x43, 0x44, 0x61, 0x00,  // W_PORT_3TEMP
+  0x03, 0x13, 0x61, 0x72, 0x00,  // W_PORT_TOOL_U8
+  0x03, 0x33, 0x61, 0x72, 0x00,  // W_PORT_TOOL_U16
+  0x03, 0x43, 0x61, 0x72, 0x00,  // W_PORT_TOOL_TEMP
+  0x05, 0x43, 0x44, 0x45, 0x61, 0x72, 0x00,  // W_PORT_TOOL_3TEMP
+  0x04, 0x13, 0x14, 0x61, 0x72, 0x00,  // W_PORT_TOOL_U8_U8
+  0x0A, 0x13, 0x14, 0x15, 0x46, 0x17, 0x48, 0x19, 0x4A, 0x61, 0x72, 0x00,  // W_LEVELSTEMPS_S02
+  0x03, 0x53, 0x61, 0x72, 0x00,  // W_PORT_TOOL_TEMPDELTA
+  0x06, 0x31, 0x12, 0x13, 0x14, 0x15, 0x16, 0x00,  // W_DT6
+};
+
+// Text für "[CLI] Erwartet: ..."
+static const char FMT_USAGE[] PROGMEM =
+  "\0"
+  "<port>\0"
+  "<port> <tool>\0"
+  "<u8>\0"
+  "<u16>\0"
+  "<°C>\0"
+  "<u16> <u16>\0"
+  "<°C> <°C>\0"
+  "<Text>\0"
+  "<byte> [byte...]  (0x.. oder dezimal)\0"
+  "<dhcp> <ip> <mask> <gw> [dns] [port]\0"
+  "<index> <mask>\0"
+  "<port> <u8>\0"
+  "<port> <u16>\0"
+  "<port> <°C>\0"
+  "<port> <t1> <t2> <t3>\0"
+  "<port> <tool> <u8>\0"
+  "<port> <tool> <u16>\0"
+  "<port> <tool> <°C>\0"
+  "<port> <tool> <t1> <t2> <t3>\0"
+  "<port> <tool> <value> <onoff>\0"
+  "<port> <tool> <onoff> <sel> <l1_on> <l1°C> <l2_on> <l2°C> <l3_on> <l3°C>\0"
+  "<port> <tool> <Δ°C>\0"
+  "yyyy mm dd HH MM SS\0";
+
+struct FmtInfo {
+  uint8_t  prog;    // Offset in FMT_PROG
+  uint16_t usage;   // Offset in FMT_USAGE
+};
+static const FmtInfo FMT_INFO[jbc_cli::FMT_COUNT] PROGMEM = {
+  {   0,    0 },  // NONE
+  {   2,    1 },  // PORT
+  {   5,    8 },  // PORT_TOOL
+  {   9,   22 },  // U8
+  {  12,   27 },  // U16
+  {  15,   33 },  // TEMP
+  {  18,   39 },  // U16_U16
+  {  22,   51 },  // TEMP_TEMP
+  {  26,   63 },  // STRING
+  {  29,   70 },  // RAWHEX
+  {  32,  108 },  // IPCFG
+  {  40,  145 },  // W_MASK_INDEX
+  {  44,  160 },  // W_PORT_U8
+  {  48,  172 },  // W_PORT_U16
+  {  52,  185 },  // W_PORT_TEMP
+  {  56,  198 },  // W_PORT_3TEMP
+  {  62,  220 },  // W_PORT_TOOL_U8
+  {  67,  239 },  // W_PORT_TOOL_U16
+  {  72,  259 },  // W_PORT_TOOL_TEMP
+  {  77,  279 },  // W_PORT_TOOL_3TEMP
+  {  84,  308 },  // W_PORT_TOOL_U8_U8
+  {  90,  338 },  // W_LEVELSTEMPS_S02
+  { 102,  414 },  // W_PORT_TOOL_TEMPDELTA
+  { 107,  436 },  // W_DT6
+};
+
+struct Family {
+  const char*     prefix;   // "SOLD_02" (einmal je Familie)
+  const char*     names;    // "M_HS\0M_ACK\0..."
+  const CmdEntry* cmds;     // nach ctrl sortiert
+  uint8_t         count;
+};
+
+// ---- BASE (6) ----
+static const char FAM_BASE[] PROGMEM = "BASE";
+static const char NAMES_BASE[] PROGMEM =
+  "M_HS\0"
+  "M_ACK\0"
+  "M_NACK\0"
+  "M_SYN\0"
+  "M_RESET\0"
+  "M_FIRMWARE\0";
+static const CmdEntry CMDS_BASE[] PROGMEM = {
+  {   0, 0x3F,    0 },  // M_HS                     - -
+  {   6, 0x3F,    5 },  // M_ACK                    - -
+  {  21, 0x3F,   11 },  // M_NACK                   - -
+  {  22, 0x3F,   18 },  // M_SYN                    - -
+  {  32, 0x3F,   24 },  // M_RESET                  - -
+  {  33, 0xBF,   32 },  // M_FIRMWARE               - DATA
+};
+
+// ---- SOLD_02 (136) ----
+static const char FAM_SOLD_02[] PROGMEM = "SOLD_02";
+static const char NAMES_SOLD_02[] PROGMEM =
+  "M_HS\0"
+  "M_EOT\0"
+  "M_ACK\0"
+  "M_NACK\0"
+  "M_SYN\0"
+  "M_R_DEVICEIDORIGINAL\0"
+  "M_R_DISCOVER\0"
+  "M_R_DEVICEID\0"
+  "M_W_DEVICEID\0"
+  "M_RESET\0"
+  "M_FIRMWARE\0"
+  "M_CLEARMEMFLASH\0"
+  "M_SENDMEMADDRESS\0"
+  "M_SENDMEMDATA\0"
+  "M_ENDPROGR\0"
+  "M_ENDUPD\0"
+  "M_CONTINUEUPD\0"
+  "M_CLEARING\0"
+  "M_INF_PORT\0"
+  "M_RESET_PORTTOOL\0"
+  "M_R_LEVELSTEMPS\0"
+  "M_W_LEVELSTEMPS\0"
+  "M_R_SLEEPDELAY\0"
+  "M_W_SLEEPDELAY\0"
+  "M_R_SLEEPTEMP\0"
+  "M_W_SLEEPTEMP\0"
+  "M_R_HIBERDELAY\0"
+  "M_W_HIBERDELAY\0"
+  "M_R_AJUSTTEMP\0"
+  "M_W_AJUSTTEMP\0"
+  "M_R_CARTRIDGE\0"
+  "M_W_CARTRIDGE\0"
+  "M_R_SELECTTEMP\0"
+  "M_W_SELECTTEMP\0"
+  "M_R_TIPTEMP\0"
+  "M_R_CURRENT\0"
+  "M_R_POWER\0"
+  "M_R_CONNECTTOOL\0"
+  "M_R_TOOLERROR\0"
+  "M_R_STATUSTOOL\0"
+  "M_W_SELECTTEMPVOLATILE\0"
+  "M_R_MOSTEMP\0"
+  "M_R_DELAYTIME\0"
+  "M_R_REMOTEMODE\0"
+  "M_W_REMOTEMODE\0"
+  "M_R_CONTIMODE\0"
+  "M_W_CONTIMODE\0"
+  "M_I_CONTIMODE\0"
+  "M_R_ALARMMAXTEMP\0"
+  "M_W_ALARMMAXTEMP\0"
+  "M_R_ALARMMINTEMP\0"
+  "M_W_ALARMMINTEMP\0"
+  "M_R_ALARMTEMP\0"
+  "M_R_LOCK_PORT\0"
+  "M_W_LOCK_PORT\0"
+  "M_READSTARTFILE\0"
+  "M_READFILEBLOCK\0"
+  "M_READENDOFFILE\0"
+  "M_WRITESTARTFILE\0"
+  "M_WRITEFILEBLOCK\0"
+  "M_WRITEENDOFFILE\0"
+  "M_R_FILESCOUNT\0"
+  "M_R_GETFILENAME\0"
+  "M_DELETEFILE\0"
+  "M_R_SELECTEDFILENAME\0"
+  "M_W_SELECTEDFILENAME\0"
+  "M_R_QST_ACTIVATE\0"
+  "M_W_QST_ACTIVATE\0"
+  "M_R_QST_STATUS\0"
+  "M_W_QST_STATUS\0"
+  "M_R_TEMPUNIT\0"
+  "M_W_TEMPUNIT\0"
+  "M_R_MAXTEMP\0"
+  "M_W_MAXTEMP\0"
+  "M_R_MINTEMP\0"
+  "M_W_MINTEMP\0"
+  "M_R_POWERLIM\0"
+  "M_W_POWERLIM\0"
+  "M_R_PIN\0"
+  "M_W_PIN\0"
+  "M_R_STATERROR\0"
+  "M_R_TRAFOTEMP\0"
+  "M_RESETSTATION\0"
+  "M_R_DEVICENAME\0"
+  "M_W_DEVICENAME\0"
+  "M_R_BEEP\0"
+  "M_W_BEEP\0"
+  "M_R_LANGUAGE\0"
+  "M_W_LANGUAGE\0"
+  "M_W_TYPEOFGROUND\0"
+  "M_R_TYPEOFGROUND\0"
+  "M_R_PLUGTIME\0"
+  "M_W_PLUGTIME\0"
+  "M_R_WORKTIME\0"
+  "M_W_WORKTIME\0"
+  "M_R_SLEEPTIME\0"
+  "M_W_SLEEPTIME\0"
+  "M_R_HIBERTIME\0"
+  "M_W_HIBERTIME\0"
+  "M_R_NOTOOLTIME\0"
+  "M_W_NOTOOLTIME\0"
+  "M_R_SLEEPCYCLES\0"
+  "M_W_SLEEPCYCLES\0"
+  "M_R_DESOLCYCLES\0"
+  "M_W_DESOLCYCLES\0"
+  "M_W_RESETCOUNTERS\0"
+  "M_R_PLUGTIMEP\0"
+  "M_W_PLUGTIMEP\0"
+  "M_R_WORKTIMEP\0"
+  "M_W_WORKTIMEP\0"
+  "M_R_SLEEPTIMEP\0"
+  "M_W_SLEEPTIMEP\0"
+  "M_R_HIBERTIMEP\0"
+  "M_W_HIBERTIMEP\0"
+  "M_R_NOTOOLTIMEP\0"
+  "M_W_NOTOOLTIMEP\0"
+  "M_R_SLEEPCYCLESP\0"
+  "M_W_SLEEPCYCLESP\0"
+  "M_R_DESOLCYCLESP\0"
+  "M_W_DESOLCYCLESP\0"
+  "M_W_RESETCOUNTERSP\0"
+  "M_R_USB_CONNECTSTATUS\0"
+  "M_W_USB_CONNECTSTATUS\0"
+  "M_R_ETH_TCPIPCONFIG\0"
+  "M_W_ETH_TCPIPCONFIG\0"
+  "M_R_ETH_CONNECTSTATUS\0"
+  "M_W_ETH_CONNECTSTATUS\0"
+  "M_R_RBT_CONNCONFIG\0"
+  "M_W_RBT_CONNCONFIG\0"
+  "M_R_RBT_CONNECTSTATUS\0"
+  "M_W_RBT_CONNECTSTATUS\0"
+  "M_R_PERIPHCOUNT\0"
+  "M_R_PERIPHCONFIG\0"
+  "M_W_PERIPHCONFIG\0"
+  "M_R_PERIPHSTATUS\0"
+  "M_W_PERIPHSTATUS\0";
+static const CmdEntry CMDS_SOLD_02[] PROGMEM = {
+  {   0, 0x3F,    0 },  // M_HS                     - -
+  {   4, 0x3F,    5 },  // M_EOT                    - -
+  {   6, 0x3F,   11 },  // M_ACK                    - -
+  {  21, 0x3F,   17 },  // M_NACK                   - -
+  {  22, 0x3F,   24 },  // M_SYN                    - -
+  {  28, 0x80,   30 },  // M_R_DEVICEIDORIGINAL     NONE DATA
+  {  29, 0x80,   51 },  // M_R_DISCOVER             NONE DATA
+  {  30, 0x80,   64 },  // M_R_DEVICEID             NONE DATA
+  {  31, 0x49,   77 },  // M_W_DEVICEID             RAWHEX ACK
+  {  32, 0x3F,   90 },  // M_RESET                  - -
+  {  33, 0x80,   98 },  // M_FIRMWARE               NONE DATA
+  {  34, 0x3F,  109 },  // M_CLEARMEMFLASH          - -
+  {  35, 0x3F,  125 },  // M_SENDMEMADDRESS         - -
+  {  36, 0x3F,  142 },  // M_SENDMEMDATA            - -
+  {  37, 0x3F,  156 },  // M_ENDPROGR               - -
+  {  38, 0x3F,  167 },  // M_ENDUPD                 - -
+  {  39, 0x3F,  176 },  // M_CONTINUEUPD            - -
+  {  40, 0x3F,  190 },  // M_CLEARING               - -
+  {  48, 0x81,  201 },  // M_INF_PORT               PORT DATA
+  {  49, 0x3F,  212 },  // M_RESET_PORTTOOL         - -
+  {  51, 0x82,  229 },  // M_R_LEVELSTEMPS          PORT_TOOL DATA
+  {  52, 0x55,  245 },  // M_W_LEVELSTEMPS          W_LEVELSTEMPS_S02 ACK
+  {  64, 0x82,  261 },  // M_R_SLEEPDELAY           PORT_TOOL DATA
+  {  65, 0x54,  276 },  // M_W_SLEEPDELAY           W_PORT_TOOL_U8_U8 ACK
+  {  66, 0x82,  291 },  // M_R_SLEEPTEMP            PORT_TOOL DATA
+  {  67, 0x52,  305 },  // M_W_SLEEPTEMP            W_PORT_TOOL_TEMP ACK
+  {  68, 0x82,  319 },  // M_R_HIBERDELAY           PORT_TOOL DATA
+  {  69, 0x54,  334 },  // M_W_HIBERDELAY           W_PORT_TOOL_U8_U8 ACK
+  {  70, 0x82,  349 },  // M_R_AJUSTTEMP            PORT_TOOL DATA
+  {  71, 0x56,  363 },  // M_W_AJUSTTEMP            W_PORT_TOOL_TEMPDELTA ACK
+  {  72, 0x82,  377 },  // M_R_CARTRIDGE            PORT_TOOL DATA
+  {  73, 0x49,  391 },  // M_W_CARTRIDGE            RAWHEX ACK
+  {  80, 0x81,  405 },  // M_R_SELECTTEMP           PORT DATA
+  {  81, 0x4E,  420 },  // M_W_SELECTTEMP           W_PORT_TEMP ACK
+  {  82, 0x81,  435 },  // M_R_TIPTEMP              PORT DATA
+  {  83, 0x81,  447 },  // M_R_CURRENT              PORT DATA
+  {  84, 0x81,  459 },  // M_R_POWER                PORT DATA
+  {  85, 0x81,  469 },  // M_R_CONNECTTOOL          PORT DATA
+  {  86, 0x81,  485 },  // M_R_TOOLERROR            PORT DATA
+  {  87, 0x81,  499 },  // M_R_STATUSTOOL           PORT DATA
+  {  88, 0x4E,  514 },  // M_W_SELECTTEMPVOLATILE   W_PORT_TEMP ACK
+  {  89, 0x81,  537 },  // M_R_MOSTEMP              PORT DATA
+  {  90, 0x81,  549 },  // M_R_DELAYTIME            PORT DATA
+  {  96, 0x80,  563 },  // M_R_REMOTEMODE           NONE DATA
+  {  97, 0x43,  578 },  // M_W_REMOTEMODE           U8 ACK
+  { 128, 0x80,  593 },  // M_R_CONTIMODE            NONE DATA
+  { 129, 0x4B,  607 },  // M_W_CONTIMODE            W_MASK_INDEX ACK
+  { 130, 0x0B,  621 },  // M_I_CONTIMODE            W_MASK_INDEX -
+  { 131, 0x81,  635 },  // M_R_ALARMMAXTEMP         PORT DATA
+  { 132, 0x4E,  652 },  // M_W_ALARMMAXTEMP         W_PORT_TEMP ACK
+  { 133, 0x81,  669 },  // M_R_ALARMMINTEMP         PORT DATA
+  { 134, 0x4E,  686 },  // M_W_ALARMMINTEMP         W_PORT_TEMP ACK
+  { 135, 0x81,  703 },  // M_R_ALARMTEMP            PORT DATA
+  { 136, 0x81,  717 },  // M_R_LOCK_PORT            PORT DATA
+  { 137, 0x4C,  731 },  // M_W_LOCK_PORT            W_PORT_U8 ACK
+  { 144, 0x3F,  745 },  // M_READSTARTFILE          - -
+  { 145, 0x3F,  761 },  // M_READFILEBLOCK          - -
+  { 146, 0x3F,  777 },  // M_READENDOFFILE          - -
+  { 147, 0x3F,  793 },  // M_WRITESTARTFILE         - -
+  { 148, 0x3F,  810 },  // M_WRITEFILEBLOCK         - -
+  { 149, 0x3F,  827 },  // M_WRITEENDOFFILE         - -
+  { 150, 0xBF,  844 },  // M_R_FILESCOUNT           - DATA
+  { 151, 0xBF,  859 },  // M_R_GETFILENAME          - DATA
+  { 152, 0x3F,  875 },  // M_DELETEFILE             - -
+  { 154, 0xBF,  888 },  // M_R_SELECTEDFILENAME     - DATA
+  { 155, 0x3F,  909 },  // M_W_SELECTEDFILENAME     - -
+  { 156, 0x80,  930 },  // M_R_QST_ACTIVATE         NONE DATA
+  { 157, 0x43,  947 },  // M_W_QST_ACTIVATE         U8 ACK
+  { 158, 0x80,  964 },  // M_R_QST_STATUS           NONE DATA
+  { 159, 0x43,  979 },  // M_W_QST_STATUS           U8 ACK
+  { 160, 0x80,  994 },  // M_R_TEMPUNIT             NONE DATA
+  { 161, 0x43, 1007 },  // M_W_TEMPUNIT             U8 ACK
+  { 162, 0x80, 1020 },  // M_R_MAXTEMP              NONE DATA
+  { 163, 0x45, 1032 },  // M_W_MAXTEMP              TEMP ACK
+  { 164, 0x80, 1044 },  // M_R_MINTEMP              NONE DATA
+  { 165, 0x45, 1056 },  // M_W_MINTEMP              TEMP ACK
+  { 170, 0x80, 1068 },  // M_R_POWERLIM             NONE DATA
+  { 171, 0x44, 1081 },  // M_W_POWERLIM             U16 ACK
+  { 172, 0x80, 1094 },  // M_R_PIN                  NONE DATA
+  { 173, 0x48, 1102 },  // M_W_PIN                  STRING ACK
+  { 174, 0x80, 1110 },  // M_R_STATERROR            NONE DATA
+  { 175, 0x80, 1124 },  // M_R_TRAFOTEMP            NONE DATA
+  { 176, 0x3F, 1138 },  // M_RESETSTATION           - -
+  { 177, 0x80, 1153 },  // M_R_DEVICENAME           NONE DATA
+  { 178, 0x48, 1168 },  // M_W_DEVICENAME           STRING ACK
+  { 179, 0x80, 1183 },  // M_R_BEEP                 NONE DATA
+  { 180, 0x43, 1192 },  // M_W_BEEP                 U8 ACK
+  { 181, 0x80, 1201 },  // M_R_LANGUAGE             NONE DATA
+  { 182, 0x43, 1214 },  // M_W_LANGUAGE             U8 ACK
+  { 185, 0x43, 1227 },  // M_W_TYPEOFGROUND         U8 ACK
+  { 186, 0x80, 1244 },  // M_R_TYPEOFGROUND         NONE DATA
+  { 192, 0x81, 1261 },  // M_R_PLUGTIME             PORT DATA
+  { 193, 0x3F, 1274 },  // M_W_PLUGTIME             - -
+  { 194, 0x81, 1287 },  // M_R_WORKTIME             PORT DATA
+  { 195, 0x3F, 1300 },  // M_W_WORKTIME             - -
+  { 196, 0x81, 1313 },  // M_R_SLEEPTIME            PORT DATA
+  { 197, 0x3F, 1327 },  // M_W_SLEEPTIME            - -
+  { 198, 0x81, 1341 },  // M_R_HIBERTIME            PORT DATA
+  { 199, 0x3F, 1355 },  // M_W_HIBERTIME            - -
+  { 200, 0x81, 1369 },  // M_R_NOTOOLTIME           PORT DATA
+  { 201, 0x3F, 1384 },  // M_W_NOTOOLTIME           - -
+  { 202, 0x81, 1399 },  // M_R_SLEEPCYCLES          PORT DATA
+  { 203, 0x3F, 1415 },  // M_W_SLEEPCYCLES          - -
+  { 204, 0x81, 1431 },  // M_R_DESOLCYCLES          PORT DATA
+  { 205, 0x3F, 1447 },  // M_W_DESOLCYCLES          - -
+  { 206, 0x40, 1463 },  // M_W_RESETCOUNTERS        NONE ACK
+  { 208, 0x81, 1481 },  // M_R_PLUGTIMEP            PORT DATA
+  { 209, 0x3F, 1495 },  // M_W_PLUGTIMEP            - -
+  { 210, 0x81, 1509 },  // M_R_WORKTIMEP            PORT DATA
+  { 211, 0x3F, 1523 },  // M_W_WORKTIMEP            - -
+  { 212, 0x81, 1537 },  // M_R_SLEEPTIMEP           PORT DATA
+  { 213, 0x3F, 1552 },  // M_W_SLEEPTIMEP           - -
+  { 214, 0x81, 1567 },  // M_R_HIBERTIMEP           PORT DATA
+  { 215, 0x3F, 1582 },  // M_W_HIBERTIMEP           - -
+  { 216, 0x81, 1597 },  // M_R_NOTOOLTIMEP          PORT DATA
+  { 217, 0x3F, 1613 },  // M_W_NOTOOLTIMEP          - -
+  { 218, 0x81, 1629 },  // M_R_SLEEPCYCLESP         PORT DATA
+  { 219, 0x3F, 1646 },  // M_W_SLEEPCYCLESP         - -
+  { 220, 0x81, 1663 },  // M_R_DESOLCYCLESP         PORT DATA
+  { 221, 0x3F, 1680 },  // M_W_DESOLCYCLESP         - -
+  { 222, 0x3F, 1697 },  // M_W_RESETCOUNTERSP       - -
+  { 224, 0x80, 1716 },  // M_R_USB_CONNECTSTATUS    NONE DATA
+  { 225, 0x48, 1738 },  // M_W_USB_CONNECTSTATUS    STRING ACK
+  { 231, 0x80, 1760 },  // M_R_ETH_TCPIPCONFIG      NONE DATA
+  { 232, 0x4A, 1780 },  // M_W_ETH_TCPIPCONFIG      IPCFG ACK
+  { 233, 0x80, 1800 },  // M_R_ETH_CONNECTSTATUS    NONE DATA
+  { 234, 0x48, 1822 },  // M_W_ETH_CONNECTSTATUS    STRING ACK
+  { 240, 0x80, 1844 },  // M_R_RBT_CONNCONFIG       NONE DATA
+  { 241, 0x3F, 1863 },  // M_W_RBT_CONNCONFIG       - -
+  { 242, 0x80, 1882 },  // M_R_RBT_CONNECTSTATUS    NONE DATA
+  { 243, 0x3F, 1904 },  // M_W_RBT_CONNECTSTATUS    - -
+  { 249, 0x80, 1926 },  // M_R_PERIPHCOUNT          NONE DATA
+  { 250, 0x81, 1942 },  // M_R_PERIPHCONFIG         PORT DATA
+  { 251, 0x49, 1959 },  // M_W_PERIPHCONFIG         RAWHEX ACK
+  { 252, 0x81, 1976 },  // M_R_PERIPHSTATUS         PORT DATA
+  { 253, 0x49, 1993 },  // M_W_PERIPHSTATUS         RAWHEX ACK
+};
+
+// ---- HA_02 (114) ----
+static const char FAM_HA_02[] PROGMEM = "HA_02";
+static const char NAMES_HA_02[] PROGMEM =
+  "M_HS\0"
+  "M_EOT\0"
+  "M_ACK\0"
+  "M_NACK\0"
+  "M_SYN\0"
+  "M_R_DEVICEIDORIGINAL\0"
+  "M_R_DISCOVER\0"
+  "M_R_DEVICEID\0"
+  "M_W_DEVICEID\0"
+  "M_RESET\0"
+  "M_FIRMWARE\0"
+  "M_CLEARMEMFLASH\0"
+  "M_SENDMEMADDRESS\0"
+  "M_SENDMEMDATA\0"
+  "M_ENDPROGR\0"
+  "M_ENDUPD\0"
+  "M_CONTINUEUPD\0"
+  "M_CLEARING\0"
+  "M_FORCEUPDATE\0"
+  "M_INF_PORT\0"
+  "M_RESET_PORTTOOL\0"
+  "M_R_PROFILEMODE\0"
+  "M_W_PROFILEMODE\0"
+  "M_R_HEATERSTATUS\0"
+  "M_W_HEATERSTATUS\0"
+  "M_R_SUCTIONSTATUS\0"
+  "M_W_SUCTIONSTATUS\0"
+  "M_R_EXTTCMODE\0"
+  "M_W_EXTTCMODE\0"
+  "M_R_LEVELSTEMPS\0"
+  "M_W_LEVELSTEMPS\0"
+  "M_R_AJUSTTEMP\0"
+  "M_W_AJUSTTEMP\0"
+  "M_R_TIMETOSTOP\0"
+  "M_W_TIMETOSTOP\0"
+  "M_R_STARTMODE\0"
+  "M_W_STARTMODE\0"
+  "M_R_SELECTTEMP\0"
+  "M_W_SELECTTEMP\0"
+  "M_R_AIRTEMP\0"
+  "M_R_POWER\0"
+  "M_R_CONNECTTOOL\0"
+  "M_R_TOOLERROR\0"
+  "M_R_STATUSTOOL\0"
+  "M_R_SELECTFLOW\0"
+  "M_W_SELECTFLOW\0"
+  "M_R_SELECTEXTTEMP\0"
+  "M_W_SELECTEXTTEMP\0"
+  "M_R_AIRFLOW\0"
+  "M_R_EXTTCTEMP\0"
+  "M_R_REMOTEMODE\0"
+  "M_W_REMOTEMODE\0"
+  "M_R_CONTIMODE\0"
+  "M_W_CONTIMODE\0"
+  "M_I_CONTIMODE\0"
+  "M_READSTARTFILE\0"
+  "M_READFILEBLOCK\0"
+  "M_READENDOFFILE\0"
+  "M_WRITESTARTFILE\0"
+  "M_WRITEFILEBLOCK\0"
+  "M_WRITEENDOFFILE\0"
+  "M_R_FILESCOUNT\0"
+  "M_R_GETFILENAME\0"
+  "M_DELETEFILE\0"
+  "M_R_SELECTEDFILENAME\0"
+  "M_W_SELECTEDFILENAME\0"
+  "M_R_TEMPUNIT\0"
+  "M_W_TEMPUNIT\0"
+  "M_R_MAXMINTEMP\0"
+  "M_W_MAXMINTEMP\0"
+  "M_R_MAXMINFLOW\0"
+  "M_W_MAXMINFLOW\0"
+  "M_R_MAXMINEXTTEMP\0"
+  "M_W_MAXMINEXTTEMP\0"
+  "M_R_PINENABLED\0"
+  "M_W_PINENABLED\0"
+  "M_R_STATIONLOCKED\0"
+  "M_W_STATIONLOCKED\0"
+  "M_R_PIN\0"
+  "M_W_PIN\0"
+  "M_R_STATERROR\0"
+  "M_RESETSTATION\0"
+  "M_R_DEVICENAME\0"
+  "M_W_DEVICENAME\0"
+  "M_R_BEEP\0"
+  "M_W_BEEP\0"
+  "M_R_LANGUAGE\0"
+  "M_W_LANGUAGE\0"
+  "M_R_DATETIME\0"
+  "M_W_DATETIME\0"
+  "M_R_THEME\0"
+  "M_W_THEME\0"
+  "M_R_PLUGTIME\0"
+  "M_W_PLUGTIME\0"
+  "M_R_WORKTIME\0"
+  "M_W_WORKTIME\0"
+  "M_R_WORKCYCLES\0"
+  "M_W_WORKCYCLES\0"
+  "M_R_SUCTIONCYCLES\0"
+  "M_W_SUCTIONCYCLES\0"
+  "M_R_PLUGTIMEP\0"
+  "M_W_PLUGTIMEP\0"
+  "M_R_WORKTIMEP\0"
+  "M_W_WORKTIMEP\0"
+  "M_R_WORKCYCLESP\0"
+  "M_W_WORKCYCLESP\0"
+  "M_R_SUCTIONCYCLESP\0"
+  "M_W_SUCTIONCYCLESP\0"
+  "M_R_USB_CONNECTSTATUS\0"
+  "M_W_USB_CONNECTSTATUS\0"
+  "M_R_RBT_CONNCONFIG\0"
+  "M_W_RBT_CONNCONFIG\0"
+  "M_R_RBT_CONNECTSTATUS\0"
+  "M_W_RBT_CONNECTSTATUS\0";
+static const CmdEntry CMDS_HA_02[] PROGMEM = {
+  {   0, 0x3F,    0 },  // M_HS                     - -
+  {   4, 0x3F,    5 },  // M_EOT                    - -
+  {   6, 0x3F,   11 },  // M_ACK                    - -
+  {  21, 0x3F,   17 },  // M_NACK                   - -
+  {  22, 0x3F,   24 },  // M_SYN                    - -
+  {  28, 0x80,   30 },  // M_R_DEVICEIDORIGINAL     NONE DATA
+  {  29, 0x80,   51 },  // M_R_DISCOVER             NONE DATA
+  {  30, 0x80,   64 },  // M_R_DEVICEID             NONE DATA
+  {  31, 0x48,   77 },  // M_W_DEVICEID             STRING ACK
+  {  32, 0x3F,   90 },  // M_RESET                  - -
+  {  33, 0x80,   98 },  // M_FIRMWARE               NONE DATA
+  {  34, 0x3F,  109 },  // M_CLEARMEMFLASH          - -
+  {  35, 0x3F,  125 },  // M_SENDMEMADDRESS         - -
+  {  36, 0x3F,  142 },  // M_SENDMEMDATA            - -
+  {  37, 0x3F,  156 },  // M_ENDPROGR               - -
+  {  38, 0x3F,  167 },  // M_ENDUPD                 - -
+  {  39, 0x3F,  176 },  // M_CONTINUEUPD            - -
+  {  40, 0x3F,  190 },  // M_CLEARING               - -
+  {  41, 0x3F,  201 },  // M_FORCEUPDATE            - -
+  {  48, 0x81,  215 },  // M_INF_PORT               PORT DATA
+  {  49, 0x3F,  226 },  // M_RESET_PORTTOOL         - -
+  {  51, 0x81,  243 },  // M_R_PROFILEMODE          PORT DATA
+  {  52, 0x4C,  259 },  // M_W_PROFILEMODE          W_PORT_U8 ACK
+  {  53, 0x81,  275 },  // M_R_HEATERSTATUS         PORT DATA
+  {  54, 0x4C,  292 },  // M_W_HEATERSTATUS         W_PORT_U8 ACK
+  {  55, 0x81,  309 },  // M_R_SUCTIONSTATUS        PORT DATA
+  {  56, 0x4C,  327 },  // M_W_SUCTIONSTATUS        W_PORT_U8 ACK
+  {  57, 0x82,  345 },  // M_R_EXTTCMODE            PORT_TOOL DATA
+  {  58, 0x50,  359 },  // M_W_EXTTCMODE            W_PORT_TOOL_U8 ACK
+  {  64, 0x82,  373 },  // M_R_LEVELSTEMPS          PORT_TOOL DATA
+  {  65, 0x4F,  389 },  // M_W_LEVELSTEMPS          W_PORT_3TEMP ACK
+  {  66, 0x82,  405 },  // M_R_AJUSTTEMP            PORT_TOOL DATA
+  {  67, 0x56,  419 },  // M_W_AJUSTTEMP            W_PORT_TOOL_TEMPDELTA ACK
+  {  68, 0x82,  433 },  // M_R_TIMETOSTOP           PORT_TOOL DATA
+  {  69, 0x51,  448 },  // M_W_TIMETOSTOP           W_PORT_TOOL_U16 ACK
+  {  70, 0x82,  463 },  // M_R_STARTMODE            PORT_TOOL DATA
+  {  71, 0x50,  477 },  // M_W_STARTMODE            W_PORT_TOOL_U8 ACK
+  {  80, 0x81,  491 },  // M_R_SELECTTEMP           PORT DATA
+  {  81, 0x4E,  506 },  // M_W_SELECTTEMP           W_PORT_TEMP ACK
+  {  82, 0x81,  521 },  // M_R_AIRTEMP              PORT DATA
+  {  84, 0x81,  533 },  // M_R_POWER                PORT DATA
+  {  85, 0x81,  543 },  // M_R_CONNECTTOOL          PORT DATA
+  {  86, 0x81,  559 },  // M_R_TOOLERROR            PORT DATA
+  {  87, 0x81,  573 },  // M_R_STATUSTOOL           PORT DATA
+  {  89, 0x81,  588 },  // M_R_SELECTFLOW           PORT DATA
+  {  90, 0x4D,  603 },  // M_W_SELECTFLOW           W_PORT_U16 ACK
+  {  91, 0x81,  618 },  // M_R_SELECTEXTTEMP        PORT DATA
+  {  92, 0x4E,  636 },  // M_W_SELECTEXTTEMP        W_PORT_TEMP ACK
+  {  93, 0x81,  654 },  // M_R_AIRFLOW              PORT DATA
+  {  95, 0x81,  666 },  // M_R_EXTTCTEMP            PORT DATA
+  {  96, 0x80,  680 },  // M_R_REMOTEMODE           NONE DATA
+  {  97, 0x43,  695 },  // M_W_REMOTEMODE           U8 ACK
+  { 128, 0x80,  710 },  // M_R_CONTIMODE            NONE DATA
+  { 129, 0x0B,  724 },  // M_W_CONTIMODE            W_MASK_INDEX -
+  { 130, 0x00,  738 },  // M_I_CONTIMODE            NONE -
+  { 144, 0x3F,  752 },  // M_READSTARTFILE          - -
+  { 145, 0x3F,  768 },  // M_READFILEBLOCK          - -
+  { 146, 0x3F,  784 },  // M_READENDOFFILE          - -
+  { 147, 0x3F,  800 },  // M_WRITESTARTFILE         - -
+  { 148, 0x3F,  817 },  // M_WRITEFILEBLOCK         - -
+  { 149, 0x3F,  834 },  // M_WRITEENDOFFILE         - -
+  { 150, 0xBF,  851 },  // M_R_FILESCOUNT           - DATA
+  { 151, 0xBF,  866 },  // M_R_GETFILENAME          - DATA
+  { 152, 0x3F,  882 },  // M_DELETEFILE             - -
+  { 154, 0xBF,  895 },  // M_R_SELECTEDFILENAME     - DATA
+  { 155, 0x3F,  916 },  // M_W_SELECTEDFILENAME     - -
+  { 160, 0x80,  937 },  // M_R_TEMPUNIT             NONE DATA
+  { 161, 0x48,  950 },  // M_W_TEMPUNIT             STRING ACK
+  { 162, 0x80,  963 },  // M_R_MAXMINTEMP           NONE DATA
+  { 163, 0x47,  978 },  // M_W_MAXMINTEMP           TEMP_TEMP ACK
+  { 164, 0x80,  993 },  // M_R_MAXMINFLOW           NONE DATA
+  { 165, 0x46, 1008 },  // M_W_MAXMINFLOW           U16_U16 ACK
+  { 166, 0xBF, 1023 },  // M_R_MAXMINEXTTEMP        - DATA
+  { 167, 0x47, 1041 },  // M_W_MAXMINEXTTEMP        TEMP_TEMP ACK
+  { 168, 0x80, 1059 },  // M_R_PINENABLED           NONE DATA
+  { 169, 0x43, 1074 },  // M_W_PINENABLED           U8 ACK
+  { 170, 0x80, 1089 },  // M_R_STATIONLOCKED        NONE DATA
+  { 171, 0x43, 1107 },  // M_W_STATIONLOCKED        U8 ACK
+  { 172, 0x80, 1125 },  // M_R_PIN                  NONE DATA
+  { 173, 0x48, 1133 },  // M_W_PIN                  STRING ACK
+  { 174, 0x80, 1141 },  // M_R_STATERROR            NONE DATA
+  { 176, 0x3F, 1155 },  // M_RESETSTATION           - -
+  { 177, 0x80, 1170 },  // M_R_DEVICENAME           NONE DATA
+  { 178, 0x48, 1185 },  // M_W_DEVICENAME           STRING ACK
+  { 179, 0x80, 1200 },  // M_R_BEEP                 NONE DATA
+  { 180, 0x43, 1209 },  // M_W_BEEP                 U8 ACK
+  { 181, 0x80, 1218 },  // M_R_LANGUAGE             NONE DATA
+  { 182, 0x43, 1231 },  // M_W_LANGUAGE             U8 ACK
+  { 187, 0x80, 1244 },  // M_R_DATETIME             NONE DATA
+  { 188, 0x57, 1257 },  // M_W_DATETIME             W_DT6 ACK
+  { 190, 0x80, 1270 },  // M_R_THEME                NONE DATA
+  { 191, 0x43, 1280 },  // M_W_THEME                U8 ACK
+  { 192, 0x81, 1290 },  // M_R_PLUGTIME             PORT DATA
+  { 193, 0x3F, 1303 },  // M_W_PLUGTIME             - -
+  { 194, 0x81, 1316 },  // M_R_WORKTIME             PORT DATA
+  { 195, 0x3F, 1329 },  // M_W_WORKTIME             - -
+  { 196, 0x81, 1342 },  // M_R_WORKCYCLES           PORT DATA
+  { 197, 0x3F, 1357 },  // M_W_WORKCYCLES           - -
+  { 198, 0x81, 1372 },  // M_R_SUCTIONCYCLES        PORT DATA
+  { 199, 0x3F, 1390 },  // M_W_SUCTIONCYCLES        - -
+  { 208, 0x81, 1408 },  // M_R_PLUGTIMEP            PORT DATA
+  { 209, 0x3F, 1422 },  // M_W_PLUGTIMEP            - -
+  { 210, 0x81, 1436 },  // M_R_WORKTIMEP            PORT DATA
+  { 211, 0x3F, 1450 },  // M_W_WORKTIMEP            - -
+  { 212, 0x81, 1464 },  // M_R_WORKCYCLESP          PORT DATA
+  { 213, 0x3F, 1480 },  // M_W_WORKCYCLESP          - -
+  { 214, 0x81, 1496 },  // M_R_SUCTIONCYCLESP       PORT DATA
+  { 215, 0x3F, 1515 },  // M_W_SUCTIONCYCLESP       - -
+  { 224, 0x80, 1534 },  // M_R_USB_CONNECTSTATUS    NONE DATA
+  { 225, 0x48, 1556 },  // M_W_USB_CONNECTSTATUS    STRING ACK
+  { 240, 0x80, 1578 },  // M_R_RBT_CONNCONFIG       NONE DATA
+  { 241, 0x3F, 1597 },  // M_W_RBT_CONNCONFIG       - -
+  { 242, 0x80, 1616 },  // M_R_RBT_CONNECTSTATUS    NONE DATA
+  { 243, 0x3F, 1638 },  // M_W_RBT_CONNECTSTATUS    - -
+};
+
+// ---- FE_02 (64) ----
+static const char FAM_FE_02[] PROGMEM = "FE_02";
+static const char NAMES_FE_02[] PROGMEM =
+  "M_HS\0"
+  "M_EOT\0"
+  "M_ACK\0"
+  "M_NACK\0"
+  "M_SYN\0"
+  "M_R_DEVICEIDORIGINAL\0"
+  "M_R_DISCOVER\0"
+  "M_R_DEVICEID\0"
+  "M_W_DEVICEID\0"
+  "M_RESET\0"
+  "M_FIRMWARE\0"
+  "M_CLEARMEMFLASH\0"
+  "M_SENDMEMADDRESS\0"
+  "M_SENDMEMDATA\0"
+  "M_ENDPROGR\0"
+  "M_ENDUPD\0"
+  "M_CONTINUEUPD\0"
+  "M_CLEARING\0"
+  "M_FORCEUPDATE\0"
+  "M_R_SUCTIONLEVEL\0"
+  "M_W_SUCTIONLEVEL\0"
+  "M_R_FLOW\0"
+  "M_R_SPEED\0"
+  "M_R_SELECTFLOW\0"
+  "M_W_SELECTFLOW\0"
+  "M_R_STANDINTAKES\0"
+  "M_W_STANDINTAKES\0"
+  "M_R_INTAKEACTIVATION\0"
+  "M_W_INTAKEACTIVATION\0"
+  "M_R_SUCTIONDELAY\0"
+  "M_W_SUCTIONDELAY\0"
+  "M_R_DELAYTIME\0"
+  "M_R_ACTIVATIONPEDAL\0"
+  "M_W_ACTIVATIONPEDAL\0"
+  "M_R_PEDALMODE\0"
+  "M_W_PEDALMODE\0"
+  "M_R_FILTERSTATUS\0"
+  "M_R_RESETFILTER\0"
+  "M_R_CONNECTEDPEDAL\0"
+  "M_RESETSTATION\0"
+  "M_R_PIN\0"
+  "M_W_PIN\0"
+  "M_R_STATIONLOCKED\0"
+  "M_W_STATIONLOCKED\0"
+  "M_R_BEEP\0"
+  "M_W_BEEP\0"
+  "M_R_CONTINUOUSSUCTION\0"
+  "M_W_CONTINUOUSSUCTION\0"
+  "M_R_STATERROR\0"
+  "M_R_DEVICENAME\0"
+  "M_W_DEVICENAME\0"
+  "M_R_PINENABLED\0"
+  "M_W_PINENABLED\0"
+  "M_W_WORKINTAKES\0"
+  "M_R_COUNTERS\0"
+  "M_R_RESETCOUNTERS\0"
+  "M_R_COUNTERSP\0"
+  "M_R_RESETCOUNTERSP\0"
+  "M_R_USB_CONNECTSTATUS\0"
+  "M_W_USB_CONNECTSTATUS\0"
+  "M_R_RBT_CONNCONFIG\0"
+  "M_W_RBT_CONNCONFIG\0"
+  "M_R_RBT_CONNECTSTATUS\0"
+  "M_W_RBT_CONNECTSTATUS\0";
+static const CmdEntry CMDS_FE_02[] PROGMEM = {
+  {   0, 0x3F,    0 },  // M_HS                     - -
+  {   4, 0x3F,    5 },  // M_EOT                    - -
+  {   6, 0x3F,   11 },  // M_ACK                    - -
+  {  21, 0x3F,   17 },  // M_NACK                   - -
+  {  22, 0x3F,   24 },  // M_SYN                    - -
+  {  28, 0x80,   30 },  // M_R_DEVICEIDORIGINAL     NONE DATA
+  {  29, 0x80,   51 },  // M_R_DISCOVER             NONE DATA
+  {  30, 0x80,   64 },  // M_R_DEVICEID             NONE DATA
+  {  31, 0x49,   77 },  // M_W_DEVICEID             RAWHEX ACK
+  {  32, 0x3F,   90 },  // M_RESET                  - -
+  {  33, 0x80,   98 },  // M_FIRMWARE               NONE DATA
+  {  34, 0x3F,  109 },  // M_CLEARMEMFLASH          - -
+  {  35, 0x3F,  125 },  // M_SENDMEMADDRESS         - -
+  {  36, 0x3F,  142 },  // M_SENDMEMDATA            - -
+  {  37, 0x3F,  156 },  // M_ENDPROGR               - -
+  {  38, 0x3F,  167 },  // M_ENDUPD                 - -
+  {  39, 0x3F,  176 },  // M_CONTINUEUPD            - -
+  {  40, 0x3F,  190 },  // M_CLEARING               - -
+  {  41, 0x3F,  201 },  // M_FORCEUPDATE            - -
+  {  48, 0x80,  215 },  // M_R_SUCTIONLEVEL         NONE DATA
+  {  49, 0x44,  232 },  // M_W_SUCTIONLEVEL         U16 ACK
+  {  50, 0x80,  249 },  // M_R_FLOW                 NONE DATA
+  {  51, 0x80,  258 },  // M_R_SPEED                NONE DATA
+  {  52, 0x80,  268 },  // M_R_SELECTFLOW           NONE DATA
+  {  53, 0x44,  283 },  // M_W_SELECTFLOW           U16 ACK
+  {  54, 0x80,  298 },  // M_R_STANDINTAKES         NONE DATA
+  {  55, 0x43,  315 },  // M_W_STANDINTAKES         U8 ACK
+  {  56, 0x80,  332 },  // M_R_INTAKEACTIVATION     NONE DATA
+  {  57, 0x43,  353 },  // M_W_INTAKEACTIVATION     U8 ACK
+  {  58, 0x80,  374 },  // M_R_SUCTIONDELAY         NONE DATA
+  {  59, 0x44,  391 },  // M_W_SUCTIONDELAY         U16 ACK
+  {  60, 0x80,  408 },  // M_R_DELAYTIME            NONE DATA
+  {  61, 0x80,  422 },  // M_R_ACTIVATIONPEDAL      NONE DATA
+  {  62, 0x43,  442 },  // M_W_ACTIVATIONPEDAL      U8 ACK
+  {  63, 0x80,  462 },  // M_R_PEDALMODE            NONE DATA
+  {  64, 0x43,  476 },  // M_W_PEDALMODE            U8 ACK
+  {  65, 0x80,  490 },  // M_R_FILTERSTATUS         NONE DATA
+  {  66, 0x80,  507 },  // M_R_RESETFILTER          NONE DATA
+  {  68, 0x80,  523 },  // M_R_CONNECTEDPEDAL       NONE DATA
+  {  80, 0x3F,  542 },  // M_RESETSTATION           - -
+  {  81, 0x80,  557 },  // M_R_PIN                  NONE DATA
+  {  82, 0x44,  565 },  // M_W_PIN                  U16 ACK
+  {  83, 0x80,  573 },  // M_R_STATIONLOCKED        NONE DATA
+  {  84, 0x43,  591 },  // M_W_STATIONLOCKED        U8 ACK
+  {  85, 0x80,  609 },  // M_R_BEEP                 NONE DATA
+  {  86, 0x43,  618 },  // M_W_BEEP                 U8 ACK
+  {  87, 0x80,  627 },  // M_R_CONTINUOUSSUCTION    NONE DATA
+  {  88, 0x43,  649 },  // M_W_CONTINUOUSSUCTION    U8 ACK
+  {  89, 0x80,  671 },  // M_R_STATERROR            NONE DATA
+  {  91, 0x80,  685 },  // M_R_DEVICENAME           NONE DATA
+  {  92, 0x48,  700 },  // M_W_DEVICENAME           STRING ACK
+  {  93, 0x80,  715 },  // M_R_PINENABLED           NONE DATA
+  {  94, 0x43,  730 },  // M_W_PINENABLED           U8 ACK
+  {  96, 0x43,  745 },  // M_W_WORKINTAKES          U8 ACK
+  { 192, 0x80,  761 },  // M_R_COUNTERS             NONE DATA
+  { 193, 0x80,  774 },  // M_R_RESETCOUNTERS        NONE DATA
+  { 194, 0xBF,  792 },  // M_R_COUNTERSP            - DATA
+  { 195, 0x80,  806 },  // M_R_RESETCOUNTERSP       NONE DATA
+  { 224, 0x80,  825 },  // M_R_USB_CONNECTSTATUS    NONE DATA
+  { 225, 0x48,  847 },  // M_W_USB_CONNECTSTATUS    STRING ACK
+  { 240, 0xBF,  869 },  // M_R_RBT_CONNCONFIG       - DATA
+  { 241, 0x3F,  888 },  // M_W_RBT_CONNCONFIG       - -
+  { 242, 0xBF,  907 },  // M_R_RBT_CONNECTSTATUS    - DATA
+  { 243, 0x3F,  929 },  // M_W_RBT_CONNECTSTATUS    - -
+};
+
+// ---- PH_02 (81) ----
+static const char FAM_PH_02[] PROGMEM = "PH_02";
+static const char NAMES_PH_02[] PROGMEM =
+  "M_HS\0"
+  "M_EOT\0"
+  "M_ACK\0"
+  "M_NACK\0"
+  "M_SYN\0"
+  "M_R_DEVICEIDORIGINAL\0"
+  "M_R_DISCOVER\0"
+  "M_R_DEVICEID\0"
+  "M_W_DEVICEID\0"
+  "M_RESET\0"
+  "M_FIRMWARE\0"
+  "M_CLEARMEMFLASH\0"
+  "M_SENDMEMADDRESS\0"
+  "M_SENDMEMDATA\0"
+  "M_ENDPROGR\0"
+  "M_ENDUPD\0"
+  "M_CONTINUEUPD\0"
+  "M_CLEARING\0"
+  "M_FORCEUPDATE\0"
+  "M_INF_PORT\0"
+  "M_R_WORKMODE\0"
+  "M_W_WORKMODE\0"
+  "M_R_HEATERSTATUS\0"
+  "M_W_HEATERSTATUS\0"
+  "M_R_EXTTCMODE\0"
+  "M_W_EXTTCMODE\0"
+  "M_R_TIMETOSTOP\0"
+  "M_W_TIMETOSTOP\0"
+  "M_R_SELECTTEMP\0"
+  "M_W_SELECTTEMP\0"
+  "M_R_SELECTPOWER\0"
+  "M_W_SELECTPOWER\0"
+  "M_R_WARNING\0"
+  "M_R_ACTIVEZONES\0"
+  "M_W_ACTIVEZONES\0"
+  "M_R_EXTTCTEMP\0"
+  "M_R_REMOTEMODE\0"
+  "M_W_REMOTEMODE\0"
+  "M_R_CONTIMODE\0"
+  "M_W_CONTIMODE\0"
+  "M_I_CONTIMODE\0"
+  "M_R_PROFILE\0"
+  "M_W_PROFILE\0"
+  "M_R_SETTINGSPROFILE\0"
+  "M_W_SETTINGSPROFILE\0"
+  "M_R_PROFILETEACH\0"
+  "M_W_PROFILETEACH\0"
+  "M_R_MAXMINPOWER\0"
+  "M_W_MAXMINPOWER\0"
+  "M_R_MAXMINTEMP\0"
+  "M_W_MAXMINTEMP\0"
+  "M_R_PINENABLED\0"
+  "M_W_PINENABLED\0"
+  "M_R_STATIONLOCKED\0"
+  "M_W_STATIONLOCKED\0"
+  "M_R_PIN\0"
+  "M_W_PIN\0"
+  "M_R_STATERROR\0"
+  "M_RESETSTATION\0"
+  "M_R_DEVICENAME\0"
+  "M_W_DEVICENAME\0"
+  "M_R_BEEP\0"
+  "M_W_BEEP\0"
+  "M_R_PLUGTIME\0"
+  "M_W_PLUGTIME\0"
+  "M_R_WORKTIME\0"
+  "M_W_WORKTIME\0"
+  "M_R_WORKCYCLES\0"
+  "M_W_WORKCYCLES\0"
+  "M_R_PLUGTIMEP\0"
+  "M_W_PLUGTIMEP\0"
+  "M_R_WORKTIMEP\0"
+  "M_W_WORKTIMEP\0"
+  "M_R_WORKCYCLESP\0"
+  "M_W_WORKCYCLESP\0"
+  "M_R_USB_CONNECTSTATUS\0"
+  "M_W_USB_CONNECTSTATUS\0"
+  "M_R_RBT_CONNCONFIG\0"
+  "M_W_RBT_CONNCONFIG\0"
+  "M_R_RBT_CONNECTSTATUS\0"
+  "M_W_RBT_CONNECTSTATUS\0";
+static const CmdEntry CMDS_PH_02[] PROGMEM = {
+  {   0, 0x3F,    0 },  // M_HS                     - -
+  {   4, 0x3F,    5 },  // M_EOT                    - -
+  {   6, 0x3F,   11 },  // M_ACK                    - -
+  {  21, 0x3F,   17 },  // M_NACK                   - -
+  {  22, 0x3F,   24 },  // M_SYN                    - -
+  {  28, 0x80,   30 },  // M_R_DEVICEIDORIGINAL     NONE DATA
+  {  29, 0x80,   51 },  // M_R_DISCOVER             NONE DATA
+  {  30, 0x80,   64 },  // M_R_DEVICEID             NONE DATA
+  {  31, 0x49,   77 },  // M_W_DEVICEID             RAWHEX ACK
+  {  32, 0x3F,   90 },  // M_RESET                  - -
+  {  33, 0x80,   98 },  // M_FIRMWARE               NONE DATA
+  {  34, 0x3F,  109 },  // M_CLEARMEMFLASH          - -
+  {  35, 0x3F,  125 },  // M_SENDMEMADDRESS         - -
+  {  36, 0x3F,  142 },  // M_SENDMEMDATA            - -
+  {  37, 0x3F,  156 },  // M_ENDPROGR               - -
+  {  38, 0x3F,  167 },  // M_ENDUPD                 - -
+  {  39, 0x3F,  176 },  // M_CONTINUEUPD            - -
+  {  40, 0x3F,  190 },  // M_CLEARING               - -
+  {  41, 0x3F,  201 },  // M_FORCEUPDATE            - -
+  {  48, 0x81,  215 },  // M_INF_PORT               PORT DATA
+  {  51, 0x80,  226 },  // M_R_WORKMODE             NONE DATA
+  {  52, 0x43,  239 },  // M_W_WORKMODE             U8 ACK
+  {  53, 0x80,  252 },  // M_R_HEATERSTATUS         NONE DATA
+  {  54, 0x43,  269 },  // M_W_HEATERSTATUS         U8 ACK
+  {  57, 0x80,  286 },  // M_R_EXTTCMODE            NONE DATA
+  {  58, 0x43,  300 },  // M_W_EXTTCMODE            U8 ACK
+  {  68, 0x81,  314 },  // M_R_TIMETOSTOP           PORT DATA
+  {  69, 0x44,  329 },  // M_W_TIMETOSTOP           U16 ACK
+  {  80, 0x81,  344 },  // M_R_SELECTTEMP           PORT DATA
+  {  81, 0x4E,  359 },  // M_W_SELECTTEMP           W_PORT_TEMP ACK
+  {  82, 0x81,  374 },  // M_R_SELECTPOWER          PORT DATA
+  {  83, 0x4D,  390 },  // M_W_SELECTPOWER          W_PORT_U16 ACK
+  {  88, 0x80,  406 },  // M_R_WARNING              NONE DATA
+  {  91, 0x80,  418 },  // M_R_ACTIVEZONES          NONE DATA
+  {  92, 0x43,  434 },  // M_W_ACTIVEZONES          U8 ACK
+  {  95, 0x80,  450 },  // M_R_EXTTCTEMP            NONE DATA
+  {  96, 0x80,  464 },  // M_R_REMOTEMODE           NONE DATA
+  {  97, 0x43,  479 },  // M_W_REMOTEMODE           U8 ACK
+  { 128, 0x80,  494 },  // M_R_CONTIMODE            NONE DATA
+  { 129, 0x4B,  508 },  // M_W_CONTIMODE            W_MASK_INDEX ACK
+  { 130, 0x00,  522 },  // M_I_CONTIMODE            NONE -
+  { 144, 0x80,  536 },  // M_R_PROFILE              NONE DATA
+  { 145, 0x43,  548 },  // M_W_PROFILE              U8 ACK
+  { 146, 0x80,  560 },  // M_R_SETTINGSPROFILE      NONE DATA
+  { 147, 0x43,  580 },  // M_W_SETTINGSPROFILE      U8 ACK
+  { 148, 0x80,  600 },  // M_R_PROFILETEACH         NONE DATA
+  { 149, 0x43,  617 },  // M_W_PROFILETEACH         U8 ACK
+  { 162, 0x80,  634 },  // M_R_MAXMINPOWER          NONE DATA
+  { 163, 0x46,  650 },  // M_W_MAXMINPOWER          U16_U16 ACK
+  { 166, 0x80,  666 },  // M_R_MAXMINTEMP           NONE DATA
+  { 167, 0x47,  681 },  // M_W_MAXMINTEMP           TEMP_TEMP ACK
+  { 168, 0x80,  696 },  // M_R_PINENABLED           NONE DATA
+  { 169, 0x43,  711 },  // M_W_PINENABLED           U8 ACK
+  { 170, 0x80,  726 },  // M_R_STATIONLOCKED        NONE DATA
+  { 171, 0x43,  744 },  // M_W_STATIONLOCKED        U8 ACK
+  { 172, 0x80,  762 },  // M_R_PIN                  NONE DATA
+  { 173, 0x48,  770 },  // M_W_PIN                  STRING ACK
+  { 174, 0x80,  778 },  // M_R_STATERROR            NONE DATA
+  { 176, 0x3F,  792 },  // M_RESETSTATION           - -
+  { 177, 0x80,  807 },  // M_R_DEVICENAME           NONE DATA
+  { 178, 0x48,  822 },  // M_W_DEVICENAME           STRING ACK
+  { 179, 0x80,  837 },  // M_R_BEEP                 NONE DATA
+  { 180, 0x43,  846 },  // M_W_BEEP                 U8 ACK
+  { 192, 0x81,  855 },  // M_R_PLUGTIME             PORT DATA
+  { 193, 0x3F,  868 },  // M_W_PLUGTIME             - -
+  { 194, 0x81,  881 },  // M_R_WORKTIME             PORT DATA
+  { 195, 0x3F,  894 },  // M_W_WORKTIME             - -
+  { 199, 0x81,  907 },  // M_R_WORKCYCLES           PORT DATA
+  { 200, 0x3F,  922 },  // M_W_WORKCYCLES           - -
+  { 208, 0x81,  937 },  // M_R_PLUGTIMEP            PORT DATA
+  { 209, 0x3F,  951 },  // M_W_PLUGTIMEP            - -
+  { 210, 0x81,  965 },  // M_R_WORKTIMEP            PORT DATA
+  { 211, 0x3F,  979 },  // M_W_WORKTIMEP            - -
+  { 215, 0x81,  993 },  // M_R_WORKCYCLESP          PORT DATA
+  { 216, 0x3F, 1009 },  // M_W_WORKCYCLESP          - -
+  { 224, 0x80, 1025 },  // M_R_USB_CONNECTSTATUS    NONE DATA
+  { 225, 0x48, 1047 },  // M_W_USB_CONNECTSTATUS    STRING ACK
+  { 240, 0xBF, 1069 },  // M_R_RBT_CONNCONFIG       - DATA
+  { 241, 0x3F, 1088 },  // M_W_RBT_CONNCONFIG       - -
+  { 242, 0xBF, 1107 },  // M_R_RBT_CONNECTSTATUS    - DATA
+  { 243, 0x3F, 1129 },  // M_W_RBT_CONNECTSTATUS    - -
+};
+
+// ---- SF_02 (61) ----
+static const char FAM_SF_02[] PROGMEM = "SF_02";
+static const char NAMES_SF_02[] PROGMEM =
+  "M_HS\0"
+  "M_EOT\0"
+  "M_ACK\0"
+  "M_NACK\0"
+  "M_SYN\0"
+  "M_R_DEVICEIDORIGINAL\0"
+  "M_R_DISCOVER\0"
+  "M_R_DEVICEID\0"
+  "M_W_DEVICEID\0"
+  "M_RESET\0"
+  "M_FIRMWARE\0"
+  "M_CLEARMEMFLASH\0"
+  "M_SENDMEMADDRESS\0"
+  "M_SENDMEMDATA\0"
+  "M_ENDPROGR\0"
+  "M_ENDUPD\0"
+  "M_CONTINUEUPD\0"
+  "M_CLEARING\0"
+  "M_FORCEUPDATE\0"
+  "M_R_DISPENSERMODE\0"
+  "M_W_DISPENSERMODE\0"
+  "M_R_PROGRAM\0"
+  "M_W_PROGRAM\0"
+  "M_R_PROGRAMLIST\0"
+  "M_W_PROGRAMLIST\0"
+  "M_R_SPEED\0"
+  "M_W_SPEED\0"
+  "M_R_LENGTH\0"
+  "M_W_LENGTH\0"
+  "M_R_STARTFEEDING\0"
+  "M_R_STOPTFEEDING\0"
+  "M_R_FEEDING\0"
+  "M_R_BACKWARDMODE\0"
+  "M_W_BACKWARDMODE\0"
+  "M_RESETSTATION\0"
+  "M_R_PIN\0"
+  "M_W_PIN\0"
+  "M_R_STATIONLOCKED\0"
+  "M_W_STATIONLOCKED\0"
+  "M_R_BEEP\0"
+  "M_W_BEEP\0"
+  "M_R_LENGTHUNIT\0"
+  "M_W_LENGTHUNIT\0"
+  "M_R_STATERROR\0"
+  "M_R_RESETERROR\0"
+  "M_R_DEVICENAME\0"
+  "M_W_DEVICENAME\0"
+  "M_R_TOOLENABLED\0"
+  "M_W_TOOLENABLED\0"
+  "M_R_PINENABLED\0"
+  "M_W_PINENABLED\0"
+  "M_R_COUNTERS\0"
+  "M_R_RESETCOUNTERS\0"
+  "M_R_COUNTERSP\0"
+  "M_R_RESETCOUNTERSP\0"
+  "M_R_USB_CONNECTSTATUS\0"
+  "M_W_USB_CONNECTSTATUS\0"
+  "M_R_RBT_CONNCONFIG\0"
+  "M_W_RBT_CONNCONFIG\0"
+  "M_R_RBT_CONNECTSTATUS\0"
+  "M_W_RBT_CONNECTSTATUS\0";
+static const CmdEntry CMDS_SF_02[] PROGMEM = {
+  {   0, 0x3F,    0 },  // M_HS                     - -
+  {   4, 0x3F,    5 },  // M_EOT                    - -
+  {   6, 0x3F,   11 },  // M_ACK                    - -
+  {  21, 0x3F,   17 },  // M_NACK                   - -
+  {  22, 0x3F,   24 },  // M_SYN                    - -
+  {  28, 0x80,   30 },  // M_R_DEVICEIDORIGINAL     NONE DATA
+  {  29, 0x80,   51 },  // M_R_DISCOVER             NONE DATA
+  {  30, 0x80,   64 },  // M_R_DEVICEID             NONE DATA
+  {  31, 0x49,   77 },  // M_W_DEVICEID             RAWHEX ACK
+  {  32, 0x3F,   90 },  // M_RESET                  - -
+  {  33, 0x80,   98 },  // M_FIRMWARE               NONE DATA
+  {  34, 0x3F,  109 },  // M_CLEARMEMFLASH          - -
+  {  35, 0x3F,  125 },  // M_SENDMEMADDRESS         - -
+  {  36, 0x3F,  142 },  // M_SENDMEMDATA            - -
+  {  37, 0x3F,  156 },  // M_ENDPROGR               - -
+  {  38, 0x3F,  167 },  // M_ENDUPD                 - -
+  {  39, 0x3F,  176 },  // M_CONTINUEUPD            - -
+  {  40, 0x3F,  190 },  // M_CLEARING               - -
+  {  41, 0x3F,  201 },  // M_FORCEUPDATE            - -
+  {  48, 0x80,  215 },  // M_R_DISPENSERMODE        NONE DATA
+  {  49, 0x43,  233 },  // M_W_DISPENSERMODE        U8 ACK
+  {  50, 0x80,  251 },  // M_R_PROGRAM              NONE DATA
+  {  51, 0x43,  263 },  // M_W_PROGRAM              U8 ACK
+  {  52, 0x80,  275 },  // M_R_PROGRAMLIST          NONE DATA
+  {  53, 0x43,  291 },  // M_W_PROGRAMLIST          U8 ACK
+  {  54, 0x80,  307 },  // M_R_SPEED                NONE DATA
+  {  55, 0x44,  317 },  // M_W_SPEED                U16 ACK
+  {  56, 0x80,  327 },  // M_R_LENGTH               NONE DATA
+  {  57, 0x44,  338 },  // M_W_LENGTH               U16 ACK
+  {  58, 0x80,  349 },  // M_R_STARTFEEDING         NONE DATA
+  {  59, 0x80,  366 },  // M_R_STOPTFEEDING         NONE DATA
+  {  60, 0x80,  383 },  // M_R_FEEDING              NONE DATA
+  {  61, 0x80,  395 },  // M_R_BACKWARDMODE         NONE DATA
+  {  62, 0x43,  412 },  // M_W_BACKWARDMODE         U8 ACK
+  {  80, 0x3F,  429 },  // M_RESETSTATION           - -
+  {  81, 0x80,  444 },  // M_R_PIN                  NONE DATA
+  {  82, 0x44,  452 },  // M_W_PIN                  U16 ACK
+  {  83, 0x80,  460 },  // M_R_STATIONLOCKED        NONE DATA
+  {  84, 0x43,  478 },  // M_W_STATIONLOCKED        U8 ACK
+  {  85, 0x80,  496 },  // M_R_BEEP                 NONE DATA
+  {  86, 0x43,  505 },  // M_W_BEEP                 U8 ACK
+  {  87, 0x80,  514 },  // M_R_LENGTHUNIT           NONE DATA
+  {  88, 0x43,  529 },  // M_W_LENGTHUNIT           U8 ACK
+  {  89, 0x80,  544 },  // M_R_STATERROR            NONE DATA
+  {  90, 0x80,  558 },  // M_R_RESETERROR           NONE DATA
+  {  91, 0x80,  573 },  // M_R_DEVICENAME           NONE DATA
+  {  92, 0x48,  588 },  // M_W_DEVICENAME           STRING ACK
+  {  93, 0x80,  603 },  // M_R_TOOLENABLED          NONE DATA
+  {  94, 0x43,  619 },  // M_W_TOOLENABLED          U8 ACK
+  {  95, 0x80,  635 },  // M_R_PINENABLED           NONE DATA
+  {  96, 0x3F,  650 },  // M_W_PINENABLED           - -
+  { 192, 0x80,  665 },  // M_R_COUNTERS             NONE DATA
+  { 193, 0x80,  678 },  // M_R_RESETCOUNTERS        NONE DATA
+  { 194, 0x80,  696 },  // M_R_COUNTERSP            NONE DATA
+  { 195, 0x80,  710 },  // M_R_RESETCOUNTERSP       NONE DATA
+  { 224, 0x80,  729 },  // M_R_USB_CONNECTSTATUS    NONE DATA
+  { 225, 0x48,  751 },  // M_W_USB_CONNECTSTATUS    STRING ACK
+  { 240, 0xBF,  773 },  // M_R_RBT_CONNCONFIG       - DATA
+  { 241, 0x3F,  792 },  // M_W_RBT_CONNCONFIG       - -
+  { 242, 0xBF,  811 },  // M_R_RBT_CONNECTSTATUS    - DATA
+  { 243, 0x3F,  833 },  // M_W_RBT_CONNECTSTATUS    - -
+};
+
+// ---- SOLD_01 (91) ----
+static const char FAM_SOLD_01[] PROGMEM = "SOLD_01";
+static const char NAMES_SOLD_01[] PROGMEM =
+  "M_NULL\0"
+  "M_EOT\0"
+  "M_ACK\0"
+  "M_NACK\0"
+  "M_SYN\0"
+  "M_R_CONNECTSTATUS\0"
+  "M_W_CONNECTSTATUS\0"
+  "M_RESET\0"
+  "M_FIRMWARE\0"
+  "M_INF_PORT\0"
+  "M_R_FIXTEMP\0"
+  "M_W_FIXTEMP\0"
+  "M_R_LEVELTEMP\0"
+  "M_W_LEVELTEMP\0"
+  "M_R_LEVEL1\0"
+  "M_W_LEVEL1\0"
+  "M_R_LEVEL2\0"
+  "M_W_LEVEL2\0"
+  "M_R_LEVEL3\0"
+  "M_W_LEVEL3\0"
+  "M_R_SLEEPDELAY\0"
+  "M_W_SLEEPDELAY\0"
+  "M_R_SLEEPTEMP\0"
+  "M_W_SLEEPTEMP\0"
+  "M_R_HIBERDELAY\0"
+  "M_W_HIBERDELAY\0"
+  "M_R_AJUSTTEMP\0"
+  "M_W_AJUSTTEMP\0"
+  "M_R_SELECTTEMP\0"
+  "M_W_SELECTTEMP\0"
+  "M_R_TIPTEMP\0"
+  "M_R_CURRENT\0"
+  "M_R_POWER\0"
+  "M_R_CONNECTTOOL\0"
+  "M_R_TOOLERROR\0"
+  "M_R_STATUSTOOL\0"
+  "M_R_MOSTEMP\0"
+  "M_R_DELAYTIME\0"
+  "M_R_REMOTEMODE\0"
+  "M_W_REMOTEMODE\0"
+  "M_R_STATUSREMOTEMODE\0"
+  "M_R_CONTIMODE\0"
+  "M_W_CONTIMODE\0"
+  "M_I_CONTIMODE\0"
+  "M_R_TEMPUNIT\0"
+  "M_W_TEMPUNIT\0"
+  "M_R_MAXTEMP\0"
+  "M_W_MAXTEMP\0"
+  "M_R_MINTEMP\0"
+  "M_W_MINTEMP\0"
+  "M_R_NITROMODE\0"
+  "M_W_NITROMODE\0"
+  "M_R_HELPTEXT\0"
+  "M_W_HELPTEXT\0"
+  "M_R_POWERLIM\0"
+  "M_W_POWERLIM\0"
+  "M_R_PIN\0"
+  "M_W_PIN\0"
+  "M_R_STATERROR\0"
+  "M_R_TRAFOTEMP\0"
+  "M_RESETSTATION\0"
+  "M_R_DEVICENAME\0"
+  "M_W_DEVICENAME\0"
+  "M_R_BEEP\0"
+  "M_W_BEEP\0"
+  "M_R_LANGUAGE\0"
+  "M_W_LANGUAGE\0"
+  "M_R_TEMPERRORTRAFO\0"
+  "M_R_TEMPERRORMOS\0"
+  "M_R_DEVICEID\0"
+  "M_W_DEVICEID\0"
+  "M_R_PLUGTIME\0"
+  "M_W_PLUGTIME\0"
+  "M_R_WORKTIME\0"
+  "M_W_WORKTIME\0"
+  "M_R_SLEEPTIME\0"
+  "M_W_SLEEPTIME\0"
+  "M_R_HIBERTIME\0"
+  "M_W_HIBERTIME\0"
+  "M_R_NOTOOLTIME\0"
+  "M_W_NOTOOLTIME\0"
+  "M_R_SLEEPCYCLES\0"
+  "M_W_SLEEPCYCLES\0"
+  "M_R_DESOLCYCLES\0"
+  "M_W_DESOLCYCLES\0"
+  "M_R_QST_ACTIVATE\0"
+  "M_W_QST_ACTIVATE\0"
+  "M_R_QST_STATUS\0"
+  "M_W_QST_STATUS\0"
+  "M_R_LOCK_PORT\0"
+  "M_W_LOCK_PORT\0";
+static const CmdEntry CMDS_SOLD_01[] PROGMEM = {
+  {   0, 0x3F,    0 },  // M_NULL                   - -
+  {   4, 0x3F,    7 },  // M_EOT                    - -
+  {   6, 0x3F,   13 },  // M_ACK                    - -
+  {  21, 0x3F,   19 },  // M_NACK                   - -
+  {  22, 0x3F,   26 },  // M_SYN                    - -
+  {  30, 0x80,   32 },  // M_R_CONNECTSTATUS        NONE DATA
+  {  31, 0x08,   50 },  // M_W_CONNECTSTATUS        STRING -
+  {  32, 0x3F,   68 },  // M_RESET                  - -
+  {  33, 0x80,   76 },  // M_FIRMWARE               NONE DATA
+  {  48, 0x81,   87 },  // M_INF_PORT               PORT DATA
+  {  49, 0x80,   98 },  // M_R_FIXTEMP              NONE DATA
+  {  50, 0x0E,  110 },  // M_W_FIXTEMP              W_PORT_TEMP -
+  {  51, 0xBF,  122 },  // M_R_LEVELTEMP            - DATA
+  {  52, 0x0E,  136 },  // M_W_LEVELTEMP            W_PORT_TEMP -
+  {  53, 0x81,  150 },  // M_R_LEVEL1               PORT DATA
+  {  54, 0x0E,  161 },  // M_W_LEVEL1               W_PORT_TEMP -
+  {  55, 0x81,  172 },  // M_R_LEVEL2               PORT DATA
+  {  56, 0x0E,  183 },  // M_W_LEVEL2               W_PORT_TEMP -
+  {  57, 0x81,  194 },  // M_R_LEVEL3               PORT DATA
+  {  58, 0x0E,  205 },  // M_W_LEVEL3               W_PORT_TEMP -
+  {  64, 0x81,  216 },  // M_R_SLEEPDELAY           PORT DATA
+  {  65, 0x0D,  231 },  // M_W_SLEEPDELAY           W_PORT_U16 -
+  {  66, 0x81,  246 },  // M_R_SLEEPTEMP            PORT DATA
+  {  67, 0x0E,  260 },  // M_W_SLEEPTEMP            W_PORT_TEMP -
+  {  68, 0x81,  274 },  // M_R_HIBERDELAY           PORT DATA
+  {  69, 0x0D,  289 },  // M_W_HIBERDELAY           W_PORT_U16 -
+  {  70, 0x81,  304 },  // M_R_AJUSTTEMP            PORT DATA
+  {  71, 0x16,  318 },  // M_W_AJUSTTEMP            W_PORT_TOOL_TEMPDELTA -
+  {  80, 0x81,  332 },  // M_R_SELECTTEMP           PORT DATA
+  {  81, 0x0E,  347 },  // M_W_SELECTTEMP           W_PORT_TEMP -
+  {  82, 0x81,  362 },  // M_R_TIPTEMP              PORT DATA
+  {  83, 0x81,  374 },  // M_R_CURRENT              PORT DATA
+  {  84, 0x81,  386 },  // M_R_POWER                PORT DATA
+  {  85, 0x81,  396 },  // M_R_CONNECTTOOL          PORT DATA
+  {  86, 0x81,  412 },  // M_R_TOOLERROR            PORT DATA
+  {  87, 0x81,  426 },  // M_R_STATUSTOOL           PORT DATA
+  {  88, 0x81,  441 },  // M_R_MOSTEMP              PORT DATA
+  {  89, 0x80,  453 },  // M_R_DELAYTIME            NONE DATA
+  {  96, 0x80,  467 },  // M_R_REMOTEMODE           NONE DATA
+  {  97, 0x03,  482 },  // M_W_REMOTEMODE           U8 -
+  {  98, 0x80,  497 },  // M_R_STATUSREMOTEMODE     NONE DATA
+  { 128, 0x80,  518 },  // M_R_CONTIMODE            NONE DATA
+  { 129, 0x0B,  532 },  // M_W_CONTIMODE            W_MASK_INDEX -
+  { 130, 0x00,  546 },  // M_I_CONTIMODE            NONE -
+  { 160, 0x80,  560 },  // M_R_TEMPUNIT             NONE DATA
+  { 161, 0x03,  573 },  // M_W_TEMPUNIT             U8 -
+  { 162, 0x80,  586 },  // M_R_MAXTEMP              NONE DATA
+  { 163, 0x05,  598 },  // M_W_MAXTEMP              TEMP -
+  { 164, 0x80,  610 },  // M_R_MINTEMP              NONE DATA
+  { 165, 0x05,  622 },  // M_W_MINTEMP              TEMP -
+  { 166, 0x80,  634 },  // M_R_NITROMODE            NONE DATA
+  { 167, 0x03,  648 },  // M_W_NITROMODE            U8 -
+  { 168, 0x80,  662 },  // M_R_HELPTEXT             NONE DATA
+  { 169, 0x08,  675 },  // M_W_HELPTEXT             STRING -
+  { 170, 0x80,  688 },  // M_R_POWERLIM             NONE DATA
+  { 171, 0x04,  701 },  // M_W_POWERLIM             U16 -
+  { 172, 0x80,  714 },  // M_R_PIN                  NONE DATA
+  { 173, 0x08,  722 },  // M_W_PIN                  STRING -
+  { 174, 0x80,  730 },  // M_R_STATERROR            NONE DATA
+  { 175, 0x80,  744 },  // M_R_TRAFOTEMP            NONE DATA
+  { 176, 0x3F,  758 },  // M_RESETSTATION           - -
+  { 177, 0x80,  773 },  // M_R_DEVICENAME           NONE DATA
+  { 178, 0x08,  788 },  // M_W_DEVICENAME           STRING -
+  { 179, 0x80,  803 },  // M_R_BEEP                 NONE DATA
+  { 180, 0x03,  812 },  // M_W_BEEP                 U8 -
+  { 181, 0x80,  821 },  // M_R_LANGUAGE             NONE DATA
+  { 182, 0x03,  834 },  // M_W_LANGUAGE             U8 -
+  { 183, 0x80,  847 },  // M_R_TEMPERRORTRAFO       NONE DATA
+  { 184, 0x80,  866 },  // M_R_TEMPERRORMOS         NONE DATA
+  { 185, 0x80,  883 },  // M_R_DEVICEID             NONE DATA
+  { 186, 0x09,  896 },  // M_W_DEVICEID             RAWHEX -
+  { 192, 0x81,  909 },  // M_R_PLUGTIME             PORT DATA
+  { 193, 0x3F,  922 },  // M_W_PLUGTIME             - -
+  { 194, 0x81,  935 },  // M_R_WORKTIME             PORT DATA
+  { 195, 0x3F,  948 },  // M_W_WORKTIME             - -
+  { 196, 0x81,  961 },  // M_R_SLEEPTIME            PORT DATA
+  { 197, 0x3F,  975 },  // M_W_SLEEPTIME            - -
+  { 198, 0x81,  989 },  // M_R_HIBERTIME            PORT DATA
+  { 199, 0x3F, 1003 },  // M_W_HIBERTIME            - -
+  { 200, 0x81, 1017 },  // M_R_NOTOOLTIME           PORT DATA
+  { 201, 0x3F, 1032 },  // M_W_NOTOOLTIME           - -
+  { 202, 0x81, 1047 },  // M_R_SLEEPCYCLES          PORT DATA
+  { 203, 0x3F, 1063 },  // M_W_SLEEPCYCLES          - -
+  { 204, 0x81, 1079 },  // M_R_DESOLCYCLES          PORT DATA
+  { 205, 0x3F, 1095 },  // M_W_DESOLCYCLES          - -
+  { 208, 0x80, 1111 },  // M_R_QST_ACTIVATE         NONE DATA
+  { 209, 0x03, 1128 },  // M_W_QST_ACTIVATE         U8 -
+  { 210, 0x80, 1145 },  // M_R_QST_STATUS           NONE DATA
+  { 211, 0x03, 1160 },  // M_W_QST_STATUS           U8 -
+  { 212, 0x81, 1175 },  // M_R_LOCK_PORT            PORT DATA
+  { 213, 0x0C, 1189 },  // M_W_LOCK_PORT            W_PORT_U8 -
+};
+
+// [Backend] – BK_UNKNOWN nutzt BASE
+static const uint8_t FAMILY_COUNT = 7;
+static const Family FAMILIES[FAMILY_COUNT] PROGMEM = {
+  { FAM_BASE, NAMES_BASE, CMDS_BASE, 6 },  // BK_UNKNOWN
+  { FAM_SOLD_02, NAMES_SOLD_02, CMDS_SOLD_02, 136 },  // BK_SOLD
+  { FAM_HA_02, NAMES_HA_02, CMDS_HA_02, 114 },  // BK_HA
+  { FAM_FE_02, NAMES_FE_02, CMDS_FE_02, 64 },  // BK_FE
+  { FAM_PH_02, NAMES_PH_02, CMDS_PH_02, 81 },  // BK_PH
+  { FAM_SF_02, NAMES_SF_02, CMDS_SF_02, 61 },  // BK_SF
+  { FAM_SOLD_01, NAMES_SOLD_01, CMDS_SOLD_01, 91 },  // BK_SOLD1
+};
+
+// ---- CLI: perfekter Hash Name -> Kommando ----
+// Bucket = cli_hash(name, seed) % nb, Slot = cli_hash(name, disp[Bucket]) % m;
+// Slot = (Familie << 8) | Index in cmds, 0xFFFF = leer. Danach genau ein strcmp_P.
+struct CliHash {
+  const uint8_t*  disp;
+  const uint16_t* slots;
+  uint16_t        seed;
+  uint8_t         nb;
+  uint8_t         m;
+};
+
+// ANY: 205 Namen (Vereinigung, Reihenfolge SOLD_02 > SOLD_01 > HA_02 > PH_02 > FE_02 > SF_02)
+static const uint8_t CLI_DISP_ANY[] PROGMEM = {
+    1,  1,  0,  0,  0,  0,  0,  0,  1, 13, 14,  4,  6,  4,  2, 35,
+    3,  3, 19,  6,  0,  0,  6,  3, 19, 20,  0,  1,  4,  6,  1,  0,
+    3, 34,  1,  0,  2, 12, 33,  0,  6,  0,  3,  2,  0, 91,  2, 18,
+   12, 37,  5, 37,  2,  4,  0,  0,  7,  0,  8, 13, 58,  0,  2, 48,
+    4,  2,  0, 14, 19,
+};
+static const uint16_t CLI_SLOT_ANY[] PROGMEM = {
+  0x0107,0x0154,0xFFFF,0xFFFF,0x0643,0x0231,0x0227,0x032E,0x0517,0x0151,0x011D,0x012A,
+  0x011A,0x011C,0x015A,0x0145,0x0155,0xFFFF,0x0529,0x0246,0x0119,0x017F,0x0142,0x026A,
+  0x0414,0x0115,0x012F,0x042F,0x021B,0x060D,0x0106,0x014C,0x0136,0xFFFF,0x025B,0x0112,
+  0x0122,0x022F,0x012B,0x0127,0x0131,0x0135,0x0130,0x025A,0x0224,0xFFFF,0x0116,0x022D,
+  0x014F,0x060E,0x0633,0xFFFF,0x0628,0x0521,0x0167,0x0216,0x0635,0x0634,0x051B,0x021A,
+  0x0186,0x0146,0xFFFF,0x0430,0xFFFF,0x0217,0x015B,0x0611,0x011B,0x031D,0x0215,0x0247,
+  0x052A,0x042C,0x0244,0x0319,0x0223,0x0169,0x0420,0x060A,0x017E,0x016E,0x060F,0x0158,
+  0x0260,0x0149,0x0161,0x042D,0x052C,0x0515,0x042E,0x0184,0x0172,0x0134,0x0245,0x0323,
+  0x0316,0x0185,0xFFFF,0x015D,0x031E,0x016A,0x0174,0x0325,0x0118,0x0513,0x0429,0x0179,
+  0xFFFF,0x024D,0xFFFF,0x0313,0x016C,0x0126,0x0613,0xFFFF,0x041F,0x0518,0x0258,0x0262,
+  0x012D,0x014D,0x017B,0x0157,0x014A,0xFFFF,0xFFFF,0x0230,0x0314,0x042A,0x0156,0x0632,
+  0xFFFF,0x042B,0xFFFF,0xFFFF,0x017D,0xFFFF,0x031A,0x060B,0x0133,0x0610,0x0163,0x032F,
+  0x024B,0x0268,0x0183,0x0132,0x0148,0x0535,0x0336,0x024A,0x0516,0x0176,0x0153,0x0514,
+  0x051A,0x052F,0x0221,0x011E,0x0147,0x0219,0x0422,0x0530,0x0218,0x0165,0xFFFF,0x051C,
+  0x011F,0x0159,0x0321,0x0339,0x0150,0xFFFF,0xFFFF,0xFFFF,0x014B,0x051F,0x0108,0x0421,
+  0x031B,0x0415,0x0259,0x0520,0x0125,0x0320,0x022C,0x0124,0x0105,0x012C,0x0315,0x015F,
+  0x041E,0x051E,0x0249,0xFFFF,0x022E,0x0129,0x0337,0x012E,0x0605,0x0181,0x021C,0x051D,
+  0x0114,0x0322,0x0117,0xFFFF,0x017A,0x031C,0x0120,0x010A,0x0222,0x0326,0x0187,0x0144,
+  0xFFFF,0x0335,0x014E,0x0170,0x0324,0x0128,0x0123,0x0644,0x024C,0xFFFF,0x0606,0x0143,
+  0x0121,0x0612,0x017C,
+};
+
+// SOLD_02: 93 Namen
+static const uint8_t CLI_DISP_SOLD_02[] PROGMEM = {
+    3,  1,  0,  2,  0,  2,  0,  0, 28,  0,  2,  0, 13,  2,  5,  1,
+    9,  3,  1,  5, 22, 33,  6,  0, 21,  0, 10,  0,  5, 53, 32,
+};
+static const uint16_t CLI_SLOT_SOLD_02[] PROGMEM = {
+  0x0170,0x0148,0x0184,0xFFFF,0x0155,0x016E,0x0150,0x0153,0xFFFF,0x0106,0x0156,0x0128,
+  0x0163,0x0122,0x0131,0x012D,0x0114,0x0117,0x0108,0x012A,0x0124,0x0186,0xFFFF,0x014E,
+  0x017B,0x0151,0x0176,0x011E,0x0169,0x017E,0x0159,0xFFFF,0x015B,0x011D,0x011C,0x0154,
+  0x014A,0xFFFF,0x0181,0x0174,0x014B,0x0185,0x0172,0x012B,0x0147,0xFFFF,0x015D,0x015A,
+  0xFFFF,0x0142,0x011B,0xFFFF,0x017D,0x0127,0x0158,0x017A,0x010A,0x015F,0x016C,0xFFFF,
+  0x0143,0x0136,0x011A,0xFFFF,0xFFFF,0x012C,0x016A,0x0145,0x012F,0x0126,0x0179,0x0134,
+  0x0115,0x0187,0x014F,0xFFFF,0x0119,0x017F,0x014D,0x0125,0x0105,0x0129,0x014C,0x0118,
+  0x0157,0x0133,0x0161,0x0165,0x0144,0x011F,0x0121,0x0146,0x0112,0x017C,0x0132,0x0167,
+  0x0183,0x0149,0x0123,0x012E,0x0130,0x0120,0x0135,0x0116,0x0107,
+};
+
+// HA_02: 76 Namen
+static const uint8_t CLI_DISP_HA_02[] PROGMEM = {
+    0, 13,  1,  0,  0,  0, 14,  0,  2,  2, 19,  3,  0,  2,  6, 17,
+   34, 14,  1, 18,  4,  2, 16,  3, 53,  6,
+};
+static const uint16_t CLI_SLOT_HA_02[] PROGMEM = {
+  0x026C,0x0235,0x022A,0x022C,0x021E,0x0232,0x022B,0x0250,0x0259,0x0224,0x0205,0x024C,
+  0x0246,0x0257,0x0208,0xFFFF,0x021F,0x0245,0x024B,0x025A,0x021C,0x0213,0x0262,0x0233,
+  0x026D,0x025C,0x0229,0x0230,0x024F,0x0254,0x025E,0xFFFF,0x0266,0xFFFF,0xFFFF,0x022D,
+  0x0252,0xFFFF,0x0236,0x0217,0x025B,0x0249,0x021B,0xFFFF,0x0270,0x0221,0x024E,0x022E,
+  0x0219,0x0215,0x024A,0x021D,0x0244,0x0258,0xFFFF,0x0226,0x0242,0x0222,0x022F,0x0220,
+  0x0234,0x0207,0x0268,0x0228,0x0256,0x0253,0x0206,0xFFFF,0x026E,0x0255,0x024D,0x0223,
+  0x0218,0x026A,0x0247,0x0225,0x0243,0x020A,0x0216,0x0264,0xFFFF,0x0227,0x0231,0x021A,
+  0xFFFF,0x0260,
+};
+
+// FE_02: 44 Namen
+static const uint8_t CLI_DISP_FE_02[] PROGMEM = {
+   10,  4,  4,  2,  1,  2,  4, 25,  8,  1, 10,  4, 39,  1,  5,
+};
+static const uint16_t CLI_SLOT_FE_02[] PROGMEM = {
+  0x031C,0x0306,0x0307,0x0328,0x0308,0x0330,0x0336,0x0339,0x032F,0x0335,0x032D,0x031B,
+  0xFFFF,0x0323,0x0321,0x0318,0xFFFF,0x0333,0x030A,0x032A,0x0332,0x0315,0x031D,0x031A,
+  0xFFFF,0x0324,0x033B,0x032E,0x0322,0x0329,0x0314,0xFFFF,0x0337,0x033A,0x031E,0x0331,
+  0xFFFF,0xFFFF,0x0319,0x0320,0x0317,0x0313,0x0326,0x0305,0x0316,0x031F,0x032B,0x032C,
+  0x0325,0x0334,
+};
+
+// PH_02: 56 Namen
+static const uint8_t CLI_DISP_PH_02[] PROGMEM = {
+   10,  0,  3,  4,  0,  0,  6,  4,  3,  3, 17,  4, 11,  0,  0,  4,
+    3, 30,  1,
+};
+static const uint16_t CLI_SLOT_PH_02[] PROGMEM = {
+  0x0407,0x042E,0x0425,0x0430,0xFFFF,0x0424,0x041A,0x042B,0x0438,0x0416,0x041E,0x0408,
+  0x0423,0x0405,0x0419,0x0426,0x0434,0x0417,0x0447,0x0406,0xFFFF,0x0435,0x0413,0x041C,
+  0x0443,0x0431,0x042D,0x0439,0x0429,0x040A,0x043D,0x043C,0xFFFF,0x0445,0x044C,0x0418,
+  0x0437,0x044B,0x0449,0x041D,0x041B,0x0420,0xFFFF,0x042C,0x042A,0x043F,0x0441,0xFFFF,
+  0x0415,0x0436,0x0414,0x0422,0x042F,0x0428,0x0427,0x043E,0x0421,0x0432,0x041F,0xFFFF,
+  0x0433,0x043B,0xFFFF,
+};
+
+// SF_02: 41 Namen
+static const uint8_t CLI_DISP_SF_02[] PROGMEM = {
+    2,  1,  4,  8,  0,  0,  0, 19,  3, 10, 40,  0,  6, 12,
+};
+static const uint16_t CLI_SLOT_SF_02[] PROGMEM = {
+  0x0516,0x0529,0x0538,0xFFFF,0xFFFF,0x0528,0x0521,0x052D,0x0535,0x052A,0x052B,0x0506,
+  0x0523,0x0525,0x0533,0x0513,0x052C,0x051B,0xFFFF,0x051E,0xFFFF,0x0537,0x051F,0x051C,
+  0xFFFF,0x0519,0x0534,0x052F,0x0527,0x0507,0x0531,0x0508,0x0524,0x051D,0x052E,0x051A,
+  0x0530,0x0520,0x0518,0x0517,0x0536,0x0526,0x0514,0xFFFF,0x0505,0x050A,0x0515,
+};
+
+// SOLD_01: 76 Namen
+static const uint8_t CLI_DISP_SOLD_01[] PROGMEM = {
+   20,  0,  4,  6, 15,  0,  3,  0, 65,  0,  3,  6,  1, 30,  0,  0,
+    6,  5,  5, 16, 28, 16,  0,  1,  8, 15,
+};
+static const uint16_t CLI_SLOT_SOLD_01[] PROGMEM = {
+  0x0644,0x0655,0x060A,0x0651,0x0622,0x0608,0x065A,0x0630,0x0643,0x0606,0x0623,0x0636,
+  0x0625,0x0637,0x061E,0x063D,0x0641,0x0632,0x062F,0x064B,0x063A,0x0609,0x0657,0x0627,
+  0x0624,0x062B,0x0638,0x0653,0x060B,0x0659,0x062A,0x0633,0x064D,0x0656,0x0640,0x060F,
+  0x0646,0x0639,0x061F,0x0645,0x0615,0x0610,0xFFFF,0x0626,0xFFFF,0x0628,0xFFFF,0x0620,
+  0x0629,0x062E,0x063B,0x0616,0x0658,0x064F,0x0618,0xFFFF,0x0612,0x0621,0x063E,0x0635,
+  0xFFFF,0x0617,0x061B,0x0611,0x060D,0xFFFF,0xFFFF,0x0649,0xFFFF,0x0647,0x0619,0x0605,
+  0x061A,0x0642,0xFFFF,0x061C,0x061D,0x062D,0xFFFF,0x060E,0x062C,0x0634,0x0614,0x0613,
+  0x063F,0x0631,
+};
+
+// [Backend] – BK_UNKNOWN: Vereinigung aller Familien
+static const CliHash CLI_HASH[FAMILY_COUNT] PROGMEM = {
+  { CLI_DISP_ANY, CLI_SLOT_ANY, 0x0100, 69, 231 },  // BK_UNKNOWN
+  { CLI_DISP_SOLD_02, CLI_SLOT_SOLD_02, 0x0100, 31, 105 },  // BK_SOLD
+  { CLI_DISP_HA_02, CLI_SLOT_HA_02, 0x0100, 26, 86 },  // BK_HA
+  { CLI_DISP_FE_02, CLI_SLOT_FE_02, 0x0100, 15, 50 },  // BK_FE
+  { CLI_DISP_PH_02, CLI_SLOT_PH_02, 0x0100, 19, 63 },  // BK_PH
+  { CLI_DISP_SF_02, CLI_SLOT_SF_02, 0x0100, 14, 47 },  // BK_SF
+  { CLI_DISP_SOLD_01, CLI_SLOT_SOLD_01, 0x0100, 26, 86 },  // BK_SOLD1
+};
+
+} // namespace jbc_tbl
@@ -1,4 +1,5 @@
 // SPDX-License-Identifier: MIT OR GPL-2.0-only
+// AUTO-GENERATED by tools/gen_jbc_tables.py aus tools/jbc_commands.spec – nicht von Hand editieren.
 
 #pragma once
 
@@ -0,0 +1,160 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+// AUTO-GENERATED by tools/gen_jbc_tables.py aus tools/jbc_commands.spec – nicht von Hand editieren.
+
+#pragma once
+#include <Arduino.h>
+#include "jbc_cmd_names.h"   // Backend
+
+namespace jbc_meta {
+
+// Ctrl-Flags (1 Byte je Ctrl und Backend)
+enum : uint8_t {
+  CM_READ       = 0x01,   // M_R_* / M_INF_PORT
+  CM_WRITE      = 0x02,   // M_W_* / M_I_*
+  CM_SYN        = 0x04,   // M_SYN
+  CM_ACK        = 0x08,   // M_ACK
+  CM_NACK       = 0x10,   // M_NACK
+  CM_PORT       = 0x20,   // Payload trägt Port
+  CM_EXPECT_ACK = 0x40,   // Write, Antwort 0x06.. = ACK
+  CM_USB_STATUS = 0x80,   // M_R_/M_W_USB_CONNECTSTATUS
+};
+
+// [Backend][ctrl] – Zeilen à 16 Ctrls
+static const uint8_t CTRL_META[7][256] PROGMEM = {
+  { // BK_UNKNOWN (BASE)
+    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //   0
+    0x00,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  16
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  32
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  48
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  64
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  80
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  96
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 112
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 128
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 144
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 160
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 176
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 192
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 208
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 224
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 240
+  },
+  { // BK_SOLD (SOLD_02)
+    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //   0
+    0x00,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x42,  //  16
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  32
+    0x21,0x00,0x00,0x21,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  48
+    0x21,0x62,0x21,0x62,0x21,0x62,0x21,0x62,0x21,0x42,0x00,0x00,0x00,0x00,0x00,0x00,  //  64
+    0x21,0x62,0x21,0x21,0x21,0x21,0x21,0x21,0x62,0x21,0x21,0x00,0x00,0x00,0x00,0x00,  //  80
+    0x01,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  96
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 112
+    0x01,0x42,0x02,0x21,0x62,0x21,0x62,0x21,0x21,0x62,0x00,0x00,0x00,0x00,0x00,0x00,  // 128
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x01,0x02,0x01,0x42,0x01,0x42,  // 144
+    0x01,0x42,0x01,0x42,0x01,0x42,0x00,0x00,0x00,0x00,0x01,0x42,0x01,0x42,0x01,0x01,  // 160
+    0x00,0x01,0x42,0x01,0x42,0x01,0x42,0x00,0x00,0x42,0x01,0x00,0x00,0x00,0x00,0x00,  // 176
+    0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x42,0x00,  // 192
+    0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x02,0x00,  // 208
+    0x81,0xC2,0x00,0x00,0x00,0x00,0x00,0x01,0x42,0x01,0x42,0x00,0x00,0x00,0x00,0x00,  // 224
+    0x01,0x02,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x01,0x21,0x42,0x21,0x42,0x00,0x00,  // 240
+  },
+  { // BK_HA (HA_02)
+    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //   0
+    0x00,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x42,  //  16
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  32
+    0x21,0x00,0x00,0x21,0x62,0x21,0x62,0x21,0x62,0x21,0x62,0x00,0x00,0x00,0x00,0x00,  //  48
+    0x21,0x62,0x21,0x62,0x21,0x62,0x21,0x62,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  64
+    0x21,0x62,0x21,0x00,0x21,0x21,0x21,0x21,0x00,0x21,0x62,0x21,0x62,0x21,0x00,0x21,  //  80
+    0x01,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  96
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 112
+    0x01,0x02,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 128
+    0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x00,0x00,0x01,0x02,0x00,0x00,0x00,0x00,  // 144
+    0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x00,  // 160
+    0x00,0x01,0x42,0x01,0x42,0x01,0x42,0x00,0x00,0x00,0x00,0x01,0x42,0x00,0x01,0x42,  // 176
+    0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 192
+    0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 208
+    0x81,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 224
+    0x01,0x02,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 240
+  },
+  { // BK_FE (FE_02)
+    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //   0
+    0x00,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x42,  //  16
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  32
+    0x01,0x42,0x01,0x01,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x01,0x42,0x01,  //  48
+    0x42,0x01,0x01,0x00,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  64
+    0x00,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x00,0x01,0x42,0x01,0x42,0x00,  //  80
+    0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  96
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 112
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 128
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 144
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 160
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 176
+    0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 192
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 208
+    0x81,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 224
+    0x01,0x02,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 240
+  },
+  { // BK_PH (PH_02)
+    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //   0
+    0x00,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x42,  //  16
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  32
+    0x21,0x00,0x00,0x01,0x42,0x01,0x42,0x00,0x00,0x01,0x42,0x00,0x00,0x00,0x00,0x00,  //  48
+    0x00,0x00,0x00,0x00,0x21,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  64
+    0x21,0x62,0x21,0x62,0x00,0x00,0x00,0x00,0x01,0x00,0x00,0x01,0x42,0x00,0x00,0x01,  //  80
+    0x01,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  96
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 112
+    0x01,0x42,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 128
+    0x01,0x42,0x01,0x42,0x01,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 144
+    0x00,0x00,0x01,0x42,0x00,0x00,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x00,  // 160
+    0x00,0x01,0x42,0x01,0x42,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 176
+    0x21,0x02,0x21,0x02,0x00,0x00,0x00,0x21,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 192
+    0x21,0x02,0x21,0x02,0x00,0x00,0x00,0x21,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 208
+    0x81,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 224
+    0x01,0x02,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 240
+  },
+  { // BK_SF (SF_02)
+    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //   0
+    0x00,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x01,0x01,0x01,0x42,  //  16
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  32
+    0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x01,0x01,0x01,0x42,0x00,  //  48
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  64
+    0x00,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x42,0x01,0x01,0x01,0x42,0x01,0x42,0x01,  //  80
+    0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  96
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 112
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 128
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 144
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 160
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 176
+    0x01,0x01,0x01,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 192
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 208
+    0x81,0xC2,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 224
+    0x01,0x02,0x01,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 240
+  },
+  { // BK_SOLD1 (SOLD_01)
+    0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //   0
+    0x00,0x00,0x00,0x00,0x00,0x10,0x04,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0x02,  //  16
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  32
+    0x21,0x01,0x22,0x01,0x22,0x21,0x22,0x21,0x22,0x21,0x22,0x00,0x00,0x00,0x00,0x00,  //  48
+    0x21,0x22,0x21,0x22,0x21,0x22,0x21,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  64
+    0x21,0x22,0x21,0x21,0x21,0x21,0x21,0x21,0x21,0x01,0x00,0x00,0x00,0x00,0x00,0x00,  //  80
+    0x01,0x02,0x01,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  //  96
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 112
+    0x01,0x02,0x02,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 128
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 144
+    0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x01,  // 160
+    0x00,0x01,0x02,0x01,0x02,0x01,0x02,0x01,0x01,0x01,0x02,0x00,0x00,0x00,0x00,0x00,  // 176
+    0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x21,0x02,0x00,0x00,  // 192
+    0x01,0x02,0x01,0x02,0x21,0x22,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 208
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 224
+    0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,  // 240
+  },
+};
+
+static inline uint8_t ctrl_meta(Backend be, uint8_t ctrl){
+  if ((uint8_t)be >= 7) be = BK_UNKNOWN;
+  return pgm_read_byte(&CTRL_META[(uint8_t)be][ctrl]);
+}
+static inline bool ctrl_is(Backend be, uint8_t ctrl, uint8_t flag){
+  return (ctrl_meta(be, ctrl) & flag) != 0;
+}
+
+} // namespace jbc_meta
@@ -0,0 +1,124 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+
+#pragma once
+#include <Arduino.h>
+
+// ---- Schnelle Zahlenformatierung für den Ausgabepfad ----
+// Print::print(unsigned long) teilt je Stelle 32-bittig durch 10 (auf AVR ein Bibliotheksaufruf
+// mit ~600 Takten), print(float, n) rechnet zusätzlich in Software-Float. Hier:
+//  - Hex über eine Nibble-Tabelle,
+//  - Dezimal ohne Division (Zehnerpotenzen abziehen, bis 65535 in 16 Bit),
+//  - Festkomma: ganze Zahl in 10^-digits, z. B. 1234 mit 1 Stelle = "123.4".
+// Die char*-Funktionen schreiben ab p (ohne '\0') und liefern das Ende; print_* geben
+// das Ergebnis mit einem write() aus. Ausgabe wie Print: HEX ohne führende Nullen, Großbuchstaben.
+namespace jbc_fmt {
+
+static const char HEX_DIGITS[16] PROGMEM = {
+  '0','1','2','3','4','5','6','7','8','9','A','B','C','D','E','F'
+};
+static const uint16_t POW10_16[4] PROGMEM = { 10000, 1000, 100, 10 };
+static const uint32_t POW10_32[6] PROGMEM = { 1000000000UL, 100000000UL, 10000000UL, 1000000UL, 100000UL, 10000UL };
+
+static const uint8_t DEC_MAX = 10;   // Stellen von 4294967295
+static const uint8_t FIX_MAX = 12;   // '-' + 10 Stellen + '.' (digits <= 3)
+
+inline char nib(uint8_t n){ return (char)pgm_read_byte(&HEX_DIGITS[n & 0x0F]); }
+
+// zwei Stellen, immer mit führender 0 ("0A")
+inline char* hex2(char* p, uint8_t b){
+  *p++ = nib(b >> 4);
+  *p++ = nib(b);
+  return p;
+}
+// genau width Nibbles (kv_hex: 0x00AB)
+inline char* hexw(char* p, uint32_t v, uint8_t width){
+  for (uint8_t i = width; i; i--) { p[i-1] = nib((uint8_t)v); v >>= 4; }
+  return p + width;
+}
+// wie print(v, HEX): ohne führende Nullen
+inline char* hex(char* p, uint32_t v){
+  uint8_t w = 1;
+  for (uint32_t t = v >> 4; t; t >>= 4) w++;
+  return hexw(p, v, w);
+}
+
+// Stellen ab POW10_16[i]; lead = führende Nullen weglassen
+inline char* dec16_from(char* p, uint16_t v, uint8_t i, bool lead){
+  for (; i<4; i++){
+    const uint16_t t = pgm_read_word(&POW10_16[i]);
+    char c = '0';
+    while (v >= t) { v -= t; c++; }
+    if (c != '0' || !lead) { *p++ = c; lead = false; }
+  }
+  *p++ = (char)('0' + v);
+  return p;
+}
+// Dezimal, 16 Bit: höchstens 4×9 Subtraktionen statt 5 Divisionen
+inline char* dec16(char* p, uint16_t v){ return dec16_from(p, v, 0, true); }
+// Dezimal, 32 Bit: bis 10^4 zieht 32-bittig ab, die letzten vier Stellen wieder 16-bittig
+inline char* dec(char* p, uint32_t v){
+  if (v <= 0xFFFF) return dec16(p, (uint16_t)v);
+  bool lead = true;
+  for (uint8_t i=0; i<6; i++){
+    const uint32_t t = pgm_read_dword(&POW10_32[i]);
+    char c = '0';
+    while (v >= t) { v -= t; c++; }
+    if (c != '0' || !lead) { *p++ = c; lead = false; }
+  }
+  return dec16_from(p, (uint16_t)v, 1, false);
+}
+inline char* sdec(char* p, int32_t v){
+  if (v < 0) { *p++ = '-'; return dec(p, 0UL - (uint32_t)v); }
+  return dec(p, (uint32_t)v);
+}
+// zwei Stellen mit führender 0 (Uhrzeiten)
+inline char* dec2(char* p, uint8_t v){
+  char c = '0';
+  while (v >= 10) { v -= 10; c++; }
+  *p++ = c;
+  *p++ = (char)('0' + v);
+  return p;
+}
+
+// Festkomma: v in 10^-digits (digits <= 3), wie print(v / 10^digits, digits)
+inline char* fix(char* p, int32_t v, uint8_t digits){
+  uint32_t u = (uint32_t)v;
+  if (v < 0) { *p++ = '-'; u = 0UL - u; }
+  char t[DEC_MAX];
+  const uint8_t n = (uint8_t)(dec(t, u) - t);
+  uint8_t i = 0;
+  if (n > digits) { memcpy(p, t, n - digits); p += n - digits; i = n - digits; }
+  else *p++ = '0';
+  if (!digits) return p;
+  *p++ = '.';
+  for (uint8_t z = n; z < digits; z++) *p++ = '0';
+  memcpy(p, t + i, n - i);
+  return p + (n - i);
+}
+// n/d auf ganze Zahl gerundet (halb von 0 weg, wie print(float) es bei negativen Werten tut)
+inline int32_t div_round(int32_t n, uint16_t d){
+  return n >= 0 ? (int32_t)(((uint32_t)n + d/2) / d) : -(int32_t)(((uint32_t)-n + d/2) / d);
+}
+
+// ---- Ausgabe mit einem write() ----
+inline size_t put(Print& o, const char* b, const char* e){ return o.write((const uint8_t*)b, (size_t)(e - b)); }
+
+inline size_t print_u(Print& o, uint32_t v){ char b[DEC_MAX]; return put(o, b, dec(b, v)); }
+inline size_t print_i(Print& o, int32_t v) { char b[DEC_MAX+1]; return put(o, b, sdec(b, v)); }
+inline size_t print_hex(Print& o, uint32_t v){ char b[8]; return put(o, b, hex(b, v)); }
+inline size_t print_hex2(Print& o, uint8_t v){ char b[2]; return put(o, b, hex2(b, v)); }
+inline size_t print_fix(Print& o, int32_t v, uint8_t digits){ char b[FIX_MAX]; return put(o, b, fix(b, v, digits)); }
+
+// Bytes als "0A 1B 2C": sep zwischen den Bytes, in Blöcken zu 16 Byte
+inline void print_bytes(Print& o, const uint8_t* d, size_t n, char sep = ' '){
+  char b[16*3];
+  while (n){
+    char* p = b;
+    const uint8_t k = n > 16 ? 16 : (uint8_t)n;
+    for (uint8_t i=0; i<k; i++){ p = hex2(p, d[i]); *p++ = sep; }
+    d += k; n -= k;
+    put(o, b, n ? p : p - 1);   // kein sep nach dem letzten Byte
+  }
+}
+
+} // namespace jbc_fmt
@@ -4,6 +4,9 @@
 #include <Arduino.h>
 #include "jbc_commands_full.h"
 #include "jbc_cmd_names.h"   // Backend enum + pretty print helpers
+#include "jbc_ctrl_meta.h"   // Ctrl-Flags je Backend (PROGMEM)
+#include "jbc_bin.h"         // Binär-Datensätze (FMT_BIN)
+#include "jbc_fmt.h"         // Zahlen/Hex/Festkomma ohne Print::print
 
 using namespace jbc_cmd;
 
@@ -15,9 +18,19 @@ namespace jbc_decode {
   extern bool g_log_show_syn;        
   extern uint8_t g_station_ports;
   extern bool g_show_conti_send;  
+  extern int  g_log_cur_ctrl;        // Ctrl des gerade dekodierten Frames (-1 = keiner)
+  extern Backend g_log_cur_be;
+  extern uint8_t g_fmt;              // aktueller Durchlauf: FMT_TEXT / FMT_JSON / FMT_BIN (Enum im .ino)
+  extern bool g_fx;                  // dieser Durchlauf erledigt die Seiteneffekte (Relais, Portzahl)
+  extern uint16_t g_log_cur_tag;     // "#<tag>" der CLI-Zeile, auf die der Frame antwortet (0xFFFF = keins)
   static inline void set_current_fid(int fid){ g_log_cur_fid = fid; }
+  static inline void set_current_ctrl(Backend be, int ctrl){ g_log_cur_be = be; g_log_cur_ctrl = ctrl; }
 // Relais-Hook: im .ino definiert
 void jbc_conti_signal(bool on);
+// Drossel-Hook (SHED, im .ino): Kategorie der folgenden Conti-Zeilen setzen;
+// false = keine Konsole will sie in dieser Fassung (Port-Zeilen gedrosselt bzw. Summe unnötig)
+enum : uint8_t { CONTI_PORTS = 0x01, CONTI_SUM = 0x02, CONTI_BOTH = 0x03 };
+bool jbc_conti_lines(uint8_t which);
 
 // Conti-Burst (fid=250) für mehrere Familien
 static bool decode_conti_burst(Backend be, const uint8_t* d, uint8_t len);
@@ -25,47 +38,67 @@ static bool decode_conti_burst(Backend be, const uint8_t* d, uint8_t len);
 // Vorab-Deklaration: Definition kommt weiter unten im File
 static bool decode_datetime_payload(Backend be, const uint8_t* d, uint8_t len);
 
+// --- Payload-Layout-Profil (pro Link gelernt) ---
+// Einmal erkannte Layouts werden gemerkt und danach direkt dekodiert;
+// neu erkannt wird nur bei Längenwechsel (oder wenn das gemerkte Layout nicht mehr passt).
+enum DtLayout : uint8_t {
+  DT_UNKNOWN = 0,
+  DT_HA_SOD24,     // 7B: u24 SOD, YearOff (LE|BE), Mon, Day
+  DT_SOD16,        // 7B alt: u16 SOD, YearOff BE, Mon, Day
+  DT_YMDHMS,       // ≥7B: year LE, M, D, h, m, s
+  DT_BCD6,         // ≥6B BCD: YY MM DD hh mm ss
+};
+struct LayoutProfile {
+  uint16_t station_key  = 0;            // jbc_name::g_station.key, bei Wechsel -> neu lernen
+  Backend  conti_be     = BK_UNKNOWN;
+  uint8_t  conti_len    = 0;            // Burst-Länge, für die stride/ports gelten
+  uint8_t  conti_stride = 0;            // 10 (SOLD), 14/12 (HA), 0 = unbekannt
+  uint8_t  conti_ports  = 0;
+  uint8_t  dt_len       = 0;
+  uint8_t  dt_layout    = DT_UNKNOWN;
+};
+extern LayoutProfile g_layout;   // Definition im .ino
+
+static inline LayoutProfile& layout_profile(){
+  if (g_layout.station_key != jbc_name::g_station.key){
+    g_layout = LayoutProfile();
+    g_layout.station_key = jbc_name::g_station.key;
+  }
+  return g_layout;
+}
+
 
 // --- SYN-Logging Toggle (Definition kommt im .ino) ---
 extern bool g_log_show_syn;  // false = M_SYN stumm, true = anzeigen
 
-// erkennt M_SYN (V02 = 0x16) für alle Familien
-static inline bool is_syn_ctrl(uint8_t ctrl){
-  using namespace jbc_cmd;
-  return ctrl == 0x16
-      || ctrl == BASE::M_SYN
-      || ctrl == SOLD_01::M_SYN || ctrl == SOLD_02::M_SYN
-      || ctrl == HA_02::M_SYN   || ctrl == PH_02::M_SYN
-      || ctrl == FE_02::M_SYN   || ctrl == SF_02::M_SYN;
+// Ctrl-Klassifikation: je Abfrage genau ein PROGMEM-Lookup (Tabelle: jbc_ctrl_meta.h)
+static inline bool is_syn_ctrl(Backend be, uint8_t ctrl){
+  return jbc_meta::ctrl_is(be, ctrl, jbc_meta::CM_SYN);
 }
-
-// ACK-Erkennung (analog zu is_nack_ctrl)
-static inline bool is_ack_ctrl(uint8_t ctrl){
-  using namespace jbc_cmd;
-  return ctrl == 0x06
-      || ctrl == BASE::M_ACK
-      || ctrl == SOLD_01::M_ACK || ctrl == SOLD_02::M_ACK
-      || ctrl == HA_02::M_ACK   || ctrl == PH_02::M_ACK
-      || ctrl == FE_02::M_ACK   || ctrl == SF_02::M_ACK;
+static inline bool is_ack_ctrl(Backend be, uint8_t ctrl){
+  return jbc_meta::ctrl_is(be, ctrl, jbc_meta::CM_ACK);
+}
+static inline bool is_nack_ctrl(Backend be, uint8_t ctrl){
+  return jbc_meta::ctrl_is(be, ctrl, jbc_meta::CM_NACK);
 }
 
+// --- Sink-Interesse (Lazy-Decoding) ---
+// Welche Ausgabe-Kategorien hat gerade irgendein Abnehmer abonniert?
+// Frames ohne Abnehmer werden im .ino nur minimal geparst (Adresse, Liveness, Relais).
+enum : uint8_t {
+  SINK_DECODE = 0x01,   // Antworten/Events (Pretty-Print)
+  SINK_SYN    = 0x02,   // M_SYN-Zeilen
+  SINK_CONTI  = 0x04,   // CONTIMODE_SENDING je Port
+};
+extern uint8_t g_sink_interest;   // Definition im .ino
 
-// NACK-Erkennung (analog zu is_syn_ctrl)
-static inline bool is_nack_ctrl(uint8_t ctrl){
-  using namespace jbc_cmd;
-  return ctrl == 0x15
-      || ctrl == BASE::M_NACK
-      || ctrl == SOLD_01::M_NACK || ctrl == SOLD_02::M_NACK
-      || ctrl == HA_02::M_NACK   || ctrl == PH_02::M_NACK
-      || ctrl == FE_02::M_NACK   || ctrl == SF_02::M_NACK;
+// Kategorie eines RX-Frames (fid=250 -> Conti-Burst)
+static inline uint8_t frame_sink_class(Backend be, uint8_t fid, uint8_t ctrl){
+  if (is_syn_ctrl(be, ctrl)) return SINK_SYN;
+  if (fid == 250)        return SINK_CONTI;
+  return SINK_DECODE;
 }
 
-// Model-Kürzel
-static inline uint8_t ports_for_model_tag(const String& model){
-  if (model=="DM" || model=="DME" || model=="PSE" || model=="F4W") return 4;     // 4 Ports
-  if (model=="DDE"|| model=="DD"  || model=="DDR"|| model=="NA" || model=="NAE" || model=="F2") return 2; // 2 Ports
-  return 1; // sonst 1 Port
-}
 // =========================
 // KV-Helpers (einzeilig)
 // =========================
@@ -80,51 +113,156 @@ static inline const __FlashStringHelper* fam_tag(Backend be){
     default:       return F("BASE");
   }
 }
+
+// --- JSON Lines / Binär ---
+// Mit g_fmt liefern dieselben Aufrufe je Zeile ein Objekt statt [TAG] key=value:
+//   FMT_JSON: {"family":"SOLD","ctrl":"M_R_SELECTTEMP","ctrl_id":80,"fid":7,"fields":{"c":350.0,"uti":"0x0C4E"}}
+//             Zahlen bleiben Zahlen, Hex/Bits/Texte werden Strings, fehlende Werte null;
+//             Antworten auf "#<tag>"-Zeilen tragen "tag":N hinter "fid".
+//   FMT_BIN:  ein Datensatz nach jbc_bin.h (Feld-IDs statt Namen, Varints, Festkomma)
+// Decoder prüfen nur g_fmt != FMT_TEXT ("strukturiert"), den Rest erledigen die kv_*.
+static bool s_json_sep = false;   // Objekt hat schon ein Feld -> ',' davor
+
+// Ein Zeichen innerhalb eines JSON-Strings (Steuer- und Nicht-ASCII-Bytes als \u00XX, also Latin-1)
+static void json_char(char c){
+  const uint8_t u = (uint8_t)c;
+  if (c=='"' || c=='\\') { Serial.print('\\'); Serial.print(c); }
+  else if (u < 0x20 || u >= 0x7F) {
+    Serial.print(F("\\u00"));
+    Serial.print((char)((u>>4)  < 10 ? '0'+(u>>4)  : 'a'+(u>>4)-10));
+    Serial.print((char)((u&0xF) < 10 ? '0'+(u&0xF) : 'a'+(u&0xF)-10));
+  }
+  else Serial.print(c);
+}
+static void rec_open(Backend be, jbc_bin::Key ctrl){
+  if (g_fmt == FMT_BIN) { jbc_bin::begin(ctrl, be, g_log_cur_ctrl, g_log_cur_fid); return; }
+  Serial.print(F("{\"family\":\"")); Serial.print(fam_tag(be));
+  Serial.print(F("\",\"ctrl\":\""));  Serial.print(ctrl.name); Serial.print('"');
+  if (g_log_cur_ctrl >= 0){ Serial.print(F(",\"ctrl_id\":")); Serial.print(g_log_cur_ctrl); }
+  if (g_log_cur_fid  >= 0){ Serial.print(F(",\"fid\":"));     Serial.print(g_log_cur_fid); }
+  if (g_log_cur_tag != 0xFFFF){ Serial.print(F(",\"tag\":")); Serial.print(g_log_cur_tag); }   // statt "#<tag> " davor
+  Serial.print(F(",\"fields\":{"));
+  s_json_sep = false;
+}
+
 // Kopf nur mit Tag: [TAG] (inkl. optionalem <fid=...>)
-static inline void print_hdr_tag(const __FlashStringHelper* tag){
-  Serial.print('['); Serial.print(tag); Serial.print(']');
+static inline void print_hdr_tag(jbc_bin::Key tag){
+  if (g_fmt) { rec_open(g_log_cur_be, tag); return; }
+  Serial.print('['); Serial.print(tag.name); Serial.print(']');
   if (jbc_decode::g_log_show_fid && jbc_decode::g_log_cur_fid >= 0){
-    Serial.print(F(" <fid=")); Serial.print(jbc_decode::g_log_cur_fid); Serial.print('>');
+    Serial.print(F(" <fid=")); jbc_fmt::print_u(Serial, (uint16_t)jbc_decode::g_log_cur_fid); Serial.print('>');
   }
   Serial.print(' ');
 }
 
 // Kopf: [FAM_CTRL]
-static inline void print_hdr_line(Backend be, const __FlashStringHelper* ctrl){
-  Serial.print('['); Serial.print(fam_tag(be)); Serial.print('_'); Serial.print(ctrl); Serial.print(']');
+static inline void print_hdr_line(Backend be, jbc_bin::Key ctrl){
+  if (g_fmt) { rec_open(be, ctrl); return; }
+  Serial.print('['); Serial.print(fam_tag(be)); Serial.print('_'); Serial.print(ctrl.name); Serial.print(']');
   if (jbc_decode::g_log_show_fid && jbc_decode::g_log_cur_fid >= 0){
-    Serial.print(F(" <fid=")); Serial.print(jbc_decode::g_log_cur_fid); Serial.print('>');
+    Serial.print(F(" <fid=")); jbc_fmt::print_u(Serial, (uint16_t)jbc_decode::g_log_cur_fid); Serial.print('>');
   }
   Serial.print(' ');
 }
 
-// key="string"
-static inline void kv_s(const __FlashStringHelper* k, const String& v){
+// " key=" bzw. ,"key": (nur Text/JSON)
+static inline void kv_name(const __FlashStringHelper* k){
+  if (g_fmt == FMT_JSON){
+    if (s_json_sep) Serial.print(',');
+    s_json_sep = true;
+    Serial.print('"'); Serial.print(k); Serial.print(F("\":"));
+    return;
+  }
   Serial.print(' '); Serial.print(k); Serial.print('=');
-  Serial.print('"');
-  for (size_t i=0;i<v.length();i++){ char c=v[i]; if(c=='"') Serial.print(F("\\\"")); else Serial.print(c); }
-  Serial.print('"');
+}
+// dito bzw. Feld-ID mit Typ (FMT_BIN)
+static inline void kv_key(jbc_bin::Key k, uint8_t type){
+  if (g_fmt == FMT_BIN) { jbc_bin::key(k, type); return; }
+  kv_name(k.name);
+}
+// key="…" zeichenweise
+static inline void kv_str_open(jbc_bin::Key k){
+  kv_key(k, jbc_bin::T_STR);
+  if (g_fmt == FMT_BIN) jbc_bin::str_open(); else Serial.print('"');
+}
+static inline void kv_str_char(char c){
+  if (g_fmt == FMT_BIN)  jbc_bin::put((uint8_t)c);
+  else if (g_fmt)        json_char(c);
+  else if (c=='"')       Serial.print(F("\\\""));
+  else                   Serial.print(c);
+}
+static inline void kv_str_close(){
+  if (g_fmt == FMT_BIN) jbc_bin::str_close(); else Serial.print('"');
+}
+// Zeilenende (schließt Objekt bzw. sendet den Datensatz am Stück)
+static inline void kv_end(){
+  if (g_fmt == FMT_BIN){
+    const uint8_t n = jbc_bin::end();
+    if (n && Serial.write(jbc_bin::g_rec.buf, n) == n) jbc_bin::g_rec.sent++;   // nur, was eine Konsole bekam
+    return;
+  }
+  if (g_fmt) Serial.print(F("}}"));
+  Serial.println();
+}
+
+// key="string"
+static inline void kv_s(jbc_bin::Key k, const String& v){
+  kv_str_open(k);
+  for (size_t i=0;i<v.length();i++) kv_str_char(v[i]);
+  kv_str_close();
+}
+static inline void kv_s(jbc_bin::Key k, const char* v){
+  kv_str_open(k);
+  for (; *v; ++v) kv_str_char(*v);
+  kv_str_close();
 }
 // key="FS"
-static inline void kv_fs(const __FlashStringHelper* k, const __FlashStringHelper* v){
-  Serial.print(' '); Serial.print(k); Serial.print('=');
+static inline void kv_fs(jbc_bin::Key k, const __FlashStringHelper* v){
+  if (g_fmt == FMT_BIN){
+    kv_str_open(k);
+    for (const char* p = reinterpret_cast<const char*>(v); char c = (char)pgm_read_byte(p); p++) kv_str_char(c);
+    kv_str_close();
+    return;
+  }
+  kv_key(k, jbc_bin::T_STR);
   Serial.print('"'); Serial.print(v); Serial.print('"');
 }
 // key=123
-static inline void kv_u(const __FlashStringHelper* k, uint32_t v){
-  Serial.print(' '); Serial.print(k); Serial.print('='); Serial.print(v);
-}
-// key=12.3
-static inline void kv_c(const __FlashStringHelper* k, float c, uint8_t digits=1){
-  Serial.print(' '); Serial.print(k); Serial.print('='); Serial.print(c, digits);
-}
-// key=0xAB / 0x12345678
-static inline void kv_hex(const __FlashStringHelper* k, uint32_t v, uint8_t width=2){
-  Serial.print(' '); Serial.print(k); Serial.print(F("=0x"));
-  for (int i=(width-1)*4; i>=0; i-=4){
-    uint8_t nib = (v >> i) & 0xF;
-    Serial.print(nib < 10 ? char('0'+nib) : char('A'+nib-10));
-  }
+static inline void kv_u(jbc_bin::Key k, uint32_t v){
+  kv_key(k, jbc_bin::T_UINT);
+  if (g_fmt == FMT_BIN) jbc_bin::varint(v); else jbc_fmt::print_u(Serial, v);
+}
+// key=12.3 – v als Festkomma in 10^-digits (12.3 °C = 123, digits 1..2)
+static inline void kv_fix(jbc_bin::Key k, int32_t v, uint8_t digits=1){
+  kv_key(k, digits >= 2 ? jbc_bin::T_FIX2 : jbc_bin::T_FIX1);
+  if (g_fmt == FMT_BIN) jbc_bin::zigzag(v); else jbc_fmt::print_fix(Serial, v, digits);
+}
+// key=0xAB / 0x12345678 (JSON: "0xAB")
+static inline void kv_hex(jbc_bin::Key k, uint32_t v, uint8_t width=2){
+  kv_key(k, jbc_bin::T_HEX);
+  if (g_fmt == FMT_BIN) { jbc_bin::varint(v); return; }
+  char b[1 + 2 + 8 + 1], *p = b;
+  if (g_fmt) *p++ = '"';
+  *p++ = '0'; *p++ = 'x';
+  p = jbc_fmt::hexw(p, v, width);
+  if (g_fmt) *p++ = '"';
+  jbc_fmt::put(Serial, b, p);
+}
+// Wert fehlt: key="N/A" (bzw. der übergebene Text), JSON null
+static inline void kv_none(jbc_bin::Key k, const __FlashStringHelper* txt){
+  if (!g_fmt) { kv_fs(k, txt); return; }
+  kv_key(k, jbc_bin::T_NULL);
+  if (g_fmt == FMT_JSON) Serial.print(F("null"));
+}
+// Freitext direkt hinter dem Kopf (z. B. "OK"); strukturiert: key="text"
+static inline void kv_word(jbc_bin::Key k, const __FlashStringHelper* v){
+  if (g_fmt) kv_fs(k, v);
+  else Serial.print(v);
+}
+// Name in Klammern hinter dem vorigen Wert: " (T245)"; strukturiert: key="T245"
+static inline void kv_note(jbc_bin::Key k, const __FlashStringHelper* v){
+  if (g_fmt) kv_fs(k, v);
+  else { Serial.print(F(" (")); Serial.print(v); Serial.print(')'); }
 }
 
 
@@ -136,8 +274,8 @@ static inline uint32_t u32le(const uint8_t* p){
   return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
 }
 
-// UTI → °C
-static inline float    uti_to_c(uint16_t uti){ return (float)uti / 9.0f; } // JBC UTI ≈ 1/9 °C
+// UTI → Zehntel-°C, gerundet (JBC UTI ≈ 1/9 °C); Differenzen dürfen negativ sein
+static inline int32_t  uti_to_dc(int32_t uti){ return jbc_fmt::div_round(uti * 10, 9); }
 
 // BCD & Zeitdrucker
 static inline uint8_t  bcd2(uint8_t b){ return (uint8_t)((b>>4)*10 + (b&0x0F)); }
@@ -163,30 +301,32 @@ static inline String fmt_mmss_tenths(uint16_t ds){
 
 static void print_dur_hms(uint32_t sec){
   uint32_t h = sec / 3600UL;
-  uint8_t  m = (uint8_t)((sec % 3600UL) / 60UL);
-  uint8_t  s = (uint8_t)(sec % 60UL);
-  Serial.print(h); Serial.print(':');
-  if (m<10) Serial.print('0'); Serial.print(m); Serial.print(':');
-  if (s<10) Serial.print('0'); Serial.print(s);
+  uint16_t r = (uint16_t)(sec - h * 3600UL);
+  uint8_t  m = (uint8_t)(r / 60);
+  char b[jbc_fmt::DEC_MAX + 6], *p = jbc_fmt::dec(b, h);
+  *p++ = ':'; p = jbc_fmt::dec2(p, m);
+  *p++ = ':'; p = jbc_fmt::dec2(p, (uint8_t)(r - m * 60));
+  jbc_fmt::put(Serial, b, p);
 }
 
 // Minuten hübsch als H:MM
 static inline void print_hm_from_minutes(uint32_t minutes){
   uint32_t h = minutes / 60UL;
-  uint8_t  m = (uint8_t)(minutes % 60UL);
-  Serial.print(h); Serial.print(':');
-  if (m<10) Serial.print('0'); Serial.print(m);
+  char b[jbc_fmt::DEC_MAX + 3], *p = jbc_fmt::dec(b, h);
+  *p++ = ':'; p = jbc_fmt::dec2(p, (uint8_t)(minutes - h * 60UL));
+  jbc_fmt::put(Serial, b, p);
 }
 
 // Sekunden-seit-Mitternacht hübsch als HH:MM:SS
 static void print_hms(uint32_t sod){
   sod %= 86400UL;
-  uint8_t h = (uint8_t)(sod / 3600UL);
-  uint8_t m = (uint8_t)((sod % 3600UL) / 60UL);
-  uint8_t s = (uint8_t)(sod % 60UL);
-  if (h<10) Serial.print('0'); Serial.print(h); Serial.print(':');
-  if (m<10) Serial.print('0'); Serial.print(m); Serial.print(':');
-  if (s<10) Serial.print('0'); Serial.print(s);
+  uint8_t  h = (uint8_t)(sod / 3600UL);
+  uint16_t r = (uint16_t)(sod - h * 3600UL);
+  uint8_t  m = (uint8_t)(r / 60);
+  char b[8], *p = jbc_fmt::dec2(b, h);
+  *p++ = ':'; p = jbc_fmt::dec2(p, m);
+  *p++ = ':'; p = jbc_fmt::dec2(p, (uint8_t)(r - m * 60));
+  jbc_fmt::put(Serial, b, p);
 }
 
 // String/Hex/IPv4
@@ -196,51 +336,55 @@ static String sanitize_ascii(const uint8_t* d, uint8_t len){
   return s;
 }
 static void print_hex(const uint8_t* d, uint8_t len){
-  for(uint8_t i=0;i<len;i++){
-    if(d[i]<16) Serial.print('0');
-    Serial.print(d[i], HEX);
-    if(i+1<len) Serial.print(' ');
-  }
+  jbc_fmt::print_bytes(Serial, d, len);
+}
+// key=01 02 03 (ohne Anführungszeichen); JSON: "01 02 03"
+static void kv_raw(jbc_bin::Key k, const uint8_t* d, uint8_t len){
+  kv_key(k, jbc_bin::T_BYTES);
+  if (g_fmt == FMT_BIN) { jbc_bin::put(len); for (uint8_t i=0; i<len; i++) jbc_bin::put(d[i]); return; }
+  if (g_fmt) Serial.print('"');
+  print_hex(d, len);
+  if (g_fmt) Serial.print('"');
 }
 static String hex_string(const uint8_t* d, uint8_t len, bool spaced=true, bool uppercase=true){
   String s; s.reserve(len * (spaced ? 3 : 2));
   for(uint8_t i=0;i<len;i++){
     if(i && spaced) s += ' ';
-    if(d[i] < 16) s += '0';
-    s += String(d[i], HEX);
+    char h[3]; *jbc_fmt::hex2(h, d[i]) = '\0';
+    if (!uppercase) { h[0] = (char)tolower(h[0]); h[1] = (char)tolower(h[1]); }
+    s += h;
   }
-  if (uppercase) s.toUpperCase();
   return s;
 }
 
 static void print_ip4(const uint8_t* p){
-  Serial.print((uint8_t)p[0]); Serial.print('.');
-  Serial.print((uint8_t)p[1]); Serial.print('.');
-  Serial.print((uint8_t)p[2]); Serial.print('.');
-  Serial.print((uint8_t)p[3]);
+  char b[15], *w = b;
+  for (uint8_t i=0; i<4; i++){ if (i) *w++ = '.'; w = jbc_fmt::dec16(w, p[i]); }
+  jbc_fmt::put(Serial, b, w);
 }
 
 // --- kleine Pretty-Printer ---
-static inline void print_pct_from_ppm(const __FlashStringHelper* tag, uint16_t ppm){
+static inline void print_pct_from_ppm(jbc_bin::Key tag, uint16_t ppm){
   if(ppm>1000) ppm=1000; // clamp
   print_hdr_tag(tag);
-  Serial.print(ppm/10.0f, 1); Serial.print(F(" % (raw=")); Serial.print(ppm); Serial.println(')');
+  jbc_fmt::print_fix(Serial, ppm, 1); Serial.print(F(" % (raw=")); jbc_fmt::print_u(Serial, ppm); Serial.println(')');
 }
-static inline void print_temp_c_from_uti(const __FlashStringHelper* tag, uint16_t uti){
+static inline void print_temp_c_from_uti(jbc_bin::Key tag, uint16_t uti){
   print_hdr_tag(tag);
-  Serial.print(uti_to_c(uti),1); Serial.println(F(" °C"));
+  jbc_fmt::print_fix(Serial, uti_to_dc(uti), 1); Serial.println(F(" °C"));
 }
-static inline void print_u16_raw(const __FlashStringHelper* tag, uint16_t v){
+static inline void print_u16_raw(jbc_bin::Key tag, uint16_t v){
   print_hdr_tag(tag);
   Serial.println(v);
 }
-static inline void print_onoff(const __FlashStringHelper* tag, uint8_t v){
+static inline void print_onoff(jbc_bin::Key tag, uint8_t v){
   print_hdr_tag(tag);
+  if (g_fmt){ kv_u(v<=1 ? FLD(on) : FLD(code), v); kv_end(); return; }
   if(v==0) Serial.println(F("OFF"));
   else if(v==1) Serial.println(F("ON"));
   else { Serial.print(F("code=")); Serial.println(v); }
 }
-static inline void print_mmss_tenths(const __FlashStringHelper* tag, uint16_t deciSeconds){
+static inline void print_mmss_tenths(jbc_bin::Key tag, uint16_t deciSeconds){
   const uint32_t total_s = deciSeconds / 10;
   const uint8_t  tenths  = deciSeconds % 10;
   const uint16_t mm = total_s / 60;
@@ -250,159 +394,135 @@ static inline void print_mmss_tenths(const __FlashStringHelper* tag, uint16_t de
   Serial.print(':');
   if (ss < 10) Serial.print('0'); Serial.print(ss);
   if (tenths) { Serial.print('.'); Serial.print(tenths); }
-  Serial.println();
+  kv_end();
 }
 
-// Tool-Error → Name, pro Familie 0..N
-static const __FlashStringHelper* tool_error_name_fam(Backend be, uint8_t code){
-  switch (be){
-    case BK_SOLD:
-    case BK_SOLD1:
-      switch (code){
-        case 0: return F("OK");
-        case 1: return F("SHORTCIRCUIT");
-        case 2: return F("SHORTCIRCUIT_NR");
-        case 3: return F("OPENCIRCUIT");
-        case 4: return F("NOTOOL");
-        case 5: return F("WRONGTOOL");
-        case 6: return F("DETECTIONTOOL");
-        case 7: return F("MAXPOWER");
-        case 8: return F("STOPOVERLOAD_MOS");
-        default: return nullptr;
-      }
-
-    case BK_HA:
-      switch (code){
-        case 0:  return F("OK");
-        case 1:  return F("AIR_PUMP_ERROR");
-        case 2:  return F("PROTECION_TC_HIGH");   
-        case 3:  return F("REGULATION_TC_HIGH");
-        case 4:  return F("EXTERNAL_TC_MISSING");
-        case 5:  return F("SELECTED_TEMP_NOT_REACHED");
-        case 6:  return F("HIGH_HEATER_INTENSITY");
-        case 7:  return F("LOW_HEATER_RESISTANCE");
-        case 8:  return F("WRONG_HEATER");
-        case 9:  return F("NOTOOL_HA");
-        case 10: return F("DETECTIONTOOL_HA");
-        default: return nullptr;
-      }
-
-    case BK_PH:
-      switch (code){
-        case 0: return F("OK");
-        case 1: return F("SELECTED_TEMP_NOT_REACHED_PH");
-        case 2: return F("LOW_HEATER_INTENSITY");
-        case 3: return F("TC1_NOT_CONNECTED");
-        case 4: return F("TC1_LIMIT_REACHED");
-        case 5: return F("TC2_NOT_CONNECTED");
-        case 6: return F("TC2_LIMIT_REACHED");
-        case 7: return F("TC1_TC2_NOT_CONNECTED");
-        default: return nullptr;
+// =========================
+// Namenstabellen (PROGMEM)
+// =========================
+// Gepackte Listen: Namen hintereinander, je mit '\0' abgeschlossen.
+//  - Enum-Tabellen: Index = Code, Ende = leerer Eintrag (implizites '\0' des Literals)
+//  - Bit-Tabellen:  Index = Bitnummer, leerer Eintrag = unbenanntes Bit (genau nbits Einträge)
+
+// Name Nr. idx (oder nullptr, wenn Tabelle vorher endet)
+static const __FlashStringHelper* pgm_name(const char* tbl, uint8_t idx){
+  const char* p = tbl;
+  for (;;){
+    const uint8_t n = (uint8_t)strlen_P(p);
+    if (!n) return nullptr;
+    if (!idx--) return reinterpret_cast<const __FlashStringHelper*>(p);
+    p += n + 1;
+  }
+}
+
+// Bitmaske als "NAME|NAME|BITn" (oder "NONE") ausgeben
+enum : uint8_t { BITS_UNNAMED = 0x01 };   // unbenannte gesetzte Bits als BITn anhängen
+static void print_bits(const char* tbl, uint16_t v, uint8_t nbits, uint8_t opts){
+  bool any = false;
+  const char* p = tbl;
+  for (uint8_t b=0; b<nbits; ++b){          // 1) benannte Bits in Tabellenreihenfolge
+    const uint8_t n = (uint8_t)strlen_P(p);
+    if (n && (v & (1u<<b))){
+      if (any) Serial.print('|');
+      Serial.print(reinterpret_cast<const __FlashStringHelper*>(p)); any = true;
+    }
+    p += n + 1;
+  }
+  if (opts & BITS_UNNAMED){                 // 2) Rest generisch
+    p = tbl;
+    for (uint8_t b=0; b<nbits; ++b){
+      const uint8_t n = (uint8_t)strlen_P(p);
+      if (!n && (v & (1u<<b))){
+        if (any) Serial.print('|');
+        Serial.print(F("BIT")); Serial.print(b); any = true;
       }
-
-    // FE/SF: keine bestätigte Tool-Error-Tabelle bekannt
-    case BK_FE:
-    case BK_SF:
-    default:
-      return nullptr;
+      p += n + 1;
+    }
   }
+  if (!any) Serial.print(F("NONE"));
+}
+// key="NAME|NAME|…" (FMT_BIN: entfällt, der Wert steht im Hex-Feld davor)
+static void kv_bits(const __FlashStringHelper* k, const char* tbl, uint16_t v, uint8_t nbits, uint8_t opts){
+  if (g_fmt == FMT_BIN) return;
+  kv_name(k); Serial.print('"');
+  print_bits(tbl, v, nbits, opts);
+  Serial.print('"');
 }
 
+// ---------- Tool-Error → Name, pro Familie 0..N ----------
+static const char NT_TOOLERR_SOLD[] PROGMEM =
+  "OK\0" "SHORTCIRCUIT\0" "SHORTCIRCUIT_NR\0" "OPENCIRCUIT\0" "NOTOOL\0" "WRONGTOOL\0"
+  "DETECTIONTOOL\0" "MAXPOWER\0" "STOPOVERLOAD_MOS\0";
+static const char NT_TOOLERR_HA[] PROGMEM =
+  "OK\0" "AIR_PUMP_ERROR\0" "PROTECION_TC_HIGH\0" "REGULATION_TC_HIGH\0" "EXTERNAL_TC_MISSING\0"
+  "SELECTED_TEMP_NOT_REACHED\0" "HIGH_HEATER_INTENSITY\0" "LOW_HEATER_RESISTANCE\0" "WRONG_HEATER\0"
+  "NOTOOL_HA\0" "DETECTIONTOOL_HA\0";
+static const char NT_TOOLERR_PH[] PROGMEM =
+  "OK\0" "SELECTED_TEMP_NOT_REACHED_PH\0" "LOW_HEATER_INTENSITY\0" "TC1_NOT_CONNECTED\0"
+  "TC1_LIMIT_REACHED\0" "TC2_NOT_CONNECTED\0" "TC2_LIMIT_REACHED\0" "TC1_TC2_NOT_CONNECTED\0";
 
-static const __FlashStringHelper* station_error_name(uint8_t c){
-  switch (c){
-    case 0: return F("OK");
-    case 1: return F("STOPOVERLOAD_TRAFO");
-    case 2: return F("WRONGSENSOR_TRAFO");
-    case 3: return F("MEMORY");
-    case 4: return F("MAINSFREQUENCY");
-    case 5: return F("STATION_MODEL");
-    case 6: return F("NOT_MCU_TOOLS");
-    default: return nullptr;
+static const __FlashStringHelper* tool_error_name_fam(Backend be, uint8_t code){
+  switch (be){
+    case BK_SOLD:
+    case BK_SOLD1: return pgm_name(NT_TOOLERR_SOLD, code);
+    case BK_HA:    return pgm_name(NT_TOOLERR_HA,   code);
+    case BK_PH:    return pgm_name(NT_TOOLERR_PH,   code);
+    // FE/SF: keine bestätigte Tool-Error-Tabelle bekannt
+    default:       return nullptr;
   }
 }
 
-static const __FlashStringHelper* typeofground_name(uint8_t v){
-  switch (v){
-    case 0: return F("SOFTGROUND");
-    case 1: return F("HARDGROUND");
-    default: return nullptr;
-  }
-}
+static const char NT_STATION_ERROR[] PROGMEM =
+  "OK\0" "STOPOVERLOAD_TRAFO\0" "WRONGSENSOR_TRAFO\0" "MEMORY\0" "MAINSFREQUENCY\0"
+  "STATION_MODEL\0" "NOT_MCU_TOOLS\0";
+static const char NT_TYPEOFGROUND[] PROGMEM = "SOFTGROUND\0" "HARDGROUND\0";
 
+static const __FlashStringHelper* station_error_name(uint8_t c){ return pgm_name(NT_STATION_ERROR, c); }
+static const __FlashStringHelper* typeofground_name(uint8_t v){  return pgm_name(NT_TYPEOFGROUND, v); }
 
 // ---------- Tool-Code → Name ----------
-static const __FlashStringHelper* sold_tool_name(uint8_t code){
-  switch(code){
-    case 0:  return F("NOTOOL");
-    case 1:  return F("T210");
-    case 2:  return F("T245");
-    case 3:  return F("PA");
-    case 4:  return F("HT");
-    case 5:  return F("DS");
-    case 6:  return F("DR");
-    case 7:  return F("NT105");
-    case 8:  return F("NP105");
-    case 9:  return F("T470");
-    default: return nullptr;
-  }
-}
+static const char NT_SOLD_TOOL[] PROGMEM =
+  "NOTOOL\0" "T210\0" "T245\0" "PA\0" "HT\0" "DS\0" "DR\0" "NT105\0" "NP105\0" "T470\0";
+static const char NT_HA_TOOL[] PROGMEM = "NOTOOL\0" "JT\0" "TE\0";   // HA-spezifisch
 
-// HA-spezifisch
-static const __FlashStringHelper* ha_tool_name(uint8_t code){
-  switch(code){
-    case 0: return F("NOTOOL");
-    case 1: return F("JT");
-    case 2: return F("TE");
-    default: return nullptr;
-  }
-}
+static const __FlashStringHelper* sold_tool_name(uint8_t code){ return pgm_name(NT_SOLD_TOOL, code); }
+static const __FlashStringHelper* ha_tool_name(uint8_t code){   return pgm_name(NT_HA_TOOL, code); }
 
 //--- kleine Namenstabellen ---
-static const char* tempunit_name(uint8_t v){
-  switch(v){ case 0: return "CELSIUS"; case 1: return "FAHRENHEIT"; default: return nullptr; }
-}
-static const char* language_from_ascii(const uint8_t* d, uint8_t len){
+static const char NT_TEMPUNIT[] PROGMEM = "CELSIUS\0" "FAHRENHEIT\0";
+static const char NT_LANGUAGE[] PROGMEM = "ENGLISH\0" "SPANISH\0" "GERMAN\0" "FRENCH\0" "ITALIAN\0" "PORTUGUESE\0";
+static const char LANG_ISO2[]   PROGMEM = "ENESDEFRITPT";          // gleiche Reihenfolge wie NT_LANGUAGE
+static const char NT_THEME[]    PROGMEM = "DARK\0" "LIGHT\0" "AUTO\0";   // heuristisch
+static const char NT_NACK_REASON[] PROGMEM =                            // ab 0x01, heuristisch
+  "FORMAT/LENGTH\0" "UNSUPPORTED_CMD\0" "ILLEGAL_STATE/LOCKED\0" "BAD_ARGUMENTS\0" "NOT_ALLOWED/REMOTE_OFF\0";
+
+static const __FlashStringHelper* tempunit_name(uint8_t v){ return pgm_name(NT_TEMPUNIT, v); }
+static const __FlashStringHelper* language_from_ascii(const uint8_t* d, uint8_t len){
   if(len < 2) return nullptr;
-  char a = (char)d[0], b = (char)d[1];
-  if((a=='E'||a=='e') && (b=='N'||b=='n')) return "ENGLISH";
-  if((a=='E'||a=='e') && (b=='S'||b=='s')) return "SPANISH";
-  if((a=='D'||a=='d') && (b=='E'||b=='e')) return "GERMAN";
-  if((a=='F'||a=='f') && (b=='R'||b=='r')) return "FRENCH";
-  if((a=='I'||a=='i') && (b=='T'||b=='t')) return "ITALIAN";
-  if((a=='P'||a=='p') && (b=='T'||b=='t')) return "PORTUGUESE";
-  return nullptr;
-}
-static const char* language_from_code(uint8_t v){
-  switch(v){
-    case 0: return "ENGLISH"; case 1: return "SPANISH"; case 2: return "GERMAN";
-    case 3: return "FRENCH";  case 4: return "ITALIAN"; case 5: return "PORTUGUESE";
-    default: return nullptr;
-  }
-}
-
-// THEME Namen (heuristisch)
-static const char* theme_name(uint8_t v){
-  switch(v){
-    case 0: return "DARK";
-    case 1: return "LIGHT";
-    case 2: return "AUTO";
-    default: return nullptr;
-  }
-}
-
-// NACK-Reason-Name (heuristisch)
-static const char* nack_reason_name(uint8_t r){
-  switch(r){
-    case 0x01: return "FORMAT/LENGTH";
-    case 0x02: return "UNSUPPORTED_CMD";
-    case 0x03: return "ILLEGAL_STATE/LOCKED";
-    case 0x04: return "BAD_ARGUMENTS";
-    case 0x05: return "NOT_ALLOWED/REMOTE_OFF";
-    default:   return nullptr;
+  const char a = (char)toupper(d[0]), b = (char)toupper(d[1]);
+  for (uint8_t i=0; i<6; ++i){
+    if (pgm_read_byte(&LANG_ISO2[2*i]) == a && pgm_read_byte(&LANG_ISO2[2*i+1]) == b) return pgm_name(NT_LANGUAGE, i);
   }
+  return nullptr;
 }
-
+static const __FlashStringHelper* language_from_code(uint8_t v){ return pgm_name(NT_LANGUAGE, v); }
+static const __FlashStringHelper* theme_name(uint8_t v){         return pgm_name(NT_THEME, v); }
+static const __FlashStringHelper* nack_reason_name(uint8_t r){   return r ? pgm_name(NT_NACK_REASON, r-1) : nullptr; }
+
+// ---------- Bit-Tabellen ----------
+static const char BT_SOLD_STATUS[] PROGMEM =        // 8 Bits
+  "STAND\0" "SLEEP\0" "HIBERNATION\0" "EXTRACTOR\0" "DESOLDER\0" "PORT_LOCKED\0" "\0" "\0";
+static const char BT_HA_STATUS[] PROGMEM =          // 8 Bits
+  "HEATER\0" "HEATER_REQUESTED\0" "COOLING\0" "SUCTION\0" "SUCTION_REQUESTED\0"
+  "PEDAL_CONNECTED\0" "PEDAL_PRESSED\0" "STAND\0";
+static const char BT_SOLD_STATUSTOOL[] PROGMEM =    // 16 Bits (SOLDER/SOLDER1)
+  "STAND\0" "SLEEP\0" "HIBERNATION\0" "EXTRACTOR\0" "DESOLDER\0" "PORT_LOCKED\0" "\0" "\0"
+  "DESOLDER_TOOL\0" "\0" "\0" "\0" "\0" "\0" "\0" "\0";
+static const char BT_CHANGES[] PROGMEM =            // 8 Bits (SOLD/HA gleich)
+  "SELECTTEMP_CHANGED\0" "STATION_PARAM_CHANGED\0" "TOOL_PARAM_GRP0_CHANGED\0" "TOOL_PARAM_GRP1_CHANGED\0"
+  "TOOL_PARAM_GRP2_CHANGED\0" "TOOL_PARAM_GRP3_CHANGED\0" "\0" "COUNTER_CHANGED\0";
+static const char BT_HA_STARTMODE[] PROGMEM =       // 4 Bits
+  "TOOL_BUTTON\0" "STAND_OUT\0" "PEDAL_PULSE\0" "PEDAL_HOLD_DOWN\0";
 
 
 // --------------------
@@ -416,77 +536,77 @@ static bool decode_crossfamily_reads(Backend be, uint8_t ctrl, const uint8_t* d,
 
   // --- kleine Helper ---
   auto print_usb_status = [&](){
-    print_hdr_line(be, F("M_R_USB_CONNECTSTATUS"));
-    if (!len){ kv_fs(F("text"), F("")); Serial.println(); return true; }
+    print_hdr_line(be, REC(M_R_USB_CONNECTSTATUS));
+    if (!len){ kv_fs(FLD(text), F("")); kv_end(); return true; }
     String s = sanitize_ascii(d,len);
-    if (!s.length()){ Serial.print(F(" raw=")); print_hex(d,len); Serial.println(); return true; }
-    kv_s(F("text"), s);
+    if (!s.length()){ kv_raw(FLD(raw), d, len); kv_end(); return true; }
+    kv_s(FLD(text), s);
     char mode = 0;
     for (int i=(int)s.length()-1; i>=0; --i){
       char c = s[i];
       if ((c>='A'&&c<='Z') || (c>='a'&&c<='z')){ mode = (c>='a'&&c<='z') ? (char)(c-32) : c; break; }
     }
-    if (mode=='C') kv_fs(F("mode"), F("PC_CONTROL"));
-    else if (mode=='M') kv_fs(F("mode"), F("MONITOR"));
-    Serial.println();
+    if (mode=='C') kv_fs(FLD(mode), F("PC_CONTROL"));
+    else if (mode=='M') kv_fs(FLD(mode), F("MONITOR"));
+    kv_end();
     return true;
   };
 
   auto print_discover = [&](){
-    print_hdr_line(be, F("M_R_DISCOVER"));
+    print_hdr_line(be, REC(M_R_DISCOVER));
     if (len == 1){
       const uint8_t v = d[0];
       if (v == 0x06){                      // ACK → „vorhanden“
-        kv_u (F("present"), 1);
-        kv_hex(F("ack"), v, 2);
-        Serial.println();
+        kv_u (FLD(present), 1);
+        kv_hex(FLD(ack), v, 2);
+        kv_end();
         return true;
       }
       if (v == 0x15){                      // NACK → „nicht vorhanden“
-        kv_u (F("present"), 0);
-        kv_hex(F("nack"), v, 2);
-        Serial.println();
+        kv_u (FLD(present), 0);
+        kv_hex(FLD(nack), v, 2);
+        kv_end();
         return true;
       }
       if (v == '0' || v == '1'){           // manche FW geben ASCII ‚0‘/‚1‘ zurück
-        kv_u (F("present"), (v=='1') ? 1 : 0);
-        kv_hex(F("raw"), v, 2);
-        Serial.println();
+        kv_u (FLD(present), (v=='1') ? 1 : 0);
+        kv_hex(FLD(raw), v, 2);
+        kv_end();
         return true;
       }
       // Unbekannter 1-Byte-Code
-      kv_hex(F("code"), v, 2);
-      Serial.println();
+      kv_hex(FLD(code), v, 2);
+      kv_end();
       return true;
     }
 
     // Unerwartete Länge → Rohdump für Diagnose
-    kv_s(F("raw"), hex_string(d, len));
-    Serial.println();
+    kv_s(FLD(raw), hex_string(d, len));
+    kv_end();
     return true;
   };
 
 
   auto print_pin = [&](){
-    print_hdr_line(be, F("M_R_PIN"));
+    print_hdr_line(be, REC(M_R_PIN));
     if (len==4 && d[0]>='0'&&d[0]<='9' && d[1]>='0'&&d[1]<='9' &&
                  d[2]>='0'&&d[2]<='9' && d[3]>='0'&&d[3]<='9'){
       String p; p.reserve(4); for(uint8_t i=0;i<4;i++) p += char(d[i]);
-      kv_s(F("pin"), p);
+      kv_s(FLD(pin), p);
     } else {
-      Serial.print(F(" raw=")); print_hex(d,len);
+      kv_raw(FLD(raw), d, len);
     }
-    Serial.println();
+    kv_end();
     return true;
   }; 
 
   auto print_remotemode = [&](){
     if (len<1) return false;
-    print_hdr_line(be, F("M_R_REMOTEMODE"));
+    print_hdr_line(be, REC(M_R_REMOTEMODE));
     uint8_t v = d[0];
-    if (v==0 || v==1) kv_u(F("on"), v);
-    else              kv_u(F("code"), v);
-    Serial.println();
+    if (v==0 || v==1) kv_u(FLD(on), v);
+    else              kv_u(FLD(code), v);
+    kv_end();
     return true;
   };
 
@@ -495,26 +615,26 @@ static bool decode_crossfamily_reads(Backend be, uint8_t ctrl, const uint8_t* d,
       (ctrl==SOLD_02::M_R_TEMPUNIT || ctrl==SOLD_01::M_R_TEMPUNIT)){
     if (len>=1){
       uint8_t u=d[0];
-      const char* n = (u==0||u==1) ? tempunit_name(u)
-                     : (u=='C'||u=='c') ? "CELSIUS"
-                     : (u=='F'||u=='f') ? "FAHRENHEIT" : nullptr;
-      print_hdr_line(be, F("M_R_TEMPUNIT"));
-      if(n) kv_s(F("unit"), String(n));
-      kv_u(F("code"), u);
-      Serial.println();
+      const __FlashStringHelper* n = (u==0||u==1) ? tempunit_name(u)
+                     : (u=='C'||u=='c') ? tempunit_name(0)
+                     : (u=='F'||u=='f') ? tempunit_name(1) : nullptr;
+      print_hdr_line(be, REC(M_R_TEMPUNIT));
+      if(n) kv_fs(FLD(unit), n);
+      kv_u(FLD(code), u);
+      kv_end();
       return true;
     }
   }
   if (be==BK_HA && ctrl==HA_02::M_R_TEMPUNIT){
     if (len>=1){
       uint8_t u=d[0];
-      const char* n = (u==0||u==1) ? tempunit_name(u)
-                     : (u=='C'||u=='c') ? "CELSIUS"
-                     : (u=='F'||u=='f') ? "FAHRENHEIT" : nullptr;
-      print_hdr_line(be, F("M_R_TEMPUNIT"));
-      if(n) kv_s(F("unit"), String(n));
-      kv_u(F("code"), u);
-      Serial.println();
+      const __FlashStringHelper* n = (u==0||u==1) ? tempunit_name(u)
+                     : (u=='C'||u=='c') ? tempunit_name(0)
+                     : (u=='F'||u=='f') ? tempunit_name(1) : nullptr;
+      print_hdr_line(be, REC(M_R_TEMPUNIT));
+      if(n) kv_fs(FLD(unit), n);
+      kv_u(FLD(code), u);
+      kv_end();
       return true;
     } 
   }
@@ -522,16 +642,16 @@ static bool decode_crossfamily_reads(Backend be, uint8_t ctrl, const uint8_t* d,
   // ----- LANGUAGE -----
   if ((be==BK_SOLD || be==BK_SOLD1) &&
       (ctrl==SOLD_02::M_R_LANGUAGE || ctrl==SOLD_01::M_R_LANGUAGE)){
-    print_hdr_line(be, F("M_R_LANGUAGE"));
-    if (len>=2){ if(const char* n=language_from_ascii(d,len)){ kv_s(F("name"), String(n)); kv_fs(F("src"), F("ASCII")); Serial.println(); return true; } }
-    if (len>=1){ if(const char* n=language_from_code(d[0]))   { kv_s(F("name"), String(n)); kv_fs(F("src"), F("CODE"));  Serial.println(); return true; } }
-    Serial.print(F(" raw=")); print_hex(d,len); Serial.println(); return true; 
+    print_hdr_line(be, REC(M_R_LANGUAGE));
+    if (len>=2){ if(const __FlashStringHelper* n=language_from_ascii(d,len)){ kv_fs(FLD(name), n); kv_fs(FLD(src), F("ASCII")); kv_end(); return true; } }
+    if (len>=1){ if(const __FlashStringHelper* n=language_from_code(d[0]))   { kv_fs(FLD(name), n); kv_fs(FLD(src), F("CODE"));  kv_end(); return true; } }
+    kv_raw(FLD(raw), d, len); kv_end(); return true; 
   }
   if (be==BK_HA && ctrl==HA_02::M_R_LANGUAGE){
-    print_hdr_line(be, F("M_R_LANGUAGE"));
-    if (len>=2){ if(const char* n=language_from_ascii(d,len)){ kv_s(F("name"), String(n)); kv_fs(F("src"), F("ASCII")); Serial.println(); return true; } }
-    if (len>=1){ if(const char* n=language_from_code(d[0]))   { kv_s(F("name"), String(n)); kv_fs(F("src"), F("CODE"));  Serial.println(); return true; } }
-    Serial.print(F(" raw=")); print_hex(d,len); Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_LANGUAGE));
+    if (len>=2){ if(const __FlashStringHelper* n=language_from_ascii(d,len)){ kv_fs(FLD(name), n); kv_fs(FLD(src), F("ASCII")); kv_end(); return true; } }
+    if (len>=1){ if(const __FlashStringHelper* n=language_from_code(d[0]))   { kv_fs(FLD(name), n); kv_fs(FLD(src), F("CODE"));  kv_end(); return true; } }
+    kv_raw(FLD(raw), d, len); kv_end(); return true;
   }
 
   // ----- USB_CONNECTSTATUS (alle Familien) -----
@@ -556,20 +676,20 @@ static bool decode_crossfamily_reads(Backend be, uint8_t ctrl, const uint8_t* d,
   if (be==BK_SF && ctrl==SF_02::M_R_PIN) return print_pin();
 
   // ----- PINENABLED -----
-  if (be==BK_HA && ctrl==HA_02::M_R_PINENABLED && len>=1){ print_hdr_line(be, F("M_R_PINENABLED")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (be==BK_FE && ctrl==FE_02::M_R_PINENABLED && len>=1){ print_hdr_line(be, F("M_R_PINENABLED")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (be==BK_SF && ctrl==SF_02::M_R_PINENABLED && len>=1){ print_hdr_line(be, F("M_R_PINENABLED")); kv_u(F("on"), d[0]); Serial.println(); return true; }
+  if (be==BK_HA && ctrl==HA_02::M_R_PINENABLED && len>=1){ print_hdr_line(be, REC(M_R_PINENABLED)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (be==BK_FE && ctrl==FE_02::M_R_PINENABLED && len>=1){ print_hdr_line(be, REC(M_R_PINENABLED)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (be==BK_SF && ctrl==SF_02::M_R_PINENABLED && len>=1){ print_hdr_line(be, REC(M_R_PINENABLED)); kv_u(FLD(on), d[0]); kv_end(); return true; }
 
   // ----- STATIONLOCKED -----
-  if (be==BK_HA && ctrl==HA_02::M_R_STATIONLOCKED && len>=1){ print_hdr_line(be, F("M_R_STATIONLOCKED")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (be==BK_FE && ctrl==FE_02::M_R_STATIONLOCKED && len>=1){ print_hdr_line(be, F("M_R_STATIONLOCKED")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (be==BK_SF && ctrl==SF_02::M_R_STATIONLOCKED && len>=1){ print_hdr_line(be, F("M_R_STATIONLOCKED")); kv_u(F("on"), d[0]); Serial.println(); return true; }
+  if (be==BK_HA && ctrl==HA_02::M_R_STATIONLOCKED && len>=1){ print_hdr_line(be, REC(M_R_STATIONLOCKED)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (be==BK_FE && ctrl==FE_02::M_R_STATIONLOCKED && len>=1){ print_hdr_line(be, REC(M_R_STATIONLOCKED)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (be==BK_SF && ctrl==SF_02::M_R_STATIONLOCKED && len>=1){ print_hdr_line(be, REC(M_R_STATIONLOCKED)); kv_u(FLD(on), d[0]); kv_end(); return true; }
 
   // ----- BEEP -----
-  if ((be==BK_SOLD || be==BK_SOLD1) && (ctrl==SOLD_02::M_R_BEEP || ctrl==SOLD_01::M_R_BEEP) && len>=1){ print_hdr_line(be, F("BEEP")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (be==BK_HA && ctrl==HA_02::M_R_BEEP && len>=1){ print_hdr_line(be, F("M_R_BEEP")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (be==BK_FE && ctrl==FE_02::M_R_BEEP && len>=1){ print_hdr_line(be, F("M_R_BEEP")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (be==BK_SF && ctrl==SF_02::M_R_BEEP && len>=1){ print_hdr_line(be, F("M_R_BEEP")); kv_u(F("on"), d[0]); Serial.println(); return true; }
+  if ((be==BK_SOLD || be==BK_SOLD1) && (ctrl==SOLD_02::M_R_BEEP || ctrl==SOLD_01::M_R_BEEP) && len>=1){ print_hdr_line(be, REC(BEEP)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (be==BK_HA && ctrl==HA_02::M_R_BEEP && len>=1){ print_hdr_line(be, REC(M_R_BEEP)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (be==BK_FE && ctrl==FE_02::M_R_BEEP && len>=1){ print_hdr_line(be, REC(M_R_BEEP)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (be==BK_SF && ctrl==SF_02::M_R_BEEP && len>=1){ print_hdr_line(be, REC(M_R_BEEP)); kv_u(FLD(on), d[0]); kv_end(); return true; }
 
   // ----- REMOTEMODE (jetzt SOLDER/SOLDER_01 + HA + PH) -----
   if ((be==BK_SOLD || be==BK_SOLD1) && (ctrl==SOLD_02::M_R_REMOTEMODE || ctrl==SOLD_01::M_R_REMOTEMODE)) return print_remotemode();
@@ -580,45 +700,45 @@ static bool decode_crossfamily_reads(Backend be, uint8_t ctrl, const uint8_t* d,
   if (ctrl==SOLD_02::M_R_TOOLERROR || ctrl==SOLD_01::M_R_TOOLERROR || ctrl==HA_02::M_R_TOOLERROR){
     if (len >= 1){
       uint8_t code = d[0];
-      print_hdr_line(be, F("M_R_TOOLERROR"));
-      kv_hex(F("code"), code, 2);
-      if (const __FlashStringHelper* n = tool_error_name_fam(be, code)) kv_fs(F("name"), n);
-      Serial.println();
+      print_hdr_line(be, REC(M_R_TOOLERROR));
+      kv_hex(FLD(code), code, 2);
+      if (const __FlashStringHelper* n = tool_error_name_fam(be, code)) kv_fs(FLD(name), n);
+      kv_end();
       return true;
     }
   }
 
   // ----- ROBOT / RBT: Verbindungs-Config -----
   if (ctrl == jbc_cmd::SOLD_02::M_R_RBT_CONNCONFIG) {
-    print_hdr_line(be, F("M_R_RBT_CONNCONFIG"));
-    if (len < 5) { kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+    print_hdr_line(be, REC(M_R_RBT_CONNCONFIG));
+    if (len < 5) { kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
 
     // 0) Baud aus Code
     const uint8_t sc = d[0];
-    static const uint32_t BAUDS[] = { 1200, 2400, 4800, 9600, 19200, 38400, 57600, 115200,230400,250000 };
+    static const uint32_t BAUDS[] PROGMEM = { 1200, 2400, 4800, 9600, 19200, 38400, 57600, 115200,230400,250000 };
     const uint8_t nBauds = sizeof(BAUDS)/sizeof(BAUDS[0]);
-    const uint32_t baud = (sc < nBauds) ? BAUDS[sc] : 0;
+    const uint32_t baud = (sc < nBauds) ? pgm_read_dword(&BAUDS[sc]) : 0;
 
-    kv_u(F("speed_code"), sc);
-    if (baud) kv_u(F("baud"), baud); else kv_fs(F("baud"), F("?"));
+    kv_u(FLD(speed_code), sc);
+    if (baud) kv_u(FLD(baud), baud); else kv_none(FLD(baud), F("?"));
 
     // 1) Datenbits (ASCII)
     uint8_t databits = (d[1] >= '0' && d[1] <= '9') ? uint8_t(d[1] - '0') : d[1];
-    kv_u(F("databits"), databits);
+    kv_u(FLD(databits), databits);
 
     // 2) Parität (ASCII)
     char p = (char)d[2]; if (p>='a' && p<='z') p -= 32;
     const __FlashStringHelper* pname =
         (p=='N')?F("NONE"):(p=='E')?F("EVEN"):(p=='O')?F("ODD"):(p=='M')?F("MARK"):(p=='S')?F("SPACE"):nullptr;
-    if (pname) kv_fs(F("parity"), pname); else kv_hex(F("parity_raw"), (uint8_t)d[2], 2);
+    if (pname) kv_fs(FLD(parity), pname); else kv_hex(FLD(parity_raw), (uint8_t)d[2], 2);
 
     // 3) Stopbits (ASCII '0'/'1')
     uint8_t stopbits = (d[3] >= '0' && d[3] <= '9') ? uint8_t(d[3] - '0') : 0xFF;
-    if (stopbits != 0xFF) kv_u(F("stopbits"), stopbits); else kv_hex(F("stopbits_raw"), d[3], 2);
+    if (stopbits != 0xFF) kv_u(FLD(stopbits), stopbits); else kv_hex(FLD(stopbits_raw), d[3], 2);
 
     // 4) Addressing EIN/AUS (ASCII '0'/'1')
     uint8_t addr_en = (d[4] >= '0' && d[4] <= '9') ? uint8_t(d[4] - '0') : 0xFF;
-    if (addr_en != 0xFF) kv_u(F("addr_enabled"), addr_en); else kv_hex(F("addr_enabled_raw"), d[4], 2);
+    if (addr_en != 0xFF) kv_u(FLD(addr_enabled), addr_en); else kv_hex(FLD(addr_enabled_raw), d[4], 2);
 
     // 5) Adresse aus den letzten 1–2 ASCII-Ziffern zusammensetzen
     uint8_t tail_len = (len > 5) ? (uint8_t)(len - 5) : 0;
@@ -630,30 +750,30 @@ static bool decode_crossfamily_reads(Backend be, uint8_t ctrl, const uint8_t* d,
     }
 
     if (addr >= 0) {
-      kv_u(F("addr"), (uint32_t)addr);
+      kv_u(FLD(addr), (uint32_t)addr);
     }
 
     // falls noch mehr als 2 Bytes Tail übrig sind, zur Diagnose zeigen
     if (tail_len > 2) {
-      kv_s(F("tail"), hex_string(&d[5], (uint8_t)(len-5)));
+      kv_s(FLD(tail), hex_string(&d[5], (uint8_t)(len-5)));
     }
 
-    Serial.println();
+    kv_end();
     return true;
   }
 
   // ----- ROBOT / RBT: Connect-Status (ein Buchstabe) -----
   if (ctrl == jbc_cmd::SOLD_02::M_R_RBT_CONNECTSTATUS) {
-    print_hdr_line(be, F("M_R_RBT_CONNECTSTATUS"));
-    if (!len) { kv_fs(F("state"), F("")); Serial.println(); return true; }
+    print_hdr_line(be, REC(M_R_RBT_CONNECTSTATUS));
+    if (!len) { kv_fs(FLD(state), F("")); kv_end(); return true; }
     char c = (char)d[0]; if (c>='a' && c<='z') c -= 32;
     const __FlashStringHelper* s =
         (c=='C')?F("CONNECTED") :
         (c=='N')?F("NOT_CONNECTED") :
         (c=='O')?F("OPEN") :
         (c=='K')?F("OK") : nullptr;
-    if (s) kv_fs(F("state"), s); else kv_hex(F("state_char"), (uint8_t)d[0], 2);
-    Serial.println();
+    if (s) kv_fs(FLD(state), s); else kv_hex(FLD(state_char), (uint8_t)d[0], 2);
+    kv_end();
     return true;
   }
 
@@ -667,134 +787,27 @@ static bool decode_crossfamily_reads(Backend be, uint8_t ctrl, const uint8_t* d,
 static bool decode_connecttool(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t len){
   using namespace jbc_cmd;
   if (ctrl==SOLD_02::M_R_CONNECTTOOL || ctrl==SOLD_01::M_R_CONNECTTOOL || ctrl==HA_02::M_R_CONNECTTOOL){
-     if(len==0){ print_hdr_line(be, F("M_R_CONNECTTOOL")); kv_fs(F("name"), F("")); Serial.println(); return true; }
+     if(len==0){ print_hdr_line(be, REC(M_R_CONNECTTOOL)); kv_fs(FLD(name), F("")); kv_end(); return true; }
     uint8_t code = d[0];
 
     const __FlashStringHelper* tn = nullptr;
     if (be == BK_HA) tn = ha_tool_name(code);
     else             tn = sold_tool_name(code);
 
-    print_hdr_line(be, F("M_R_CONNECTTOOL"));
-    kv_hex(F("code"), code, 2);
-    if (tn) kv_fs(F("name"), tn); else kv_fs(F("name"), F("UNKNOWN"));
-    Serial.println();    
+    print_hdr_line(be, REC(M_R_CONNECTTOOL));
+    kv_hex(FLD(code), code, 2);
+    if (tn) kv_fs(FLD(name), tn); else kv_fs(FLD(name), F("UNKNOWN"));
+    kv_end();    
     return true;
   }
   return false;
 }
 
-// Gibt die SOLD-Flags als "NAME|NAME|…" oder "NONE" zurück (keine Ausgabe!)
-static String sold_status_to_string(uint8_t f){
-  String out; auto add=[&](const char* n){ if(out.length()) out+='|'; out+=n; };
-  if (f & 0x01) add("STAND");
-  if (f & 0x02) add("SLEEP");
-  if (f & 0x04) add("HIBERNATION");
-  if (f & 0x08) add("EXTRACTOR");
-  if (f & 0x10) add("DESOLDER");
-  if (f & 0x20) add("PORT_LOCKED");   
-  // Rest generisch:
-  for (uint8_t b=6; b<8; ++b) if (f & (1u<<b)){ if(out.length()) out+='|'; out += String("BIT")+String(b); }
-  if (!out.length()) out = "NONE";
-  return out;
-}
-
-// ---- helper: HA status bits -> "NAME|NAME|..." ----
-static String ha_status_to_string(uint8_t s){
-  String out; auto add=[&](const char* n){ if(out.length()) out+='|'; out+=n; };
-  if (s & 0x01) add("HEATER");
-  if (s & 0x02) add("HEATER_REQUESTED");
-  if (s & 0x04) add("COOLING");
-  if (s & 0x08) add("SUCTION");
-  if (s & 0x10) add("SUCTION_REQUESTED");
-  if (s & 0x20) add("PEDAL_CONNECTED");
-  if (s & 0x40) add("PEDAL_PRESSED");
-  if (s & 0x80) add("STAND");
-  if (!out.length()) out = "NONE";
-  return out;
-}
-
-
-// 16-bit STATUSTOOL-Maske → "NAME|NAME|..." (SOLDER/SOLDER1)
-static String sold_statustool_bits_to_string(uint16_t v){
-  String out; auto add=[&](const char* n){ if(out.length()) out+='|'; out+=n; };
-
-  if (v & 0x0001) add("STAND");
-  if (v & 0x0002) add("SLEEP");
-  if (v & 0x0004) add("HIBERNATION");
-  if (v & 0x0008) add("EXTRACTOR");
-  if (v & 0x0010) add("DESOLDER");        
-  if (v & 0x0020) add("PORT_LOCKED");     
-  if (v & 0x0100) add("DESOLDER_TOOL");   
-
-  // Unbekannte gesetzte Bits ergänzen
-  const uint16_t known = 0x0001|0x0002|0x0004|0x0008|0x0010|0x0020|0x0100;
-  for (uint8_t b=0; b<16; ++b){
-    uint16_t m = (uint16_t)1u<<b;
-    if ((v & m) && !(known & m)){
-      if(out.length()) out+='|';
-      out += String("BIT") + String(b);
-    }
-  }
-  if (!out.length()) out = "NONE";
-  return out;
-}
-
-
-static String sold_changes_to_string(uint8_t c){
-  String out; auto add=[&](const char* n){ if(out.length()) out+='|'; out+=n; };
-  if (c & (1u<<0)) add("SELECTTEMP_CHANGED");
-  if (c & (1u<<1)) add("STATION_PARAM_CHANGED");
-  if (c & (1u<<2)) add("TOOL_PARAM_GRP0_CHANGED");
-  if (c & (1u<<3)) add("TOOL_PARAM_GRP1_CHANGED");
-  if (c & (1u<<4)) add("TOOL_PARAM_GRP2_CHANGED");
-  if (c & (1u<<5)) add("TOOL_PARAM_GRP3_CHANGED");
-  if (c & (1u<<7)) add("COUNTER_CHANGED");
-  for (uint8_t b=0; b<8; ++b){
-    if ((c & (1u<<b)) && b!=0 && b!=1 && b!=2 && b!=3 && b!=4 && b!=5 && b!=7){
-      if(out.length()) out+='|'; out += String("BIT")+String(b);
-    }
-  }
-  if (!out.length()) out = "NONE";
-  return out;
-}
-
-
-// --- Status-Namen je Familie für M_INF_PORT::status ---
-static const char* sold_status_name(uint8_t s){
-  switch(s){
-    case 0:  return "NONE";
-    case 1:  return "STAND";
-    case 2:  return "SLEEP";
-    case 4:  return "HIBERNATION";
-    case 8:  return "EXTRACTOR";
-    case 16: return "DESOLDER";
-    default: return nullptr;
-  }
-}
-
-
-
-static void sold_changes_print(uint8_t c){
-  struct { uint8_t bit; const char* name; } B[] = {
-    {0, "SELECTTEMP_CHANGED"},
-    {1, "STATION_PARAM_CHANGED"},
-    {2, "TOOL_PARAM_GRP0_CHANGED"},
-    {3, "TOOL_PARAM_GRP1_CHANGED"},
-    {4, "TOOL_PARAM_GRP2_CHANGED"},
-    {5, "TOOL_PARAM_GRP3_CHANGED"},
-    {7, "COUNTER_CHANGED"},
-  };
-  bool any=false;
-  Serial.print(F("  changesText="));
-  for (auto &b : B){
-    if (c & (1u<<b.bit)){ if(any) Serial.print('|'); Serial.print(b.name); any=true; }
-  }
-  for(uint8_t b=0;b<8;b++){
-    if ((c & (1u<<b)) && b!=0 && b!=1 && b!=2 && b!=3 && b!=4 && b!=5 && b!=7){
-      if(any) Serial.print('|'); Serial.print(F("BIT")); Serial.print(b); any=true;
-    }
-  }
-  if(!any) Serial.println(F("NONE")); else Serial.println();
+// --- Status-Namen je Familie für M_INF_PORT::status (0 oder genau ein Bit) ---
+static const __FlashStringHelper* sold_status_name(uint8_t s){
+  if (s == 0) return F("NONE");
+  for (uint8_t b=0; b<5; ++b) if (s == (1u<<b)) return pgm_name(BT_SOLD_STATUS, b);
+  return nullptr;
 }
 
 // ---------- SOLD-spezifische Extras ----------
@@ -809,17 +822,17 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
     uint8_t l2_on=d[5];  uint16_t l2_uti=U16LE(d[6],d[7]);
     uint8_t l3_on=d[8];  uint16_t l3_uti=U16LE(d[9],d[10]);
 
-    print_hdr_line(be, F("M_R_LEVELSTEMPS"));
-    kv_u(F("on"), onoff); kv_u(F("sel"), sel);
-    kv_u(F("l1_on"), l1_on); kv_c(F("l1_c"), l1_uti/9.0f, 1); kv_hex(F("l1_uti"), l1_uti, 4);
-    kv_u(F("l2_on"), l2_on); kv_c(F("l2_c"), l2_uti/9.0f, 1); kv_hex(F("l2_uti"), l2_uti, 4);
-    kv_u(F("l3_on"), l3_on); kv_c(F("l3_c"), l3_uti/9.0f, 1); kv_hex(F("l3_uti"), l3_uti, 4);
+    print_hdr_line(be, REC(M_R_LEVELSTEMPS));
+    kv_u(FLD(on), onoff); kv_u(FLD(sel), sel);
+    kv_u(FLD(l1_on), l1_on); kv_fix(FLD(l1_c), uti_to_dc(l1_uti), 1); kv_hex(FLD(l1_uti), l1_uti, 4);
+    kv_u(FLD(l2_on), l2_on); kv_fix(FLD(l2_c), uti_to_dc(l2_uti), 1); kv_hex(FLD(l2_uti), l2_uti, 4);
+    kv_u(FLD(l3_on), l3_on); kv_fix(FLD(l3_c), uti_to_dc(l3_uti), 1); kv_hex(FLD(l3_uti), l3_uti, 4);
     if (len >= 13){
       uint8_t port=d[11], tool=d[12];
-      kv_u(F("port"), port); kv_u(F("tool"), tool);
-      if (const __FlashStringHelper* tn = sold_tool_name(tool)) kv_fs(F("tool_name"), tn);
+      kv_u(FLD(port), port); kv_u(FLD(tool), tool);
+      if (const __FlashStringHelper* tn = sold_tool_name(tool)) kv_fs(FLD(tool_name), tn);
     }
-    Serial.println();
+    kv_end();
     return true;
   }
 
@@ -831,30 +844,30 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
     int16_t  adj400=s16le(&d[5]);
     uint8_t  group=d[7], family=d[8], port=d[9], tool=d[10];
 
-    print_hdr_line(be, F("M_R_CARTRIDGE"));
-    kv_u(F("on"), onoff);
-    kv_u(F("nbr"), nbr);
-    kv_c(F("adj300_c"), adj300/9.0f, 1);
-    kv_c(F("adj400_c"), adj400/9.0f, 1);
-    kv_u(F("group"), group);
-    kv_u(F("family"), family);
-    kv_u(F("port"), port);
-    kv_u(F("tool"), tool);
-    if (const __FlashStringHelper* tn = sold_tool_name(tool)) kv_fs(F("tool_name"), tn);
-    Serial.println();
+    print_hdr_line(be, REC(M_R_CARTRIDGE));
+    kv_u(FLD(on), onoff);
+    kv_u(FLD(nbr), nbr);
+    kv_fix(FLD(adj300_c), uti_to_dc(adj300), 1);
+    kv_fix(FLD(adj400_c), uti_to_dc(adj400), 1);
+    kv_u(FLD(group), group);
+    kv_u(FLD(family), family);
+    kv_u(FLD(port), port);
+    kv_u(FLD(tool), tool);
+    if (const __FlashStringHelper* tn = sold_tool_name(tool)) kv_fs(FLD(tool_name), tn);
+    kv_end();
     return true;
   }
 
   // SLEEPDELAY / HIBERDELAY  (val, on, port, tool)
   if ((ctrl == SOLD_02::M_R_SLEEPDELAY || ctrl == SOLD_02::M_R_HIBERDELAY) && len >= 4){
-    const __FlashStringHelper* tag = (ctrl==SOLD_02::M_R_SLEEPDELAY) ? F("M_R_SLEEPDELAY") : F("M_R_HIBERDELAY");
+    jbc_bin::Key tag = (ctrl==SOLD_02::M_R_SLEEPDELAY) ? REC(M_R_SLEEPDELAY) : REC(M_R_HIBERDELAY);
     print_hdr_line(be, tag);
-    kv_u(F("min"), d[0]);
-    kv_u(F("on"),  d[1]);
-    kv_u(F("port"),d[2]);
-    kv_u(F("tool"),d[3]);
-    if (const __FlashStringHelper* tn = sold_tool_name(d[3])) kv_fs(F("tool_name"), tn);
-    Serial.println();
+    kv_u(FLD(min), d[0]);
+    kv_u(FLD(on),  d[1]);
+    kv_u(FLD(port),d[2]);
+    kv_u(FLD(tool),d[3]);
+    if (const __FlashStringHelper* tn = sold_tool_name(d[3])) kv_fs(FLD(tool_name), tn);
+    kv_end();
     return true;
   }
 
@@ -862,65 +875,64 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
 
   // --- SLEEPTEMP (tempLE,port,tool)  UTI = °C*9 ---
   if (ctrl == SOLD_02::M_R_SLEEPTEMP && len>=4){
-    print_hdr_line(be, F("M_R_SLEEPTEMP"));
-    uint16_t v=u16le(d); kv_c(F("c"), uti_to_c(v), 1); kv_hex(F("uti"), v, 4);
-    kv_u(F("port"), d[2]); kv_u(F("tool"), d[3]);
-    if (const __FlashStringHelper* tn = sold_tool_name(d[3])) kv_fs(F("tool_name"), tn);
-    Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_SLEEPTEMP));
+    uint16_t v=u16le(d); kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v, 4);
+    kv_u(FLD(port), d[2]); kv_u(FLD(tool), d[3]);
+    if (const __FlashStringHelper* tn = sold_tool_name(d[3])) kv_fs(FLD(tool_name), tn);
+    kv_end(); return true;
   }
 
   // --- AJUSTTEMP (deltaLE(int16),port,tool)  UTI = °C*9 ---
   if (ctrl == SOLD_02::M_R_AJUSTTEMP && len>=4){
-    print_hdr_line(be, F("M_R_AJUSTTEMP"));
-    kv_c(F("delta_c"), (int16_t)u16le(d)/9.0f, 1);
-    kv_u(F("port"), d[2]); kv_u(F("tool"), d[3]);
-    if (const __FlashStringHelper* tn = sold_tool_name(d[3])) kv_fs(F("tool_name"), tn);
-    Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_AJUSTTEMP));
+    kv_fix(FLD(delta_c), uti_to_dc((int16_t)u16le(d)), 1);
+    kv_u(FLD(port), d[2]); kv_u(FLD(tool), d[3]);
+    if (const __FlashStringHelper* tn = sold_tool_name(d[3])) kv_fs(FLD(tool_name), tn);
+    kv_end(); return true;
   }
 
 
   // Interne Temps
   if ((ctrl==SOLD_02::M_R_TRAFOTEMP || ctrl==SOLD_01::M_R_TRAFOTEMP) && len>=2){
-    print_hdr_line(be, F("M_R_TRAFOTEMP")); uint16_t v=u16le(d);
-    kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v,4); Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_TRAFOTEMP)); uint16_t v=u16le(d);
+    kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v,4); kv_end(); return true;
   }
   if ((ctrl==SOLD_02::M_R_MOSTEMP || ctrl==SOLD_01::M_R_MOSTEMP) && len>=2){
-    print_hdr_line(be, F("M_R_MOSTEMP")); uint16_t v=u16le(d);
-    kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v,4); Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_MOSTEMP)); uint16_t v=u16le(d);
+    kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v,4); kv_end(); return true;
   }
 
   // --- POWER (% aus Promille), optional mit port/tool ---
   if ((ctrl == SOLD_02::M_R_POWER || ctrl == SOLD_01::M_R_POWER) && len >= 2){
     uint16_t raw = u16le(d);
     uint16_t ppm = raw > 1000 ? 1000 : raw;   // clamp 0..1000
-    print_hdr_line(be, F("M_R_POWER"));
-    kv_c(F("pct"), ppm / 10.0f, 1);
-    kv_u(F("raw"), raw);
+    print_hdr_line(be, REC(M_R_POWER));
+    kv_fix(FLD(pct), ppm, 1);
+    kv_u(FLD(raw), raw);
 
     
-    Serial.println();
+    kv_end();
     return true;
   }
 
 
   // QST_STATUS
   if (ctrl==SOLD_02::M_R_QST_STATUS || ctrl==SOLD_01::M_R_QST_STATUS){
-    print_hdr_line(be, F("M_R_QST_STATUS"));
-    if (!len){ kv_fs(F("state"), F("")); Serial.println(); return true; }
+    print_hdr_line(be, REC(M_R_QST_STATUS));
+    if (!len){ kv_fs(FLD(state), F("")); kv_end(); return true; }
 
     if (len==1 && (d[0]==0 || d[0]==1)){
-      kv_u(F("on"), d[0]); Serial.println(); return true;
+      kv_u(FLD(on), d[0]); kv_end(); return true;
     }
 
     const uint16_t v = (len>=2) ? u16le(d) : d[0];
-    kv_hex(F("mask"), v, (len>=2)?4:2);
+    kv_hex(FLD(mask), v, (len>=2)?4:2);
 
     // hübscher Bits-String
     if (len>=2){
-      String bits = sold_statustool_bits_to_string(v);
-      kv_s(F("bits"), bits);
+      kv_bits(F("bits"), BT_SOLD_STATUSTOOL, v, 16, BITS_UNNAMED);
     }
-    Serial.println();
+    kv_end();
     return true;
   }
 
@@ -932,24 +944,24 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
     uint8_t tag  = d[2];
     uint8_t port = d[3];
 
-    print_hdr_line(be, F("M_R_DELAYTIME"));
+    print_hdr_line(be, REC(M_R_DELAYTIME));
 
     // hübsch als mm:ss
     char mmss[6];
     uint16_t mm = secs / 60;
     uint8_t  ss = secs % 60;
     snprintf(mmss, sizeof(mmss), "%02u:%02u", (unsigned)mm, ss);
-    kv_s(F("mmss"), String(mmss));
-    kv_u(F("sec"), secs);
-    kv_hex(F("tag"), tag, 2);
+    kv_s(FLD(mmss), String(mmss));
+    kv_u(FLD(sec), secs);
+    kv_hex(FLD(tag), tag, 2);
 
     // Tag -> Name
-    if (tag == 'S')      kv_fs(F("next"), F("SLEEP"));
-    else if (tag == 'H') kv_fs(F("next"), F("HIBERNATION"));
-    else if (tag == 'N' || secs == 0) kv_fs(F("next"), F("NONE"));
+    if (tag == 'S')      kv_fs(FLD(next), F("SLEEP"));
+    else if (tag == 'H') kv_fs(FLD(next), F("HIBERNATION"));
+    else if (tag == 'N' || secs == 0) kv_fs(FLD(next), F("NONE"));
 
-    kv_u(F("port"), port);
-    Serial.println();
+    kv_u(FLD(port), port);
+    kv_end();
     return true;
   }
 
@@ -957,24 +969,24 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
 
   // ETH TCP/IP Config
   if (ctrl==SOLD_02::M_R_ETH_TCPIPCONFIG){
-    print_hdr_line(be, F("M_R_ETH_TCPIPCONFIG"));
-    if (len < 19){ kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+    print_hdr_line(be, REC(M_R_ETH_TCPIPCONFIG));
+    if (len < 19){ kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
     auto ip2s = [](const uint8_t* p){ return String((uint8_t)p[0])+"."+String((uint8_t)p[1])+"."+String((uint8_t)p[2])+"."+String((uint8_t)p[3]); };
-    kv_u(F("dhcp"), d[0]); kv_s(F("ip"), ip2s(&d[1])); kv_s(F("mask"), ip2s(&d[5]));
-    kv_s(F("gw"), ip2s(&d[9])); kv_s(F("dns"), ip2s(&d[13])); kv_u(F("port"), u16le(&d[17]));
-    Serial.println(); return true;
+    kv_u(FLD(dhcp), d[0]); kv_s(FLD(ip), ip2s(&d[1])); kv_s(FLD(mask), ip2s(&d[5]));
+    kv_s(FLD(gw), ip2s(&d[9])); kv_s(FLD(dns), ip2s(&d[13])); kv_u(FLD(port), u16le(&d[17]));
+    kv_end(); return true;
   }
 
   // ETH Connect-Status (roh)
   if (ctrl==SOLD_02::M_R_ETH_CONNECTSTATUS){
-    print_hdr_line(be, F("M_R_ETH_CONNECTSTATUS")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_ETH_CONNECTSTATUS)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true;
   }
 
   // --- ALARME: MAX/MIN/aktuelle Temp ---
   if (ctrl == SOLD_02::M_R_ALARMMAXTEMP || ctrl == SOLD_02::M_R_ALARMMINTEMP) {
-    const __FlashStringHelper* tag = (ctrl==SOLD_02::M_R_ALARMMAXTEMP) ? F("M_R_ALARM_MAXTEMP")
-                                                                      : F("M_R_ALARM_MINTEMP");
-    if (len < 2) { print_hdr_line(be, tag); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+    jbc_bin::Key tag = (ctrl==SOLD_02::M_R_ALARMMAXTEMP) ? REC(M_R_ALARM_MAXTEMP)
+                                                         : REC(M_R_ALARM_MINTEMP);
+    if (len < 2) { print_hdr_line(be, tag); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
 
     const uint16_t uti   = u16le(d);           // Schwelle (UTI)
     const bool     off   = (uti == 0xFFFF);    // UTI=0xFFFF => deaktiviert
@@ -982,40 +994,40 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
     const uint8_t  port  = hasPt ? d[4] : 0xFF;
 
     print_hdr_line(be, tag);
-    kv_hex(F("uti"), uti, 4);
-    if (!off) kv_c(F("c"), uti_to_c(uti), 1);
-    kv_fs(F("state"), off ? F("DISABLED") : F("ENABLED"));
-    if (hasPt) kv_u(F("port"), port);
+    kv_hex(FLD(uti), uti, 4);
+    if (!off) kv_fix(FLD(c), uti_to_dc(uti), 1);
+    kv_fs(FLD(state), off ? F("DISABLED") : F("ENABLED"));
+    if (hasPt) kv_u(FLD(port), port);
     // d[2]/d[3] sind hier kein Tool; evtl. reserviert → nicht ausgeben
-    Serial.println();
+    kv_end();
     return true;
   }
 
   if (ctrl == SOLD_02::M_R_ALARMTEMP) {
-    if (len < 2) { print_hdr_line(be, F("M_R_ALARM_TEMP")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+    if (len < 2) { print_hdr_line(be, REC(M_R_ALARM_TEMP)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
     const uint16_t uti = u16le(d);             // aktuelle/gesetzte Alarmtemperatur
-    print_hdr_line(be, F("M_R_ALARM_TEMP"));
-    kv_hex(F("uti"), uti, 4);
-    kv_c(F("c"), uti_to_c(uti), 1);
-    Serial.println();
+    print_hdr_line(be, REC(M_R_ALARM_TEMP));
+    kv_hex(FLD(uti), uti, 4);
+    kv_fix(FLD(c), uti_to_dc(uti), 1);
+    kv_end();
     return true;
   }
 
   // --- MAXTEMP / MINTEMP (UTI → °C) ---
   if ((ctrl == SOLD_02::M_R_MAXTEMP || ctrl == SOLD_01::M_R_MAXTEMP) && len >= 2) {
     const uint16_t v = u16le(d);
-    print_hdr_line(be, F("M_R_MAXTEMP"));
-    kv_c (F("c"),  uti_to_c(v), 1);
-    kv_hex(F("uti"), v, 4);
-    Serial.println();
+    print_hdr_line(be, REC(M_R_MAXTEMP));
+    kv_fix(FLD(c), uti_to_dc(v), 1);
+    kv_hex(FLD(uti), v, 4);
+    kv_end();
     return true;
   }
   if ((ctrl == SOLD_02::M_R_MINTEMP || ctrl == SOLD_01::M_R_MINTEMP) && len >= 2) {
     const uint16_t v = u16le(d);
-    print_hdr_line(be, F("M_R_MINTEMP"));
-    kv_c (F("c"),  uti_to_c(v), 1);
-    kv_hex(F("uti"), v, 4);
-    Serial.println();
+    print_hdr_line(be, REC(M_R_MINTEMP));
+    kv_fix(FLD(c), uti_to_dc(v), 1);
+    kv_hex(FLD(uti), v, 4);
+    kv_end();
     return true;
   }
 
@@ -1023,10 +1035,10 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
   if ((ctrl == SOLD_02::M_R_POWERLIM || ctrl == SOLD_01::M_R_POWERLIM) && len >= 2) {
     uint16_t raw = u16le(d);
     if (raw > 1000) raw = 1000;            // clamp 0..1000
-    print_hdr_line(be, F("M_R_POWERLIM"));
-    kv_c(F("pct"), raw / 10.0f, 1);        // z. B. 1000 → 100.0 %
-    kv_u(F("raw"), raw);
-    Serial.println();
+    print_hdr_line(be, REC(M_R_POWERLIM));
+    kv_fix(FLD(pct), raw, 1);        // z. B. 1000 → 100.0 %
+    kv_u(FLD(raw), raw);
+    kv_end();
     return true;
   }
 
@@ -1034,30 +1046,30 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
 
   // CONTIMODE
   if (ctrl==SOLD_02::M_R_CONTIMODE || ctrl==SOLD_01::M_R_CONTIMODE){
-    if(len>=1){ uint16_t v=(len>=2)?u16le(d):d[0]; print_hdr_line(be, F("M_R_CONTIMODE")); kv_hex(F("mask"), v,4); Serial.println(); return true; }
+    if(len>=1){ uint16_t v=(len>=2)?u16le(d):d[0]; print_hdr_line(be, REC(M_R_CONTIMODE)); kv_hex(FLD(mask), v,4); kv_end(); return true; }
   }
 
   // LOCK_PORT (SOLDER_02 / SOLDER_01)
   // Antwortformat: [ state , port ]  -> state: 1=ON, 0=OFF
   if (ctrl==SOLD_02::M_R_LOCK_PORT || ctrl==SOLD_01::M_R_LOCK_PORT){
-    print_hdr_line(be, F("M_R_LOCK_PORT"));
-    if (len>=2){ kv_u(F("port"), d[1]); kv_u(F("on"), d[0]); }
-    else if (len==1){ kv_u(F("on"), d[0]); }
-    Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_LOCK_PORT));
+    if (len>=2){ kv_u(FLD(port), d[1]); kv_u(FLD(on), d[0]); }
+    else if (len==1){ kv_u(FLD(on), d[0]); }
+    kv_end(); return true;
   }
 
 
 
   // QST_ACTIVATE → ON/OFF
   if (ctrl==SOLD_02::M_R_QST_ACTIVATE || ctrl==SOLD_01::M_R_QST_ACTIVATE){
-    if (len>=1){ print_hdr_line(be, F("M_R_QST_ACTIVATE")); kv_u(F("on"), d[0]); Serial.println(); return true; }
+    if (len>=1){ print_hdr_line(be, REC(M_R_QST_ACTIVATE)); kv_u(FLD(on), d[0]); kv_end(); return true; }
   }
 
   // TYPEOFGROUND
   if (ctrl==SOLD_02::M_R_TYPEOFGROUND && len>=1){
-    print_hdr_line(be, F("M_R_TYPEOFGROUND")); kv_u(F("code"), d[0]);
-    if (const __FlashStringHelper* n = typeofground_name(d[0])) kv_fs(F("name"), n);
-    Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_TYPEOFGROUND)); kv_u(FLD(code), d[0]);
+    if (const __FlashStringHelper* n = typeofground_name(d[0])) kv_fs(FLD(name), n);
+    kv_end(); return true;
   }
 
 
@@ -1066,9 +1078,9 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
   // ---- Staterror
   if (ctrl==SOLD_02::M_R_STATERROR || ctrl==SOLD_01::M_R_STATERROR){
     uint16_t v = len? ((len>=2)?u16le(d):d[0]) : 0;
-    print_hdr_line(be, F("M_R_STATERROR")); kv_hex(F("mask"), v, 4);
-    if (const __FlashStringHelper* sn = station_error_name((uint8_t)(v & 0xFF))) kv_fs(F("lowbyte_name"), sn);
-    Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_STATERROR)); kv_hex(FLD(mask), v, 4);
+    if (const __FlashStringHelper* sn = station_error_name((uint8_t)(v & 0xFF))) kv_fs(FLD(lowbyte_name), sn);
+    kv_end(); return true;
   }
 
 
@@ -1076,25 +1088,25 @@ static bool decode_sold_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8
 
   // Peripherie
   if (ctrl==SOLD_02::M_R_PERIPHCOUNT){
-    print_hdr_line(be, F("M_R_PERIPHCOUNT")); if (len>=1) kv_u(F("count"), d[0]); else kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_PERIPHCOUNT)); if (len>=1) kv_u(FLD(count), d[0]); else kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true;
   }
   
   if (ctrl==SOLD_02::M_R_PERIPHCONFIG){
-    print_hdr_line(be, F("M_R_PERIPHCONFIG"));
-    if (len){ String s = sanitize_ascii(d,len); if(s.length()) kv_s(F("text"), s); else kv_s(F("raw"), hex_string(d,len)); }
-    else kv_fs(F("text"), F(""));
-    Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_PERIPHCONFIG));
+    if (len){ String s = sanitize_ascii(d,len); if(s.length()) kv_s(FLD(text), s); else kv_s(FLD(raw), hex_string(d,len)); }
+    else kv_fs(FLD(text), F(""));
+    kv_end(); return true;
   }
   
   if (ctrl==SOLD_02::M_R_PERIPHSTATUS){
-    print_hdr_line(be, F("M_R_PERIPHSTATUS"));
+    print_hdr_line(be, REC(M_R_PERIPHSTATUS));
     if (len==3){
-      kv_u(F("active"), d[0]); char st=(char)d[1];
-      kv_u(F("idx"), d[2]);
+      kv_u(FLD(active), d[0]); char st=(char)d[1];
+      kv_u(FLD(idx), d[2]);
       const char* stTxt=(st=='C')?"CONNECTED":(st=='O')?"OPEN":(st=='K')?"OK":nullptr;
-      if (stTxt) kv_s(F("state"), String(stTxt)); else kv_hex(F("state_char"), (uint8_t)st, 2);
-    } else { kv_s(F("raw"), hex_string(d,len)); }
-    Serial.println(); return true;
+      if (stTxt) kv_s(FLD(state), String(stTxt)); else kv_hex(FLD(state_char), (uint8_t)st, 2);
+    } else { kv_s(FLD(raw), hex_string(d,len)); }
+    kv_end(); return true;
   }
   
 
@@ -1111,82 +1123,59 @@ static bool decode_sold_counters(Backend be, uint8_t ctrl, const uint8_t* d, uin
     return (L >= 4) ? u32le(p) : 0;
   };
 
-  auto kv_minutes = [&](const __FlashStringHelper* tag){
+  auto kv_minutes = [&](jbc_bin::Key tag){
     if (len < 4){
-      print_hdr_line(be, tag); kv_u(F("payload"), len); kv_s(F("raw"), hex_string(d,len)); Serial.println();
+      print_hdr_line(be, tag); kv_u(FLD(payload), len); kv_s(FLD(raw), hex_string(d,len)); kv_end();
       return true;
     }
     const uint32_t v = read_u32(d, len);
     print_hdr_line(be, tag);
-    kv_u(F("min"), v);
+    kv_u(FLD(min), v);
     // hübsch als H:MM
     uint32_t h = v / 60UL; uint8_t m = (uint8_t)(v % 60UL);
     char buf[6]; snprintf(buf, sizeof(buf), "%lu:%02u", (unsigned long)h, m);
-    kv_s(F("hm"), String(buf));
-    Serial.println();
+    kv_s(FLD(hm), String(buf));
+    kv_end();
     return true;
   };
 
-  auto kv_u32 = [&](const __FlashStringHelper* tag){
+  auto kv_u32 = [&](jbc_bin::Key tag){
     if (len < 4){
-      print_hdr_line(be, tag); kv_u(F("payload"), len); kv_s(F("raw"), hex_string(d,len)); Serial.println();
+      print_hdr_line(be, tag); kv_u(FLD(payload), len); kv_s(FLD(raw), hex_string(d,len)); kv_end();
       return true;
     }
-    print_hdr_line(be, tag); kv_u(F("value"), u32le(d)); Serial.println();
+    print_hdr_line(be, tag); kv_u(FLD(value), u32le(d)); kv_end();
     return true;
   };
 
   switch(ctrl){
     // Gesamt-Zeiten (Minuten)
-    case SOLD_02::M_R_PLUGTIME:     return kv_minutes(F("M_R_PLUGTIME"));
-    case SOLD_02::M_R_WORKTIME:     return kv_minutes(F("M_R_WORKTIME"));
-    case SOLD_02::M_R_SLEEPTIME:    return kv_minutes(F("M_R_SLEEPTIME"));
-    case SOLD_02::M_R_HIBERTIME:    return kv_minutes(F("M_R_HIBERTIME"));
-    case SOLD_02::M_R_NOTOOLTIME:   return kv_minutes(F("M_R_NOTOOLTIME"));
+    case SOLD_02::M_R_PLUGTIME:     return kv_minutes(REC(M_R_PLUGTIME));
+    case SOLD_02::M_R_WORKTIME:     return kv_minutes(REC(M_R_WORKTIME));
+    case SOLD_02::M_R_SLEEPTIME:    return kv_minutes(REC(M_R_SLEEPTIME));
+    case SOLD_02::M_R_HIBERTIME:    return kv_minutes(REC(M_R_HIBERTIME));
+    case SOLD_02::M_R_NOTOOLTIME:   return kv_minutes(REC(M_R_NOTOOLTIME));
 
     // Zyklen
-    case SOLD_02::M_R_SLEEPCYCLES:  return kv_u32(F("M_R_SLEEPCYCLES"));
-    case SOLD_02::M_R_DESOLCYCLES:  return kv_u32(F("M_R_DESOLCYCLES"));
+    case SOLD_02::M_R_SLEEPCYCLES:  return kv_u32(REC(M_R_SLEEPCYCLES));
+    case SOLD_02::M_R_DESOLCYCLES:  return kv_u32(REC(M_R_DESOLCYCLES));
 
     // Partial-Zeiten
-    case SOLD_02::M_R_PLUGTIMEP:    return kv_minutes(F("M_R_PLUGTIMEP"));
-    case SOLD_02::M_R_WORKTIMEP:    return kv_minutes(F("M_R_WORKTIMEP"));
-    case SOLD_02::M_R_SLEEPTIMEP:   return kv_minutes(F("M_R_SLEEPTIMEP"));
-    case SOLD_02::M_R_HIBERTIMEP:   return kv_minutes(F("M_R_HIBERTIMEP"));
-    case SOLD_02::M_R_NOTOOLTIMEP:  return kv_minutes(F("M_R_NOTOOLTIMEP"));
+    case SOLD_02::M_R_PLUGTIMEP:    return kv_minutes(REC(M_R_PLUGTIMEP));
+    case SOLD_02::M_R_WORKTIMEP:    return kv_minutes(REC(M_R_WORKTIMEP));
+    case SOLD_02::M_R_SLEEPTIMEP:   return kv_minutes(REC(M_R_SLEEPTIMEP));
+    case SOLD_02::M_R_HIBERTIMEP:   return kv_minutes(REC(M_R_HIBERTIMEP));
+    case SOLD_02::M_R_NOTOOLTIMEP:  return kv_minutes(REC(M_R_NOTOOLTIMEP));
 
     // Partial-Zyklen
-    case SOLD_02::M_R_SLEEPCYCLESP: return kv_u32(F("M_R_SLEEPCYCLESP"));
-    case SOLD_02::M_R_DESOLCYCLESP: return kv_u32(F("M_R_DESOLCYCLESP"));
+    case SOLD_02::M_R_SLEEPCYCLESP: return kv_u32(REC(M_R_SLEEPCYCLESP));
+    case SOLD_02::M_R_DESOLCYCLESP: return kv_u32(REC(M_R_DESOLCYCLESP));
   }
   return false;
 }
 
 
 // ---------- HA-Extras ----------
-static void ha_changes_print(uint8_t c){
-  struct { uint8_t bit; const char* name; } B[] = {
-    {0, "SELECTTEMP_CHANGED"},
-    {1, "STATION_PARAM_CHANGED"},
-    {2, "TOOL_PARAM_GRP0_CHANGED"},
-    {3, "TOOL_PARAM_GRP1_CHANGED"},
-    {4, "TOOL_PARAM_GRP2_CHANGED"},
-    {5, "TOOL_PARAM_GRP3_CHANGED"},
-    {7, "COUNTER_CHANGED"},
-  };
-  bool any=false;
-  Serial.print(F("  changesText="));
-  for (auto &b : B){
-    if (c & (1u<<b.bit)){ if(any) Serial.print('|'); Serial.print(b.name); any=true; }
-  }
-  for(uint8_t b=0;b<8;b++){
-    if ((c & (1u<<b)) && b!=0 && b!=1 && b!=2 && b!=3 && b!=4 && b!=5 && b!=7){
-      if(any) Serial.print('|'); Serial.print(F("BIT")); Serial.print(b); any=true;
-    }
-  }
-  if(!any) Serial.println(F("NONE")); else Serial.println();
-}
-
 // --- HA-Minuten- & Zyklen-Zähler ---
 static bool decode_ha_counters(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t len){
   using namespace jbc_cmd;
@@ -1196,33 +1185,33 @@ static bool decode_ha_counters(Backend be, uint8_t ctrl, const uint8_t* d, uint8
     return 0;
   };
 
-  auto print_minutes = [&](const __FlashStringHelper* tag){
-    if(len<4){ print_hdr_line(be, tag); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+  auto print_minutes = [&](jbc_bin::Key tag){
+    if(len<4){ print_hdr_line(be, tag); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
     uint32_t v = read_u32_from_5_or_4(d,len);
-    print_hdr_line(be, tag); kv_u(F("min"), v);
+    print_hdr_line(be, tag); kv_u(FLD(min), v);
     uint32_t h=v/60UL; uint8_t m=(uint8_t)(v%60UL); char buf[6]; snprintf(buf,sizeof(buf),"%lu:%02u",(unsigned long)h,m);
-    kv_s(F("hm"), String(buf)); Serial.println(); return true;
+    kv_s(FLD(hm), String(buf)); kv_end(); return true;
   };
 
-  auto print_u32v = [&](const __FlashStringHelper* tag){
-    if(len<4){ print_hdr_line(be, tag); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
-    print_hdr_line(be, tag); kv_u(F("value"), read_u32_from_5_or_4(d,len)); Serial.println(); return true;
+  auto print_u32v = [&](jbc_bin::Key tag){
+    if(len<4){ print_hdr_line(be, tag); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
+    print_hdr_line(be, tag); kv_u(FLD(value), read_u32_from_5_or_4(d,len)); kv_end(); return true;
   };
 
   switch(ctrl){
     // Gesamt-Zeiten (Minuten)
-    case HA_02::M_R_PLUGTIME:        return print_minutes(F("M_R_PLUGTIME"));
-    case HA_02::M_R_WORKTIME:        return print_minutes(F("M_R_WORKTIME"));
+    case HA_02::M_R_PLUGTIME:        return print_minutes(REC(M_R_PLUGTIME));
+    case HA_02::M_R_WORKTIME:        return print_minutes(REC(M_R_WORKTIME));
 
     // Zyklen
-    case HA_02::M_R_WORKCYCLES:      return print_u32v(F("M_R_WORKCYCLES"));
-    case HA_02::M_R_SUCTIONCYCLES:   return print_u32v(F("M_R_SUCTIONCYCLES"));
+    case HA_02::M_R_WORKCYCLES:      return print_u32v(REC(M_R_WORKCYCLES));
+    case HA_02::M_R_SUCTIONCYCLES:   return print_u32v(REC(M_R_SUCTIONCYCLES));
 
     // Partial
-    case HA_02::M_R_PLUGTIMEP:       return print_minutes(F("M_R_PLUGTIMEP"));
-    case HA_02::M_R_WORKTIMEP:       return print_minutes(F("M_R_WORKTIMEP"));
-    case HA_02::M_R_WORKCYCLESP:     return print_u32v(F("M_R_WORKCYCLESP"));
-    case HA_02::M_R_SUCTIONCYCLESP:  return print_u32v(F("M_R_SUCTIONCYCLESP"));
+    case HA_02::M_R_PLUGTIMEP:       return print_minutes(REC(M_R_PLUGTIMEP));
+    case HA_02::M_R_WORKTIMEP:       return print_minutes(REC(M_R_WORKTIMEP));
+    case HA_02::M_R_WORKCYCLESP:     return print_u32v(REC(M_R_WORKCYCLESP));
+    case HA_02::M_R_SUCTIONCYCLESP:  return print_u32v(REC(M_R_SUCTIONCYCLESP));
   }
   return false;
 }
@@ -1232,18 +1221,18 @@ static bool decode_ha_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
 
   // Prozent aus Promille
   if (ctrl==HA_02::M_R_AIRFLOW || ctrl==HA_02::M_R_POWER){
-    if (len < 2){ print_hdr_line(be, (ctrl==HA_02::M_R_AIRFLOW)?F("M_R_AIRFLOW"):F("M_R_POWER")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+    if (len < 2){ print_hdr_line(be, (ctrl==HA_02::M_R_AIRFLOW)?REC(M_R_AIRFLOW):REC(M_R_POWER)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
     uint16_t ppm=u16le(d); if(ppm>1000) ppm=1000;
-    print_hdr_line(be, (ctrl==HA_02::M_R_AIRFLOW)?F("AIRFLOW"):F("M_R_POWER"));
-    kv_c(F("pct"), ppm/10.0f, 1); kv_u(F("raw"), ppm); Serial.println(); return true;
+    print_hdr_line(be, (ctrl==HA_02::M_R_AIRFLOW)?REC(AIRFLOW):REC(M_R_POWER));
+    kv_fix(FLD(pct), ppm, 1); kv_u(FLD(raw), ppm); kv_end(); return true;
   }
 
   // ---- in decode_ha_extras(...) ERSETZEN ----
   if (ctrl==HA_02::M_R_STATERROR){
     uint16_t v = len? ((len>=2)?u16le(d):d[0]) : 0;
-    print_hdr_line(be, F("M_R_STATERROR")); kv_hex(F("mask"), v, 4);
-    if (const __FlashStringHelper* sn = station_error_name((uint8_t)(v & 0xFF))) kv_fs(F("lowbyte_name"), sn);
-    Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_STATERROR)); kv_hex(FLD(mask), v, 4);
+    if (const __FlashStringHelper* sn = station_error_name((uint8_t)(v & 0xFF))) kv_fs(FLD(lowbyte_name), sn);
+    kv_end(); return true;
   }
 
   // --- HA: STARTMODE (Bitfeld) + AJUSTTEMP (Offset in °C) ---
@@ -1251,17 +1240,10 @@ static bool decode_ha_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   if (ctrl==HA_02::M_R_STARTMODE){
     if (len>=1){
       const uint8_t v = d[0];
-      print_hdr_line(BK_HA, F("M_R_STARTMODE"));
-      kv_hex(F("value"), v, 2);
-      String bits;
-      auto add=[&](const char* n){ if(bits.length()) bits += '|'; bits += n; };
-      if (v & 0x01) add("TOOL_BUTTON");
-      if (v & 0x02) add("STAND_OUT");
-      if (v & 0x04) add("PEDAL_PULSE");
-      if (v & 0x08) add("PEDAL_HOLD_DOWN");
-      if (!bits.length()) bits = "NONE";
-      kv_s(F("bits"), bits);
-      Serial.println();
+      print_hdr_line(BK_HA, REC(M_R_STARTMODE));
+      kv_hex(FLD(value), v, 2);
+      kv_bits(F("bits"), BT_HA_STARTMODE, v, 4, 0);
+      kv_end();
       return true;
     }    
   }
@@ -1269,13 +1251,13 @@ static bool decode_ha_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   // AJUSTTEMP: deltaLE(int16), port, tool   (UTI = °C*9)
   if (ctrl==HA_02::M_R_AJUSTTEMP){
     if (len>=4){
-      print_hdr_line(be, F("M_R_AJUSTTEMP"));
-      kv_c(F("delta_c"), (int16_t)u16le(d)/9.0f, 1);
-      kv_u(F("port"), d[2]); kv_u(F("tool"), d[3]);
-      if (const __FlashStringHelper* tn = ha_tool_name(d[3])) kv_fs(F("tool_name"), tn);
-      Serial.println(); return true;
+      print_hdr_line(be, REC(M_R_AJUSTTEMP));
+      kv_fix(FLD(delta_c), uti_to_dc((int16_t)u16le(d)), 1);
+      kv_u(FLD(port), d[2]); kv_u(FLD(tool), d[3]);
+      if (const __FlashStringHelper* tn = ha_tool_name(d[3])) kv_fs(FLD(tool_name), tn);
+      kv_end(); return true;
     } else if (len>=2){
-      print_hdr_line(be, F("M_R_AJUSTTEMP")); kv_c(F("delta_c"), (int16_t)u16le(d)/9.0f, 1); Serial.println(); return true;
+      print_hdr_line(be, REC(M_R_AJUSTTEMP)); kv_fix(FLD(delta_c), uti_to_dc((int16_t)u16le(d)), 1); kv_end(); return true;
     }
   }
 
@@ -1283,24 +1265,24 @@ static bool decode_ha_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   // --- EXTTCMODE (on/off, optional port,tool) ---
   if (ctrl == HA_02::M_R_EXTTCMODE){
     if (len>=1){
-      print_hdr_line(be, F("M_R_EXTTCMODE")); kv_u(F("on"), d[0]);
-      if (len>=3){ kv_u(F("port"), d[1]); kv_u(F("tool"), d[2]); if (const __FlashStringHelper* tn=ha_tool_name(d[2])) kv_fs(F("tool_name"), tn); }
-      Serial.println(); return true;
+      print_hdr_line(be, REC(M_R_EXTTCMODE)); kv_u(FLD(on), d[0]);
+      if (len>=3){ kv_u(FLD(port), d[1]); kv_u(FLD(tool), d[2]); if (const __FlashStringHelper* tn=ha_tool_name(d[2])) kv_fs(FLD(tool_name), tn); }
+      kv_end(); return true;
     }
   }
 
   
   // --- HA: CONTIMODE (Bitmaske, wie bei SOLD) ---
   if (ctrl == HA_02::M_R_CONTIMODE){
-    print_hdr_line(be, F("M_R_CONTIMODE"));
+    print_hdr_line(be, REC(M_R_CONTIMODE));
     if (len >= 2){
-      kv_hex(F("mask"), u16le(d), 4);
+      kv_hex(FLD(mask), u16le(d), 4);
     } else if (len == 1){
-      kv_hex(F("mask"), d[0], 2);
+      kv_hex(FLD(mask), d[0], 2);
     } else {
-      kv_fs(F("mask"), F("?"));
+      kv_none(FLD(mask), F("?"));
     }
-    Serial.println();
+    kv_end();
     return true;
   }
   
@@ -1309,7 +1291,7 @@ static bool decode_ha_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
 
   // THEME
   if (ctrl==HA_02::M_R_THEME && len>=1){
-    print_hdr_line(be, F("M_R_THEME")); kv_u(F("code"), d[0]); if(const char* nm=theme_name(d[0])) kv_s(F("name"), String(nm)); Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_THEME)); kv_u(FLD(code), d[0]); if(const __FlashStringHelper* nm=theme_name(d[0])) kv_fs(FLD(name), nm); kv_end(); return true;
   }
 
   // DATETIME
@@ -1322,145 +1304,140 @@ static bool decode_ha_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   
   // einfache u8-Status
   if (len>=1){
-    if (ctrl==HA_02::M_R_HEATERSTATUS){ print_hdr_line(be, F("M_R_HEATERSTATUS")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-    if (ctrl==HA_02::M_R_SUCTIONSTATUS){ print_hdr_line(be, F("M_R_SUCTIONSTATUS")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-    if (ctrl==HA_02::M_R_PROFILEMODE){ print_hdr_line(be, F("M_R_PROFILEMODE")); kv_u(F("code"), d[0]); Serial.println(); return true; }
+    if (ctrl==HA_02::M_R_HEATERSTATUS){ print_hdr_line(be, REC(M_R_HEATERSTATUS)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+    if (ctrl==HA_02::M_R_SUCTIONSTATUS){ print_hdr_line(be, REC(M_R_SUCTIONSTATUS)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+    if (ctrl==HA_02::M_R_PROFILEMODE){ print_hdr_line(be, REC(M_R_PROFILEMODE)); kv_u(FLD(code), d[0]); kv_end(); return true; }
   }
 
-  if (ctrl==HA_02::M_R_BEEP && len>=1){ print_hdr_line(be, F("M_R_BEEP")); kv_u(F("on"), d[0]); Serial.println(); return true; }
+  if (ctrl==HA_02::M_R_BEEP && len>=1){ print_hdr_line(be, REC(M_R_BEEP)); kv_u(FLD(on), d[0]); kv_end(); return true; }
 
   // SELECTFLOW / SELECTEXTTEMP / TIMETOSTOP
-  if (ctrl==HA_02::M_R_SELECTFLOW && len>=2){ uint16_t ppm=u16le(d); if(ppm>1000) ppm=1000; print_hdr_line(be, F("M_R_SELECTFLOW")); kv_c(F("pct"), ppm/10.0f,1); kv_u(F("raw"), ppm); Serial.println(); return true; }
-  if (ctrl==HA_02::M_R_SELECTEXTTEMP && len>=2){ uint16_t v=u16le(d); print_hdr_line(be, F("M_R_SELECTEXTTEMP")); kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v,4); Serial.println(); return true; }
-  if (ctrl==HA_02::M_R_TIMETOSTOP && len>=2){ uint16_t ds=u16le(d); print_hdr_line(be, F("M_R_TIMETOSTOP")); kv_s(F("mmss"), fmt_mmss_tenths(ds)); kv_u(F("ds"), ds); Serial.println(); return true; }  
+  if (ctrl==HA_02::M_R_SELECTFLOW && len>=2){ uint16_t ppm=u16le(d); if(ppm>1000) ppm=1000; print_hdr_line(be, REC(M_R_SELECTFLOW)); kv_fix(FLD(pct), ppm, 1); kv_u(FLD(raw), ppm); kv_end(); return true; }
+  if (ctrl==HA_02::M_R_SELECTEXTTEMP && len>=2){ uint16_t v=u16le(d); print_hdr_line(be, REC(M_R_SELECTEXTTEMP)); kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v,4); kv_end(); return true; }
+  if (ctrl==HA_02::M_R_TIMETOSTOP && len>=2){ uint16_t ds=u16le(d); print_hdr_line(be, REC(M_R_TIMETOSTOP)); kv_s(FLD(mmss), fmt_mmss_tenths(ds)); kv_u(FLD(ds), ds); kv_end(); return true; }  
 
   // MAX/MIN Paare
   if (len>=4){
     if (ctrl==HA_02::M_R_MAXMINTEMP){
-      print_hdr_line(be, F("M_R_MAXMINTEMP"));
-      kv_c(F("max_c"), uti_to_c(u16le(&d[0])),1); kv_c(F("min_c"), uti_to_c(u16le(&d[2])),1); Serial.println(); return true;
+      print_hdr_line(be, REC(M_R_MAXMINTEMP));
+      kv_fix(FLD(max_c), uti_to_dc(u16le(&d[0])), 1); kv_fix(FLD(min_c), uti_to_dc(u16le(&d[2])), 1); kv_end(); return true;
     }
     if (ctrl==HA_02::M_R_MAXMINFLOW){
       uint16_t a=u16le(&d[0]), b=u16le(&d[2]); if(a>1000) a=1000; if(b>1000) b=1000;
-      print_hdr_line(be, F("M_R_MAXMINFLOW")); kv_c(F("max_pct"), a/10.0f,1); kv_c(F("min_pct"), b/10.0f,1); Serial.println(); return true;
+      print_hdr_line(be, REC(M_R_MAXMINFLOW)); kv_fix(FLD(max_pct), a, 1); kv_fix(FLD(min_pct), b, 1); kv_end(); return true;
     }
     if (ctrl==HA_02::M_R_MAXMINEXTTEMP){
-      print_hdr_line(be, F("M_R_MAXMINEXTTEMP"));
-      kv_c(F("max_c"), uti_to_c(u16le(&d[0])),1); kv_c(F("min_c"), uti_to_c(u16le(&d[2])),1); Serial.println(); return true;
+      print_hdr_line(be, REC(M_R_MAXMINEXTTEMP));
+      kv_fix(FLD(max_c), uti_to_dc(u16le(&d[0])), 1); kv_fix(FLD(min_c), uti_to_dc(u16le(&d[2])), 1); kv_end(); return true;
     }
   }
 
   // Station Locked (HA)
-  if (ctrl==HA_02::M_R_STATIONLOCKED && len>=1){ print_hdr_line(be, F("M_R_STATIONLOCKED")); kv_u(F("on"), d[0]); Serial.println(); return true; }
+  if (ctrl==HA_02::M_R_STATIONLOCKED && len>=1){ print_hdr_line(be, REC(M_R_STATIONLOCKED)); kv_u(FLD(on), d[0]); kv_end(); return true; }
 
   return false;
 }
 
 // Date/Time – robust, mehrere Varianten
-static bool decode_datetime_payload(Backend be, const uint8_t* d, uint8_t len){
-  auto print_iso = [&](uint16_t Y,uint8_t M,uint8_t D,uint8_t h,uint8_t m,uint8_t s){
-    char buf[20];
-    snprintf(buf,sizeof(buf),"%04u-%02u-%02u %02u:%02u:%02u",(unsigned)Y,M,D,h,m,s);
-    print_hdr_line(be, F("M_R_DATETIME"));
-    kv_s(F("iso"), String(buf));
-    kv_u(F("year"), Y); kv_u(F("month"), M); kv_u(F("day"), D);
-    kv_u(F("hour"), h); kv_u(F("min"), m);  kv_u(F("sec"), s);
-    Serial.println();
-  };  
-
-  auto norm12 = [](uint8_t v)->int{
-    if (v>=1 && v<=12) return v;
-    uint8_t b = bcd_swap(v);
-    return (b!=0xFF && b>=1 && b<=12) ? (int)b : -1;
-  };
-  auto norm31 = [](uint8_t v)->int{
-    if (v>=1 && v<=31) return v;
-    uint8_t b = bcd_swap(v);
-    return (b!=0xFF && b>=1 && b<=31) ? (int)b : -1;
-  };
-  auto print_time_only_line = [&](uint16_t Y, int M, int D, uint32_t sod){
-    print_hdr_line(be, F("M_R_DATETIME"));
-    kv_u(F("sod"), sod);
-    if (Y)     kv_u(F("year"),  Y);
-    if (M > 0) kv_u(F("month"), (uint8_t)M);
-    if (D > 0) kv_u(F("day"),   (uint8_t)D);
-    Serial.println();
-  };
-
+static void dt_print_iso(Backend be, uint16_t Y,uint8_t M,uint8_t D,uint8_t h,uint8_t m,uint8_t s){
+  char buf[20];
+  snprintf(buf,sizeof(buf),"%04u-%02u-%02u %02u:%02u:%02u",(unsigned)Y,M,D,h,m,s);
+  print_hdr_line(be, REC(M_R_DATETIME));
+  kv_s(FLD(iso), buf);
+  kv_u(FLD(year), Y); kv_u(FLD(month), M); kv_u(FLD(day), D);
+  kv_u(FLD(hour), h); kv_u(FLD(min), m);  kv_u(FLD(sec), s);
+  kv_end();
+}
+static void dt_print_time_only(Backend be, uint16_t Y, int M, int D, uint32_t sod){
+  print_hdr_line(be, REC(M_R_DATETIME));
+  kv_u(FLD(sod), sod);
+  if (Y)     kv_u(FLD(year),  Y);
+  if (M > 0) kv_u(FLD(month), (uint8_t)M);
+  if (D > 0) kv_u(FLD(day),   (uint8_t)D);
+  kv_end();
+}
+static int dt_norm12(uint8_t v){
+  if (v>=1 && v<=12) return v;
+  uint8_t b = bcd_swap(v);
+  return (b!=0xFF && b>=1 && b<=12) ? (int)b : -1;
+}
+static int dt_norm31(uint8_t v){
+  if (v>=1 && v<=31) return v;
+  uint8_t b = bcd_swap(v);
+  return (b!=0xFF && b>=1 && b<=31) ? (int)b : -1;
+}
+// SOD + Datum: volles ISO oder nur Zeit-Zeile
+static void dt_print_sod(Backend be, uint16_t Y, int M, int D, uint32_t sod){
+  if (M>0 && D>0){
+    dt_print_iso(be, Y, (uint8_t)M, (uint8_t)D,
+                 (uint8_t)(sod/3600UL), (uint8_t)((sod%3600UL)/60UL), (uint8_t)(sod%60UL));
+  } else {
+    dt_print_time_only(be, Y, M, D, sod);
+  }
+}
 
-  // Kandidat A: HA-Layout (u24 SOD, YearOff, Mon, Day)
-  if (len == 7){
-    const uint32_t sod = u24le(&d[0]);
-    if (sod <= 86399UL){
+// Ein Layout prüfen und bei Erfolg ausgeben
+static bool dt_try_layout(Backend be, uint8_t lay, const uint8_t* d, uint8_t len){
+  switch (lay){
+    case DT_HA_SOD24: {                         // Kandidat A: HA-Layout (u24 SOD, YearOff, Mon, Day)
+      if (len != 7) return false;
+      const uint32_t sod = u24le(&d[0]);
+      if (sod > 86399UL) return false;
       const uint16_t yLE = u16le(&d[3]);
       const uint16_t yBE = (uint16_t(d[3])<<8) | d[4];
       const uint16_t yOff = (yLE <= 300) ? yLE : (yBE <= 300 ? yBE : 0xFFFF);
-      const int monA = norm12(d[5]);
-      const int dayA = norm31(d[6]);
-      if (yOff != 0xFFFF){
-        const uint16_t Y = 2000 + yOff;
-        const uint8_t  h = (uint8_t)(sod/3600UL);
-        const uint8_t  m = (uint8_t)((sod%3600UL)/60UL);
-        const uint8_t  s = (uint8_t)(sod%60UL);
-        if (monA>0 && dayA>0){ print_iso(Y,(uint8_t)monA,(uint8_t)dayA,h,m,s); return true; }
-        print_time_only_line(Y, monA, dayA, sod);
-        return true;
-      }
-      // Kandidat A’ (Mon/Day vertauscht)
-      const int monB = norm12(d[6]);
-      const int dayB = norm31(d[5]);
-      if (yLE <= 300 || yBE <= 300){
-        const uint16_t Y = 2000 + ((yLE <= 300) ? yLE : yBE);
-        const uint8_t  h = (uint8_t)(sod/3600UL);
-        const uint8_t  m = (uint8_t)((sod%3600UL)/60UL);
-        const uint8_t  s = (uint8_t)(sod%60UL);
-        if (monB>0 && dayB>0){ print_iso(Y,(uint8_t)monB,(uint8_t)dayB,h,m,s); return true; }
-        print_time_only_line(Y, monB, dayB, sod);
-        return true;
-      }
+      if (yOff == 0xFFFF) return false;
+      dt_print_sod(be, 2000 + yOff, dt_norm12(d[5]), dt_norm31(d[6]), sod);
+      return true;
     }
-
-    // Alt: u16 SOD + YearOff BE + Mon + Day
-    const uint16_t sod16  = u16le(&d[0]);
-    const uint16_t yOffBE = (uint16_t(d[2])<<8) | d[3];
-    const int monC = norm12(d[4]);
-    const int dayC = norm31(d[5]);
-    if (sod16 <= 86399 && yOffBE <= 300){
-      const uint16_t Y = 2000 + yOffBE;
-      const uint8_t  h = (uint8_t)(sod16/3600U);
-      const uint8_t  m = (uint8_t)((sod16%3600U)/60U);
-      const uint8_t  s = (uint8_t)(sod16%60U);
-      if (monC>0 && dayC>0){ print_iso(Y,(uint8_t)monC,(uint8_t)dayC,h,m,s); return true; }
-      print_time_only_line(Y, monC, dayC, sod16);
+    case DT_SOD16: {                            // Alt: u16 SOD + YearOff BE + Mon + Day
+      if (len != 7) return false;
+      const uint16_t sod16  = u16le(&d[0]);
+      const uint16_t yOffBE = (uint16_t(d[2])<<8) | d[3];
+      if (!(sod16 <= 86399 && yOffBE <= 300)) return false;
+      dt_print_sod(be, 2000 + yOffBE, dt_norm12(d[4]), dt_norm31(d[5]), sod16);
       return true;
     }
-  }
-
-  // Kandidat B: 7B: year(u16 LE), mon, day, hh, mm, ss
-  if (len >= 7){
-    const uint16_t Y = u16le(&d[0]);
-    const uint8_t  M = d[2], D=d[3], h=d[4], m=d[5], s=d[6];
-    if (Y>=2000 && Y<=2099 && M>=1 && M<=12 && D>=1 && D<=31 && h<=23 && m<=59 && s<=59){
-      print_iso(Y,M,D,h,m,s);
+    case DT_YMDHMS: {                           // Kandidat B: 7B: year(u16 LE), mon, day, hh, mm, ss
+      if (len < 7) return false;
+      const uint16_t Y = u16le(&d[0]);
+      const uint8_t  M = d[2], D=d[3], h=d[4], m=d[5], s=d[6];
+      if (!(Y>=2000 && Y<=2099 && M>=1 && M<=12 && D>=1 && D<=31 && h<=23 && m<=59 && s<=59)) return false;
+      dt_print_iso(be, Y,M,D,h,m,s);
       return true;
     }
-  }
-
-  // Kandidat C: 6B BCD: YY MM DD hh mm ss
-  if (len >= 6){
-    bool bcdok=true; for(uint8_t i=0;i<6;i++) bcdok &= is_bcd(d[i]);
-    if (bcdok){
+    case DT_BCD6: {                             // Kandidat C: 6B BCD: YY MM DD hh mm ss
+      if (len < 6) return false;
+      bool bcdok=true; for(uint8_t i=0;i<6;i++) bcdok &= is_bcd(d[i]);
+      if (!bcdok) return false;
       const uint16_t Y = 2000 + bcd2(d[0]);
       const uint8_t  M = bcd2(d[1]), D=bcd2(d[2]), h=bcd2(d[3]), m=bcd2(d[4]), s=bcd2(d[5]);
-      if (M>=1 && M<=12 && D>=1 && D<=31 && h<=23 && m<=59 && s<=59){
-        print_iso(Y,M,D,h,m,s);
-        return true;
-      }
+      if (!(M>=1 && M<=12 && D>=1 && D<=31 && h<=23 && m<=59 && s<=59)) return false;
+      dt_print_iso(be, Y,M,D,h,m,s);
+      return true;
+    }
+    default: return false;
+  }
+}
+
+static bool decode_datetime_payload(Backend be, const uint8_t* d, uint8_t len){
+  LayoutProfile& lp = layout_profile();
+
+  // gelerntes Layout direkt verwenden (nur bei gleicher Länge)
+  if (lp.dt_len == len && lp.dt_layout != DT_UNKNOWN){
+    if (dt_try_layout(be, lp.dt_layout, d, len)) return true;
+  }
+
+  // (neu) erkennen: Kandidaten in fester Reihenfolge, Treffer merken
+  for (uint8_t lay = DT_HA_SOD24; lay <= DT_BCD6; ++lay){
+    if (dt_try_layout(be, lay, d, len)){
+      lp.dt_len = len; lp.dt_layout = lay;
+      return true;
     }
   }
 
   // Fallback – roh
-  print_hdr_line(be, F("M_R_DATETIME")); kv_s(F("raw"), hex_string(d,len)); Serial.println();
+  print_hdr_line(be, REC(M_R_DATETIME)); kv_s(FLD(raw), hex_string(d,len)); kv_end();
   return true;
 }
 
@@ -1470,27 +1447,27 @@ static bool decode_ph_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
 
   // SELECTPOWER (0..1000 → %)
   if (ctrl==PH_02::M_R_SELECTPOWER){
-    if(len<2){ print_hdr_line(be, F("M_R_SELECTPOWER")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+    if(len<2){ print_hdr_line(be, REC(M_R_SELECTPOWER)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
     uint16_t ppm=u16le(d); if(ppm>1000) ppm=1000;
-    print_hdr_line(be, F("M_R_SELECTPOWER")); kv_c(F("pct"), ppm/10.0f,1); kv_u(F("raw"), ppm); Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_SELECTPOWER)); kv_fix(FLD(pct), ppm, 1); kv_u(FLD(raw), ppm); kv_end(); return true;
   }
 
   // WARNINGS (roh)
-  if (ctrl==PH_02::M_R_WARNING){ print_hdr_line(be, F("M_R_WARNING")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+  if (ctrl==PH_02::M_R_WARNING){ print_hdr_line(be, REC(M_R_WARNING)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
 
   // ACTIVEZONES (roh)
-  if (ctrl==PH_02::M_R_ACTIVEZONES && len>=1){ print_hdr_line(be, F("M_R_ACTIVEZONES")); kv_hex(F("mask"), d[0], 2); Serial.println(); return true; }
+  if (ctrl==PH_02::M_R_ACTIVEZONES && len>=1){ print_hdr_line(be, REC(M_R_ACTIVEZONES)); kv_hex(FLD(mask), d[0], 2); kv_end(); return true; }
 
   // einfache u8-Status
   if (len>=1){
-    if (ctrl==PH_02::M_R_WORKMODE){ print_hdr_line(be, F("M_R_WORKMODE")); kv_u(F("code"), d[0]); Serial.println(); return true; }
-    if (ctrl==PH_02::M_R_HEATERSTATUS){ print_hdr_line(be, F("M_R_HEATERSTATUS")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-    if (ctrl==PH_02::M_R_EXTTCMODE){ print_hdr_line(be, F("M_R_EXTTCMODE")); kv_u(F("on"), d[0]); Serial.println(); return true; }
+    if (ctrl==PH_02::M_R_WORKMODE){ print_hdr_line(be, REC(M_R_WORKMODE)); kv_u(FLD(code), d[0]); kv_end(); return true; }
+    if (ctrl==PH_02::M_R_HEATERSTATUS){ print_hdr_line(be, REC(M_R_HEATERSTATUS)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+    if (ctrl==PH_02::M_R_EXTTCMODE){ print_hdr_line(be, REC(M_R_EXTTCMODE)); kv_u(FLD(on), d[0]); kv_end(); return true; }
   }
   // TIMETOSTOP (PH)
   if (ctrl==PH_02::M_R_TIMETOSTOP && len>=2){
     uint16_t ds=u16le(d);
-    print_hdr_line(be, F("M_R_TIMETOSTOP")); kv_s(F("mmss"), fmt_mmss_tenths(ds)); kv_u(F("ds"), ds); Serial.println(); return true;
+    print_hdr_line(be, REC(M_R_TIMETOSTOP)); kv_s(FLD(mmss), fmt_mmss_tenths(ds)); kv_u(FLD(ds), ds); kv_end(); return true;
   }
 
   return false;
@@ -1501,44 +1478,48 @@ static bool decode_fe_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   using namespace jbc_cmd;
 
   if (ctrl==FE_02::M_R_FLOW){
-    if(len<2){ print_hdr_line(be, F("M_R_FLOW")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
-    uint16_t ppm=u16le(d); if(ppm>1000) ppm=1000; print_hdr_line(be, F("M_R_FLOW")); kv_c(F("pct"), ppm/10.0f,1); kv_u(F("raw"), ppm); Serial.println(); return true;
+    if(len<2){ print_hdr_line(be, REC(M_R_FLOW)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
+    uint16_t ppm=u16le(d); if(ppm>1000) ppm=1000; print_hdr_line(be, REC(M_R_FLOW)); kv_fix(FLD(pct), ppm, 1); kv_u(FLD(raw), ppm); kv_end(); return true;
   }
   if (ctrl==FE_02::M_R_SPEED){
-    if(len<2){ print_hdr_line(be, F("M_R_SPEED")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
-    print_hdr_line(be, F("M_R_SPEED")); kv_u(F("raw"), u16le(d)); Serial.println(); return true;
+    if(len<2){ print_hdr_line(be, REC(M_R_SPEED)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
+    print_hdr_line(be, REC(M_R_SPEED)); kv_u(FLD(raw), u16le(d)); kv_end(); return true;
   }
   if (ctrl==FE_02::M_R_SELECTFLOW){
-    if(len<2){ print_hdr_line(be, F("M_R_SELECTFLOW")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
-    uint16_t ppm=u16le(d); if(ppm>1000) ppm=1000; print_hdr_line(be, F("M_R_SELECTFLOW")); kv_c(F("pct"), ppm/10.0f,1); kv_u(F("raw"), ppm); Serial.println(); return true;
+    if(len<2){ print_hdr_line(be, REC(M_R_SELECTFLOW)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
+    uint16_t ppm=u16le(d); if(ppm>1000) ppm=1000; print_hdr_line(be, REC(M_R_SELECTFLOW)); kv_fix(FLD(pct), ppm, 1); kv_u(FLD(raw), ppm); kv_end(); return true;
   }
   if (ctrl==FE_02::M_R_SUCTIONLEVEL){
-    if(len<2){ print_hdr_line(be, F("M_R_SUCTIONLEVEL")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
-    uint16_t v=u16le(d); print_hdr_line(be, F("M_R_SUCTIONLEVEL")); if(v<=1000) kv_c(F("pct"), (v>1000?1000:v)/10.0f,1); kv_u(F("raw"), v); Serial.println(); return true;
+    if(len<2){ print_hdr_line(be, REC(M_R_SUCTIONLEVEL)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
+    uint16_t v=u16le(d); print_hdr_line(be, REC(M_R_SUCTIONLEVEL)); if(v<=1000) kv_fix(FLD(pct), (v>1000?1000:v), 1); kv_u(FLD(raw), v); kv_end(); return true;
   }
-  if (ctrl==FE_02::M_R_FILTERSTATUS && len>=1){ print_hdr_line(be, F("M_R_FILTERSTATUS")); kv_u(F("code"), d[0]); Serial.println(); return true; }
-  if (ctrl==FE_02::M_R_CONNECTEDPEDAL && len>=1){ print_hdr_line(be, F("M_R_CONNECTEDPEDAL")); kv_u(F("connected"), d[0]); Serial.println(); return true; }
-  if (ctrl==FE_02::M_R_RESETFILTER && len>=1){ print_hdr_line(be, F("M_R_RESETFILTER")); kv_u(F("code"), d[0]); Serial.println(); return true; }
+  if (ctrl==FE_02::M_R_FILTERSTATUS && len>=1){ print_hdr_line(be, REC(M_R_FILTERSTATUS)); kv_u(FLD(code), d[0]); kv_end(); return true; }
+  if (ctrl==FE_02::M_R_CONNECTEDPEDAL && len>=1){ print_hdr_line(be, REC(M_R_CONNECTEDPEDAL)); kv_u(FLD(connected), d[0]); kv_end(); return true; }
+  if (ctrl==FE_02::M_R_RESETFILTER && len>=1){ print_hdr_line(be, REC(M_R_RESETFILTER)); kv_u(FLD(code), d[0]); kv_end(); return true; }
 
-  if (ctrl==FE_02::M_R_COUNTERS){ print_hdr_line(be, F("M_R_COUNTERS")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+  if (ctrl==FE_02::M_R_COUNTERS){ print_hdr_line(be, REC(M_R_COUNTERS)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
 
   // PIN / PINENABLED / STATIONLOCKED / BEEP – durch crossfamily bereits abgedeckt; hier nur Fallbacks
   if (ctrl==FE_02::M_R_PIN){
     if (len==4 && d[0]>='0'&&d[0]<='9' && d[1]>='0'&&d[1]<='9' &&
                  d[2]>='0'&&d[2]<='9' && d[3]>='0'&&d[3]<='9'){
-      print_hdr_tag(F("PIN")); for(uint8_t i=0;i<4;i++) Serial.print((char)d[i]); Serial.println();
-    } else { Serial.print(F("[PIN] raw ")); print_hex(d,len); Serial.println(); }
+      print_hdr_tag(REC(PIN));
+      if (g_fmt) { char p[5] = { (char)d[0], (char)d[1], (char)d[2], (char)d[3], 0 }; kv_s(FLD(pin), p); }
+      else for(uint8_t i=0;i<4;i++) Serial.print((char)d[i]);
+      kv_end();
+    } else if (g_fmt) { print_hdr_tag(REC(PIN)); kv_raw(FLD(raw), d, len); kv_end(); }
+    else { Serial.print(F("[PIN] raw ")); print_hex(d,len); kv_end(); }
     return true;
   }
-  if (ctrl==FE_02::M_R_PINENABLED && len>=1){ print_onoff(F("M_R_PINENABLED"), d[0]); return true; }
-  if (ctrl==FE_02::M_R_STATIONLOCKED && len>=1){ print_onoff(F("M_R_STATIONLOCKED"), d[0]); return true; }
-  if (ctrl==FE_02::M_R_BEEP && len>=1){ print_onoff(F("M_R_BEEP"), d[0]); return true; }
+  if (ctrl==FE_02::M_R_PINENABLED && len>=1){ print_onoff(REC(M_R_PINENABLED), d[0]); return true; }
+  if (ctrl==FE_02::M_R_STATIONLOCKED && len>=1){ print_onoff(REC(M_R_STATIONLOCKED), d[0]); return true; }
+  if (ctrl==FE_02::M_R_BEEP && len>=1){ print_onoff(REC(M_R_BEEP), d[0]); return true; }
 
   // Pedal/Intake Settings
-  if (ctrl==FE_02::M_R_ACTIVATIONPEDAL && len>=1){ print_hdr_line(be, F("M_R_ACTIVATIONPEDAL")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (ctrl==FE_02::M_R_PEDALMODE && len>=1){ print_hdr_line(be, F("M_R_PEDALMODE")); kv_u(F("code"), d[0]); Serial.println(); return true; }
-  if (ctrl==FE_02::M_R_INTAKEACTIVATION && len>=1){ print_hdr_line(be, F("M_R_INTAKEACTIVATION")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (ctrl==FE_02::M_R_SUCTIONDELAY && len>=2){ print_hdr_line(be, F("M_R_SUCTIONDELAY")); kv_u(F("ms"), u16le(d)); Serial.println(); return true; }
+  if (ctrl==FE_02::M_R_ACTIVATIONPEDAL && len>=1){ print_hdr_line(be, REC(M_R_ACTIVATIONPEDAL)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (ctrl==FE_02::M_R_PEDALMODE && len>=1){ print_hdr_line(be, REC(M_R_PEDALMODE)); kv_u(FLD(code), d[0]); kv_end(); return true; }
+  if (ctrl==FE_02::M_R_INTAKEACTIVATION && len>=1){ print_hdr_line(be, REC(M_R_INTAKEACTIVATION)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (ctrl==FE_02::M_R_SUCTIONDELAY && len>=2){ print_hdr_line(be, REC(M_R_SUCTIONDELAY)); kv_u(FLD(ms), u16le(d)); kv_end(); return true; }
 
   return false;
 }
@@ -1548,19 +1529,19 @@ static bool decode_sf_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   using namespace jbc_cmd;
 
   if (ctrl==SF_02::M_R_SPEED){
-    if(len<2){ print_hdr_line(be, F("M_R_SPEED")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
-    print_hdr_line(be, F("M_R_SPEED")); kv_u(F("raw"), u16le(d)); Serial.println(); return true;
+    if(len<2){ print_hdr_line(be, REC(M_R_SPEED)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
+    print_hdr_line(be, REC(M_R_SPEED)); kv_u(FLD(raw), u16le(d)); kv_end(); return true;
   }
   if (ctrl==SF_02::M_R_LENGTH){
-    if(len<2){ print_hdr_line(be, F("M_R_LENGTH")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
-    print_hdr_line(be, F("M_R_LENGTH")); kv_u(F("raw"), u16le(d)); Serial.println(); return true;
+    if(len<2){ print_hdr_line(be, REC(M_R_LENGTH)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
+    print_hdr_line(be, REC(M_R_LENGTH)); kv_u(FLD(raw), u16le(d)); kv_end(); return true;
   }
-  if (ctrl==SF_02::M_R_PROGRAM && len>=1){ print_hdr_line(be, F("M_R_PROGRAM")); kv_u(F("code"), d[0]); Serial.println(); return true; }
-  if (ctrl==SF_02::M_R_DISPENSERMODE && len>=1){ print_hdr_line(be, F("M_R_DISPENSERMODE")); kv_u(F("code"), d[0]); Serial.println(); return true; }
-  if (ctrl==SF_02::M_R_BACKWARDMODE && len>=1){ print_hdr_line(be, F("M_R_BACKWARDMODE")); kv_u(F("code"), d[0]); Serial.println(); return true; }
-  if (ctrl==SF_02::M_R_TOOLENABLED && len>=1){ print_hdr_line(be, F("M_R_TOOLENABLED")); kv_u(F("on"), d[0]); Serial.println(); return true; }
-  if (ctrl==SF_02::M_R_LENGTHUNIT && len>=1){ print_hdr_line(be, F("M_R_LENGTHUNIT")); kv_u(F("code"), d[0]); Serial.println(); return true; }
-  if (ctrl==SF_02::M_R_PROGRAMLIST || ctrl==SF_02::M_R_COUNTERS){ print_hdr_line(be, F("SF_RAW")); kv_s(F("raw"), hex_string(d,len)); Serial.println(); return true; }
+  if (ctrl==SF_02::M_R_PROGRAM && len>=1){ print_hdr_line(be, REC(M_R_PROGRAM)); kv_u(FLD(code), d[0]); kv_end(); return true; }
+  if (ctrl==SF_02::M_R_DISPENSERMODE && len>=1){ print_hdr_line(be, REC(M_R_DISPENSERMODE)); kv_u(FLD(code), d[0]); kv_end(); return true; }
+  if (ctrl==SF_02::M_R_BACKWARDMODE && len>=1){ print_hdr_line(be, REC(M_R_BACKWARDMODE)); kv_u(FLD(code), d[0]); kv_end(); return true; }
+  if (ctrl==SF_02::M_R_TOOLENABLED && len>=1){ print_hdr_line(be, REC(M_R_TOOLENABLED)); kv_u(FLD(on), d[0]); kv_end(); return true; }
+  if (ctrl==SF_02::M_R_LENGTHUNIT && len>=1){ print_hdr_line(be, REC(M_R_LENGTHUNIT)); kv_u(FLD(code), d[0]); kv_end(); return true; }
+  if (ctrl==SF_02::M_R_PROGRAMLIST || ctrl==SF_02::M_R_COUNTERS){ print_hdr_line(be, REC(SF_RAW)); kv_s(FLD(raw), hex_string(d,len)); kv_end(); return true; }
 
   
 
@@ -1573,6 +1554,155 @@ static bool decode_sf_extras(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
 //   HA:          len = 1 + 12*n   (seq + n×[air,protTC,pwr,flow,tts, status, changes])
 //                (12B passt zum HA-INF_PORT-Layout ohne Tool/Extra-Byte)
 //   Fallback HA: len = 1 + 14*n   (wenn FW 14B mit vorangestelltem 2B-Pad/Tool sendet)
+// Bytes pro Port im Conti-Burst (0 = Layout unbekannt) – gelernt je Länge
+static uint8_t conti_port_stride(Backend be, uint8_t len, uint8_t& nPorts){
+  LayoutProfile& lp = layout_profile();
+  if (lp.conti_len != len || lp.conti_be != be){
+    uint8_t per = 0;
+    if (be==BK_SOLD || be==BK_SOLD1 || be==BK_UNKNOWN){
+      if ((len >= 11) && ((uint8_t)(len-1) % 10u == 0u)) per = 10;
+    }
+    if (be == BK_HA){
+      // bevorzugt 14 B/Port (neues Layout), Fallback 12 B/Port (alt)
+      if      ((len >= 15) && ((uint8_t)(len-1) % 14u == 0u)) per = 14;
+      else if ((len >= 13) && ((uint8_t)(len-1) % 12u == 0u)) per = 12;
+    }
+    lp.conti_be     = be;
+    lp.conti_len    = len;
+    lp.conti_stride = per;
+    lp.conti_ports  = per ? (uint8_t)((len - 1) / per) : 0;
+  }
+  nPorts = lp.conti_ports;
+  return lp.conti_stride;
+}
+
+// Minimal-Parsing (Lazy-Decoding): nur Relais-Eingang + aggregierte Changes, keine Ausgabe.
+// false = Layout unbekannt -> Aufrufer soll regulär dekodieren.
+static bool conti_relay_input(Backend be, const uint8_t* d, uint8_t len, uint8_t& agg_changes){
+  uint8_t nPorts = 0;
+  const uint8_t per = conti_port_stride(be, len, nPorts);
+  if (!per) return false;
+
+  bool any_on = false;
+  agg_changes = 0;
+  for (uint8_t p=0; p<nPorts; ++p){
+    const uint8_t* b = &d[1 + per*p];
+    if (per == 10){
+      // gleiche Regel wie decode_conti_burst: nicht STAND/SLEEP/HIB und ≥1 % Leistung
+      agg_changes |= b[9];
+      any_on |= ((b[8] & (0x01 | 0x02 | 0x04)) == 0) && (u16le(&b[4]) >= 10);
+    } else {
+      const uint8_t st = (per == 14) ? 12 : 8;
+      agg_changes |= b[st+1];
+      any_on |= (b[st] & 0x01) != 0;
+    }
+  }
+  jbc_conti_signal(any_on);
+  return true;
+}
+
+// ---- Conti nur bei Änderung (CONTIDELTA) ----
+// Je Port werden die zuletzt ausgegebenen Werte gemerkt. Eine Port-Zeile kommt nur, wenn eine
+// Temperatur um ≥ db_dc oder Leistung/Flow um ≥ db_pm abweicht, Flags/Status anders sind,
+// changes != 0 ist oder der Port hb_s Sekunden stumm war (Herzschlag). Entschieden wird einmal
+// je Burst (conti_delta_frame), alle Darstellungen (Text/JSON/binär) zeigen dieselben Ports;
+// gemerkt wird erst danach (conti_delta_commit) und nur, wenn eine Konsole die Port-Zeilen
+// wirklich bekommen hat.
+static const uint8_t CONTI_DELTA_PORTS = 4;
+struct ContiPortLast {
+  int16_t  dc[2];      // °C ×10: tip1/tip2 bzw. air/ext_tc
+  uint16_t pm[3];      // ‰: Leistung; HA: Flow ist, Flow soll
+  uint8_t  flags;      // Flags (SOLD) bzw. Status (HA)
+  uint32_t t_ms;       // letzte Ausgabe
+};
+struct ContiDelta {
+  bool     on    = false;
+  uint8_t  db_dc = 20;       // Totband °C ×10
+  uint8_t  db_pm = 20;       // Totband ‰
+  uint8_t  hb_s  = 60;       // Herzschlag in s (0 = keiner)
+  uint8_t  show  = 0xFF;     // Bit je Port: Zeile im aktuellen Burst
+  uint8_t  valid = 0;        // Bit je Port: last[] gültig
+  bool     lines = false;    // aktueller Burst: Port-Zeilen an mindestens eine Konsole
+  uint32_t shown = 0, skipped = 0;
+  ContiPortLast last[CONTI_DELTA_PORTS];
+};
+extern ContiDelta g_conti_delta;   // Definition im .ino
+
+// um mindestens db (und überhaupt) verändert; db = 0 -> jede Änderung
+static inline bool conti_moved(int32_t a, int32_t b, uint8_t db){
+  const int32_t x = a > b ? a - b : b - a;
+  return x && x >= db;
+}
+
+// Vergleichswerte eines Ports (b = Port-Block, per = 10/12/14 Byte); liefert changes
+static uint8_t conti_port_values(uint8_t per, const uint8_t* b, ContiPortLast& v){
+  uint8_t changes;
+  v.pm[1] = v.pm[2] = 0;
+  if (per == 10){
+    v.dc[0] = (int16_t)uti_to_dc(u16le(&b[0]));
+    v.dc[1] = (int16_t)uti_to_dc(u16le(&b[2]));
+    v.pm[0] = u16le(&b[4]);
+    v.flags = b[8];
+    changes = b[9];
+  } else {
+    const bool use14 = (per == 14);
+    v.dc[0] = (int16_t)uti_to_dc(u16le(&b[0]));
+    v.dc[1] = (int16_t)uti_to_dc(u16le(&b[use14 ? 6 : 4]));
+    v.pm[0] = u16le(&b[use14 ? 4 : 2]);
+    if (use14){ v.pm[1] = u16le(&b[8]); v.pm[2] = u16le(&b[2]); }
+    v.flags = b[use14 ? 12 : 8];
+    changes = b[use14 ? 13 : 9];
+  }
+  for (uint8_t i=0; i<3; i++){
+    if (v.pm[i] == 0xFFFF) v.pm[i] = 0;          // Flow nicht vorhanden
+    else if (v.pm[i] > 1000) v.pm[i] = 1000;
+  }
+  return changes;
+}
+
+// Vor den Ausgabe-Durchläufen eines Conti-Bursts: welche Ports bekommen eine Zeile?
+static void conti_delta_frame(Backend be, const uint8_t* d, uint8_t len, uint32_t now){
+  ContiDelta& cd = g_conti_delta;
+  cd.show  = 0xFF;
+  cd.lines = false;
+  if (!cd.on) return;
+  uint8_t nPorts = 0;
+  const uint8_t per = conti_port_stride(be, len, nPorts);
+  if (!per) return;
+
+  cd.show = 0;
+  for (uint8_t p=0; p<nPorts; ++p){
+    if (p >= CONTI_DELTA_PORTS) { cd.show |= (uint8_t)(1u << p); continue; }
+    ContiPortLast v;
+    const uint8_t changes = conti_port_values(per, &d[1 + per*p], v);
+    const ContiPortLast& l = cd.last[p];
+    bool show = !(cd.valid & (1u << p)) || changes || v.flags != l.flags
+             || (cd.hb_s && now - l.t_ms >= cd.hb_s * 1000UL);
+    for (uint8_t i=0; i<2 && !show; i++) show = conti_moved(v.dc[i], l.dc[i], cd.db_dc);
+    for (uint8_t i=0; i<3 && !show; i++) show = conti_moved(v.pm[i], l.pm[i], cd.db_pm);
+    if (show) cd.show |= (uint8_t)(1u << p);
+  }
+}
+static inline bool conti_delta_show(uint8_t p){ return p >= 8 || (g_conti_delta.show >> p) & 1u; }
+
+// Nach den Durchläufen: ausgegebene Ports merken. Ohne Abnehmer der Port-Zeilen (CONTISEND OFF,
+// SHED-Summe, Maske ohne CONTI) bleibt alles beim Alten, die nächste Änderung kommt also noch.
+static void conti_delta_commit(Backend be, const uint8_t* d, uint8_t len, uint32_t now){
+  ContiDelta& cd = g_conti_delta;
+  if (!cd.on || !cd.lines) return;
+  uint8_t nPorts = 0;
+  const uint8_t per = conti_port_stride(be, len, nPorts);
+  if (!per) return;
+  for (uint8_t p=0; p<nPorts && p<CONTI_DELTA_PORTS; ++p){
+    if (!conti_delta_show(p)) { cd.skipped++; continue; }
+    ContiPortLast& l = cd.last[p];
+    conti_port_values(per, &d[1 + per*p], l);
+    l.t_ms = now;
+    cd.valid |= (uint8_t)(1u << p);
+    cd.shown++;
+  }
+}
+
 static bool decode_conti_burst(Backend be, const uint8_t* d, uint8_t len){
   if (jbc_decode::g_log_cur_fid != 250) return false;
   if (len < 1) return false;
@@ -1581,19 +1711,37 @@ static bool decode_conti_burst(Backend be, const uint8_t* d, uint8_t len){
 
   auto print_changes_agg = [&](uint8_t agg){
     if (!agg) return;
-    print_hdr_line(be, F("CONTIMODE_CHANGES"));
-    kv_u  (F("seq"),  seq);
-    kv_hex(F("mask"), agg, 2);
-    kv_s  (F("bits"), sold_changes_to_string(agg));
-    Serial.println();
+    jbc_conti_lines(CONTI_BOTH);
+    print_hdr_line(be, REC(CONTIMODE_CHANGES));
+    kv_u  (FLD(seq),  seq);
+    kv_hex(FLD(mask), agg, 2);
+    kv_bits(F("bits"), BT_CHANGES, agg, 8, BITS_UNNAMED);
+    kv_end();
+  };
+  // Eine Zeile je Burst statt je Port (gedrosselte Konsolen): aktive Ports, Maxima, Changes
+  auto print_summary = [&](uint8_t ports, uint8_t on, uint16_t max_uti, uint16_t max_ppm, uint8_t agg){
+    if (!jbc_decode::g_show_conti_send || !jbc_conti_lines(CONTI_SUM)) return;
+    print_hdr_line(be, REC(CONTIMODE_SUMMARY));
+    kv_u  (FLD(seq),     seq);
+    kv_u  (FLD(ports),   ports);
+    kv_u  (FLD(active),  on);
+    kv_fix(FLD(max_c),   uti_to_dc(max_uti), 1);
+    kv_fix(FLD(max_pct), max_ppm > 1000 ? 1000 : max_ppm, 1);
+    kv_hex(FLD(changes), agg, 2);
+    kv_end();
   };
 
   // ---------- SOLD / SOLD1 ----------
+  uint8_t nPorts = 0;
+  const uint8_t stride = conti_port_stride(be, len, nPorts);
+
   if (be==BK_SOLD || be==BK_SOLD1 || be==BK_UNKNOWN){
-    if ((len >= 11) && ((uint8_t)(len-1) % 10u == 0u)){
-      const uint8_t nPorts = (uint8_t)((len - 1) / 10u);
-      uint8_t agg_changes = 0;
+    if (stride == 10){
+      uint8_t agg_changes = 0, n_on = 0;
+      uint16_t max_uti = 0, max_ppm = 0;
       bool any_on = false;
+      const bool each = jbc_decode::g_show_conti_send && jbc_conti_lines(CONTI_PORTS);
+      if (each) g_conti_delta.lines = true;
 
       for (uint8_t p=0; p<nPorts; ++p){
         const uint8_t* b = &d[1 + 10u*p];
@@ -1609,34 +1757,38 @@ static bool decode_conti_burst(Backend be, const uint8_t* d, uint8_t len){
         const bool not_idle   = (flags & (0x01 | 0x02 | 0x04)) == 0;
         const bool enough_pwr = (pwrPpm >= 10);          // 10 ‰ = 1 %
         any_on |= (not_idle && enough_pwr);
-
-        // ---- AUSGABE NUR, WENN ERWÜNSCHT ----
-        if (jbc_decode::g_show_conti_send) {
-          print_hdr_line(be, F("CONTIMODE_SENDING"));
-          kv_u  (F("seq"),  seq);
-          kv_u  (F("port"), p);
-          kv_c  (F("tip1_c"), uti_to_c(tip1), 1);
-          //kv_hex(F("tip1_uti"), tip1, 4);
+        n_on   += (not_idle && enough_pwr);
+        if (tip1 > max_uti)   max_uti = tip1;
+        if (pwrPpm > max_ppm) max_ppm = pwrPpm;
+
+        // ---- AUSGABE NUR, WENN ERWÜNSCHT (und bei CONTIDELTA nur geänderte Ports) ----
+        if (each && conti_delta_show(p)) {
+          print_hdr_line(be, REC(CONTIMODE_SENDING));
+          kv_u  (FLD(seq),  seq);
+          kv_u  (FLD(port), p);
+          kv_fix(FLD(tip1_c), uti_to_dc(tip1), 1);
+          //kv_hex(FLD(tip1_uti), tip1, 4);
           if (tip2) {
-            kv_c  (F("tip2_c"),  uti_to_c(tip2), 1);
-            kv_hex(F("tip2_uti"), tip2, 4);
+            kv_fix(FLD(tip2_c), uti_to_dc(tip2), 1);
+            kv_hex(FLD(tip2_uti), tip2, 4);
           } else {
-            kv_s  (F("tip2_c"),  F("N/A"));
-            //kv_hex(F("tip2_uti"), tip2, 4);
+            kv_none(FLD(tip2_c), F("N/A"));
+            //kv_hex(FLD(tip2_uti), tip2, 4);
           }
           { uint16_t cl = (pwrPpm > 1000) ? 1000 : pwrPpm;
-            kv_c(F("power_pct"), cl/10.0f, 1);
-            //kv_u(F("power_raw"), pwrPpm);
+            kv_fix(FLD(power_pct), cl, 1);
+            //kv_u(FLD(power_raw), pwrPpm);
           }
-          kv_hex(F("flags"),   flags,   2);
-          kv_s  (F("flags_bits"), sold_status_to_string(flags));
-          kv_hex(F("changes"), changes, 2);
-          if (changes) kv_s(F("changes_bits"), sold_changes_to_string(changes));
-          Serial.println();
+          kv_hex(FLD(flags),   flags,   2);
+          kv_bits(F("flags_bits"), BT_SOLD_STATUS, flags, 8, BITS_UNNAMED);
+          kv_hex(FLD(changes), changes, 2);
+          if (changes) kv_bits(F("changes_bits"), BT_CHANGES, changes, 8, BITS_UNNAMED);
+          kv_end();
         }
       }
+      print_summary(nPorts, n_on, max_uti, max_ppm, agg_changes);
       print_changes_agg(agg_changes);
-      jbc_conti_signal(any_on);
+      if (g_fx) jbc_conti_signal(any_on);
       return true;
     }
   }
@@ -1644,15 +1796,15 @@ static bool decode_conti_burst(Backend be, const uint8_t* d, uint8_t len){
   // ---------- HOT AIR (HA) ----------
   if (be == BK_HA) {
     // bevorzugt 14 B/Port (neues Layout), Fallback 12 B/Port (alt)
-    uint8_t per = 0; bool use14 = false;
-    if ((len >= 15) && ((uint8_t)(len-1) % 14u == 0u)) { per = 14; use14 = true; }
-    else if ((len >= 13) && ((uint8_t)(len-1) % 12u == 0u)) { per = 12; use14 = false; }
-    else return false;
+    const uint8_t per = stride;
+    const bool use14 = (per == 14);
+    if (!per) return false;
 
-    const uint8_t nPorts = (uint8_t)((len - 1) / per);
-    uint8_t agg_changes = 0;
+    uint8_t agg_changes = 0, n_on = 0;
+    uint16_t max_uti = 0, max_ppm = 0;
     bool any_on = false;  
-    const uint8_t seq = d[0];
+    const bool each = jbc_decode::g_show_conti_send && jbc_conti_lines(CONTI_PORTS);
+    if (each) g_conti_delta.lines = true;
 
     for (uint8_t p = 0; p < nPorts; ++p) {
       const uint8_t* b = &d[1 + per*p];
@@ -1684,50 +1836,54 @@ static bool decode_conti_burst(Backend be, const uint8_t* d, uint8_t len){
 
       agg_changes |= changes;
       any_on |= (status & 0x01) != 0;
+      n_on   += (status & 0x01);
+      if (airUTI > max_uti)   max_uti = airUTI;
+      if (powerPpm > max_ppm) max_ppm = powerPpm;
 
-      // ---- AUSGABE NUR, WENN ERWÜNSCHT ----
-      if (jbc_decode::g_show_conti_send) {
-        print_hdr_line(be, F("CONTIMODE_SENDING"));
-        kv_u(F("seq"),  seq);
-        kv_u(F("port"), p);
+      // ---- AUSGABE NUR, WENN ERWÜNSCHT (und bei CONTIDELTA nur geänderte Ports) ----
+      if (each && conti_delta_show(p)) {
+        print_hdr_line(be, REC(CONTIMODE_SENDING));
+        kv_u(FLD(seq),  seq);
+        kv_u(FLD(port), p);
 
-        kv_c(F("air_c"), uti_to_c(airUTI), 1);
+        kv_fix(FLD(air_c), uti_to_dc(airUTI), 1);
 
         if (flowSetPpm != 0xFFFF) {
           uint16_t v = (flowSetPpm > 1000) ? 1000 : flowSetPpm;
-          kv_c(F("flow_set_pct"), v/10.0f, 1);
-          //kv_u(F("flow_set_raw"), flowSetPpm);
+          kv_fix(FLD(flow_set_pct), v, 1);
+          //kv_u(FLD(flow_set_raw), flowSetPpm);
         }
 
         { uint16_t v = (powerPpm > 1000) ? 1000 : powerPpm;
-          kv_c(F("power_pct"), v/10.0f, 1);
-          //kv_u(F("power_raw"), powerPpm);
+          kv_fix(FLD(power_pct), v, 1);
+          //kv_u(FLD(power_raw), powerPpm);
         }
 
-        kv_c(F("ext_tc_c"), uti_to_c(extTcUTI), 1);
+        kv_fix(FLD(ext_tc_c), uti_to_dc(extTcUTI), 1);
 
         if (flowActPpm == 0xFFFF) {
-          kv_s(F("flow_act"), F("N/A"));
-          //kv_hex(F("flow_raw"), flowActPpm, 4);
+          kv_none(FLD(flow_act), F("N/A"));
+          //kv_hex(FLD(flow_raw), flowActPpm, 4);
         } else {
           uint16_t v = (flowActPpm > 1000) ? 1000 : flowActPpm;
-          kv_c(F("flow_act_pct"), v/10.0f, 1);
-          //kv_u(F("flow_raw"), flowActPpm);
+          kv_fix(FLD(flow_act_pct), v, 1);
+          //kv_u(FLD(flow_raw), flowActPpm);
         }
 
-        kv_s  (F("tts"), fmt_mmss_tenths(tts_ds));
-        kv_hex(F("status"), status, 2);
-        kv_s  (F("status_bits"), ha_status_to_string(status));
-        kv_hex(F("changes"), changes, 2);
-        if (changes) kv_s(F("changes_bits"), sold_changes_to_string(changes));
-        Serial.println();
+        kv_s  (FLD(tts), fmt_mmss_tenths(tts_ds));
+        kv_hex(FLD(status), status, 2);
+        kv_bits(F("status_bits"), BT_HA_STATUS, status, 8, BITS_UNNAMED);
+        kv_hex(FLD(changes), changes, 2);
+        if (changes) kv_bits(F("changes_bits"), BT_CHANGES, changes, 8, BITS_UNNAMED);
+        kv_end();
       }
     }
 
+    print_summary(nPorts, n_on, max_uti, max_ppm, agg_changes);
     if (agg_changes) {
       print_changes_agg(agg_changes);
     }
-    jbc_conti_signal(any_on);
+    if (g_fx) jbc_conti_signal(any_on);
     return true;
   }
 
@@ -1741,199 +1897,47 @@ static bool decode_write_acks(Backend be, uint8_t ctrl, const uint8_t* d, uint8_
   using namespace jbc_cmd;
 
   // 0) Reines ACK-Frame (M_ACK) -> sofort OK
-  if (is_ack_ctrl(ctrl)){
-    print_hdr_line(be, F("ACK")); Serial.print(F("OK"));
-    if (len){ Serial.print(F(" extra=")); print_hex(d, len); }
-    Serial.println();
+  if (is_ack_ctrl(be, ctrl)){
+    print_hdr_line(be, REC(ACK)); kv_word(FLD(result), F("OK"));
+    if (len) kv_raw(FLD(extra), d, len);
+    kv_end();
     return true;
   }
 
   // 1) Spezielle Multi-Byte-ACKs zuerst (schöne Ausgabe)
   if (be == BK_SOLD && ctrl == SOLD_02::M_W_LEVELSTEMPS && len >= 1 && d[0] == 0x06){
-    print_hdr_line(be, F("LEVELSTEMPS/ACK")); Serial.print(F("OK"));
-    if (len >= 2){ Serial.print(F(" port=")); Serial.print(d[1]); }
+    print_hdr_line(be, REC_AS(LEVELSTEMPS_ACK, "LEVELSTEMPS/ACK")); kv_word(FLD(result), F("OK"));
+    if (len >= 2) kv_u(FLD(port), d[1]);
     if (len >= 3){
-      Serial.print(F(" tool=")); Serial.print(d[2]);
-      if (const __FlashStringHelper* tn = sold_tool_name(d[2])){
-        Serial.print(F(" (")); Serial.print(tn); Serial.print(')');
-      }
+      kv_u(FLD(tool), d[2]);
+      if (const __FlashStringHelper* tn = sold_tool_name(d[2])) kv_note(FLD(tool_name), tn);
     }
-    Serial.println();
+    kv_end();
     return true;
   }
   if (be == BK_SOLD && ctrl == SOLD_02::M_W_LOCK_PORT && len >= 1 && d[0] == 0x06){
-    print_hdr_line(be, F("LOCK_PORT/ACK")); Serial.print(F("OK"));
-    if (len >= 2){ Serial.print(F(" port=")); Serial.print(d[1]); }
-    Serial.println();
+    print_hdr_line(be, REC_AS(LOCK_PORT_ACK, "LOCK_PORT/ACK")); kv_word(FLD(result), F("OK"));
+    if (len >= 2) kv_u(FLD(port), d[1]);
+    kv_end();
     return true;
   }
 
-  // 2) Gating: nur für bekannte WRITE-Controls überhaupt ACKs akzeptieren
-  auto is_known_write = [&](Backend b)->bool{
-    switch (b){
-      case BK_SOLD:
-        switch (ctrl){
-          // Identität / Strings / Basics
-          case SOLD_02::M_W_DEVICEID:
-          case SOLD_02::M_W_DEVICENAME:
-          case SOLD_02::M_W_PIN:
-          case SOLD_02::M_W_BEEP:
-          case SOLD_02::M_W_LANGUAGE:
-          case SOLD_02::M_W_TEMPUNIT:
-          case SOLD_02::M_W_TYPEOFGROUND:
-
-          // USB / ETH
-          case SOLD_02::M_W_USB_CONNECTSTATUS:
-          case SOLD_02::M_W_ETH_TCPIPCONFIG:
-          case SOLD_02::M_W_ETH_CONNECTSTATUS:
-
-          // Level-/Port-/Tool-Settings
-          case SOLD_02::M_W_LEVELSTEMPS:
-          case SOLD_02::M_W_SLEEPDELAY:
-          case SOLD_02::M_W_SLEEPTEMP:
-          case SOLD_02::M_W_HIBERDELAY:
-          case SOLD_02::M_W_AJUSTTEMP:
-          case SOLD_02::M_W_CARTRIDGE:
-          case SOLD_02::M_W_SELECTTEMP:
-          case SOLD_02::M_W_SELECTTEMPVOLATILE:
-          case SOLD_02::M_W_LOCK_PORT:
-
-          // Alarm / Limits / Modes
-          case SOLD_02::M_W_ALARMMAXTEMP:
-          case SOLD_02::M_W_ALARMMINTEMP:
-          case SOLD_02::M_W_POWERLIM:
-          case SOLD_02::M_W_QST_ACTIVATE:
-          case SOLD_02::M_W_QST_STATUS:
-          case SOLD_02::M_W_CONTIMODE:
-          case SOLD_02::M_W_REMOTEMODE:
-
-          // Peripherie / Maintenance
-          case SOLD_02::M_W_PERIPHCONFIG:
-          case SOLD_02::M_W_PERIPHSTATUS:
-          case SOLD_02::M_W_RESETCOUNTERS:
-
-          // (nur falls vorhanden in deinen Enums)
-          case SOLD_02::M_W_MAXTEMP:
-          case SOLD_02::M_W_MINTEMP:
-            return true;
-          default: return false;
-        }
-      case BK_HA:
-        switch (ctrl){
-          case HA_02::M_W_DEVICEID:
-          case HA_02::M_W_DEVICENAME:
-          case HA_02::M_W_BEEP:
-          case HA_02::M_W_PIN:
-          case HA_02::M_W_PINENABLED:
-          case HA_02::M_W_STATIONLOCKED:
-          case HA_02::M_W_SELECTTEMP:
-          case HA_02::M_W_SELECTFLOW:
-          case HA_02::M_W_EXTTCMODE:
-          case HA_02::M_W_PROFILEMODE:
-          case HA_02::M_W_AJUSTTEMP:
-          case HA_02::M_W_SELECTEXTTEMP:
-          case HA_02::M_W_TIMETOSTOP:
-          case HA_02::M_W_STARTMODE:
-          case HA_02::M_W_REMOTEMODE:
-          case HA_02::M_W_TEMPUNIT:
-          case HA_02::M_W_LANGUAGE:
-          case HA_02::M_W_MAXMINTEMP:
-          case HA_02::M_W_MAXMINFLOW:
-          case HA_02::M_W_MAXMINEXTTEMP:
-          case HA_02::M_W_LEVELSTEMPS:
-          case HA_02::M_W_HEATERSTATUS:
-          case HA_02::M_W_SUCTIONSTATUS:
-          case HA_02::M_W_USB_CONNECTSTATUS:
-          case HA_02::M_W_DATETIME:
-          case HA_02::M_W_THEME:
-            return true;
-          default: return false;
-        }
-      case BK_PH:
-        switch (ctrl){
-          case PH_02::M_W_DEVICEID:
-          case PH_02::M_W_WORKMODE:
-          case PH_02::M_W_HEATERSTATUS:
-          case PH_02::M_W_EXTTCMODE:
-          case PH_02::M_W_TIMETOSTOP:
-          case PH_02::M_W_SELECTTEMP:
-          case PH_02::M_W_SELECTPOWER:
-          case PH_02::M_W_ACTIVEZONES:
-          case PH_02::M_W_REMOTEMODE:
-          case PH_02::M_W_CONTIMODE:
-          case PH_02::M_W_PROFILE:
-          case PH_02::M_W_SETTINGSPROFILE:
-          case PH_02::M_W_PROFILETEACH:
-          case PH_02::M_W_MAXMINPOWER:
-          case PH_02::M_W_MAXMINTEMP:
-          case PH_02::M_W_PINENABLED:
-          case PH_02::M_W_STATIONLOCKED:
-          case PH_02::M_W_PIN:
-          case PH_02::M_W_DEVICENAME:
-          case PH_02::M_W_BEEP:
-          case PH_02::M_W_USB_CONNECTSTATUS:
-            return true;
-          default: return false;
-        }
-      case BK_FE:
-        switch (ctrl){
-          case FE_02::M_W_DEVICEID:
-          case FE_02::M_W_SUCTIONLEVEL:
-          case FE_02::M_W_SELECTFLOW:
-          case FE_02::M_W_STANDINTAKES:
-          case FE_02::M_W_INTAKEACTIVATION:
-          case FE_02::M_W_SUCTIONDELAY:
-          case FE_02::M_W_ACTIVATIONPEDAL:
-          case FE_02::M_W_PEDALMODE:
-          case FE_02::M_W_PIN:
-          case FE_02::M_W_STATIONLOCKED:
-          case FE_02::M_W_BEEP:
-          case FE_02::M_W_CONTINUOUSSUCTION:
-          case FE_02::M_W_DEVICENAME:
-          case FE_02::M_W_PINENABLED:
-          case FE_02::M_W_WORKINTAKES:
-          case FE_02::M_W_USB_CONNECTSTATUS:
-            return true;
-          default: return false;
-        }
-      case BK_SF:
-        switch (ctrl){
-          case SF_02::M_W_DEVICEID:
-          case SF_02::M_W_DISPENSERMODE:
-          case SF_02::M_W_PROGRAM:
-          case SF_02::M_W_PROGRAMLIST:
-          case SF_02::M_W_SPEED:
-          case SF_02::M_W_LENGTH:
-          case SF_02::M_W_BACKWARDMODE:
-          case SF_02::M_W_PIN:
-          case SF_02::M_W_STATIONLOCKED:
-          case SF_02::M_W_BEEP:
-          case SF_02::M_W_LENGTHUNIT:
-          case SF_02::M_W_DEVICENAME:
-          case SF_02::M_W_TOOLENABLED:
-          case SF_02::M_W_USB_CONNECTSTATUS:
-            return true;
-          default: return false;
-        }
-      default: return false;
-    }
-  };
+  // 2) Gating: nur für bekannte WRITE-Controls überhaupt ACKs akzeptieren (CM_EXPECT_ACK)
 
 
   // 3) Generischer Mehrbyte-ACK: erstes Byte 0x06 => OK (z. B. "06 00")
-  if (is_known_write(be) && len >= 1 && d[0] == 0x06) {
-    print_hdr_line(be, F("ACK"));             // gibt [ACK] und ggf. <fid=...> aus
-    Serial.print(F("OK"));
-    if (len >= 2) { Serial.print(F(" port=")); Serial.print(d[1]); }
+  if (jbc_meta::ctrl_is(be, ctrl, jbc_meta::CM_EXPECT_ACK) && len >= 1 && d[0] == 0x06) {
+    print_hdr_line(be, REC(ACK));             // gibt [ACK] und ggf. <fid=...> aus
+    kv_word(FLD(result), F("OK"));
+    if (len >= 2) kv_u(FLD(port), d[1]);
     if (len >= 3) {
-      Serial.print(F(" tool=")); Serial.print(d[2]);
+      kv_u(FLD(tool), d[2]);
       if (const __FlashStringHelper* tn =
-            (be==BK_HA ? ha_tool_name(d[2]) : sold_tool_name(d[2]))){
-        Serial.print(F(" (")); Serial.print(tn); Serial.print(')');
-      }
+            (be==BK_HA ? ha_tool_name(d[2]) : sold_tool_name(d[2])))
+        kv_note(FLD(tool_name), tn);
     }
-    if (len > 3) { Serial.print(F(" extra=")); print_hex(&d[3], len-3); }
-    Serial.println();
+    if (len > 3) kv_raw(FLD(extra), &d[3], len-3);
+    kv_end();
     return true;
   }
 
@@ -1946,44 +1950,44 @@ static bool decode_write_acks(Backend be, uint8_t ctrl, const uint8_t* d, uint8_
 
 // NACK hübsch ausgeben (Family-agnostisch)
 static bool decode_nack(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t len){
-  if (!is_nack_ctrl(ctrl)) return false;
+  if (!is_nack_ctrl(be, ctrl)) return false;
 
-  print_hdr_line(be, F("NACK"));
+  print_hdr_line(be, REC(NACK));
 
   // reason + Name
   if (len >= 1){
     const uint8_t r = d[0];
-    kv_hex(F("reason"), r, 2);
-    if (const char* rn = nack_reason_name(r)) kv_s(F("reason_name"), String(rn));
+    kv_hex(FLD(reason), r, 2);
+    if (const __FlashStringHelper* rn = nack_reason_name(r)) kv_fs(FLD(reason_name), rn);
   } else {
-    kv_fs(F("reason"), F("?"));
+    kv_none(FLD(reason), F("?"));
   }
 
   // echo command
-  if (len >= 2) kv_hex(F("cmd"), d[1], 2);
+  if (len >= 2) kv_hex(FLD(cmd), d[1], 2);
 
   // häufiges Layout: arg0[, port[, tool[, tail…]]]
   if (len >= 3){
-    kv_hex(F("arg0"), d[2], 2);
+    kv_hex(FLD(arg0), d[2], 2);
   }
   if (len >= 4){
-    kv_u(F("port"), d[3]);
+    kv_u(FLD(port), d[3]);
   }
   if (len >= 5){
     const uint8_t tool = d[4];
-    kv_u(F("tool"), tool);
+    kv_u(FLD(tool), tool);
     // optional Toolname je Familie
     const __FlashStringHelper* tn =
         (be==BK_HA)   ? ha_tool_name(tool) :
         (be==BK_SOLD || be==BK_SOLD1) ? sold_tool_name(tool) : nullptr;
-    if (tn) kv_fs(F("tool_name"), tn);
+    if (tn) kv_fs(FLD(tool_name), tn);
   }
   // alles darüber als Tail anzeigen
   if (len > 5){
-    kv_s(F("tail"), hex_string(&d[5], (uint8_t)(len-5)));
+    kv_s(FLD(tail), hex_string(&d[5], (uint8_t)(len-5)));
   }
 
-  Serial.println();
+  kv_end();
   return true;
 }
 
@@ -1997,7 +2001,7 @@ static bool decode_devicename(Backend be, uint8_t ctrl, const uint8_t* d, uint8_
     if (len < 1) return false;
     String s = sanitize_ascii(d,len);
     if (s.length()==0) return false;
-    print_hdr_line(be, F("M_R_DEVICENAME")); kv_s(F("name"), s); Serial.println();
+    print_hdr_line(be, REC(M_R_DEVICENAME)); kv_s(FLD(name), s); kv_end();
     return true;
   }
    return false;
@@ -2011,66 +2015,48 @@ static bool decode_firmware(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
         ctrl == FE_02::M_FIRMWARE   || ctrl == SF_02::M_FIRMWARE)) return false;
 
 
-  String s = sanitize_ascii(d, len);
+  // Identität einmal parsen (on_inner_frame hat sie meist schon im Cache)
+  const jbc_name::StationIdentity& id = jbc_name::station_identity(d, len);
 
-  // Erste Zeile: kompletter String (wie bisher)
-  print_hdr_line(be, F("M_FIRMWARE")); 
-  kv_s(F("string"), s);
-  Serial.println();
+  // Erste Zeile: kompletter String (wie bisher, Steuerzeichen verworfen)
+  print_hdr_line(be, REC(M_FIRMWARE));
+  kv_str_open(FLD(string));
+  for (uint8_t i=0;i<len;i++){
+    char c=(char)d[i];
+    if (c<0x20 || c==0x7F) continue;
+    kv_str_char(c);
+  }
+  kv_str_close();
+  if (id.truncated) kv_u(FLD(truncated), 1);   // Felder unten nur aus dem Anfang der Zeile
+  kv_end();
 
   // Erwartetes Format: PROTO:MODELSTR:SW:HW
-  int p1 = s.indexOf(':'), p2 = s.indexOf(':', p1+1), p3 = s.indexOf(':', p2+1);
-  if (p1 > 0 && p2 > p1 && p3 > p2){
-    String proto    = s.substring(0,   p1);
-    String modelStr = s.substring(p1+1,p2);
-    String sw       = s.substring(p2+1,p3);
-    String hw       = s.substring(p3+1);
-
+  if (id.has_fields()){
     // Hübsch: Proto / SW / HW
-    print_hdr_line(be, F("PK/FW/HW"));
-    kv_s(F("proto"), proto);
-    kv_s(F("sw"),    sw);
-    kv_s(F("hw"),    hw);
-    Serial.println();
-
-    // MODELSTR → Model / ModelType / ModelVersion
-    int u1 = modelStr.indexOf('_');
-    int u2 = (u1 >= 0) ? modelStr.indexOf('_', u1+1) : -1;
-    if (u1 > 0 && u2 > u1){
-      String model   = modelStr.substring(0,    u1);   // z.B. "DDE"
-      String mtype   = modelStr.substring(u1+1, u2);   // z.B. "CAP26"
-      String verStr  = modelStr.substring(u2+1);       // z.B. "06"
-      uint32_t mver  = (uint32_t)verStr.toInt();       // → 6
-
-      // >>> NEU: Portanzahl bestimmen & merken
-      g_station_ports = ports_for_model_tag(model);
-
-      print_hdr_line(be, F("MODEL"));
-      kv_s(F("name"), model);
-      kv_s(F("type"), mtype);
-      kv_u(F("ver"),  mver);
-      kv_u(F("ports"), g_station_ports);   // <<< NEU: mitloggen
-      Serial.println();
-    } else {
-      // Fallback: nur der Mittelteil als Name
-      String model = modelStr;
+    print_hdr_line(be, REC_AS(PK_FW_HW, "PK/FW/HW"));
+    kv_s(FLD(proto), id.proto());
+    kv_s(FLD(sw),    id.str(id.sw));
+    kv_s(FLD(hw),    id.str(id.hw));
+    kv_end();
 
-      // >>> NEU: auch im Fallback Ports bestimmen
-      g_station_ports = ports_for_model_tag(model);
+    // >>> NEU: Portanzahl bestimmen & merken
+    if (g_fx) g_station_ports = id.ports;
 
-      print_hdr_line(be, F("MODEL"));
-      kv_s(F("name"), model);
-      kv_u(F("ports"), g_station_ports);   // <<< NEU
-      Serial.println();
+    // MODELSTR → Model / ModelType / ModelVersion
+    print_hdr_line(be, REC(MODEL));
+    kv_s(FLD(name), id.str(id.model));        // z.B. "DDE"
+    if (id.has_type()){
+      kv_s(FLD(type), id.str(id.type));       // z.B. "CAP26"
+      kv_u(FLD(ver),  id.ver);                // "06" → 6
     }
+    kv_u(FLD(ports), g_station_ports);        // <<< NEU: mitloggen
+    kv_end();
     return true;
   }
 
   // Fallback für ältere/abweichende Strings: alter Zweizeiler
-  int a = s.indexOf(':'), b = s.indexOf(':', a+1);
-  if (a > 0 && b > a){
-    String model = s.substring(a+1, b);
-    print_hdr_line(be, F("MODEL")); kv_s(F("name"), model); Serial.println();
+  if (id.has_model()){
+    print_hdr_line(be, REC(MODEL)); kv_s(FLD(name), id.str(id.model)); kv_end();
   }
   return true;
 }
@@ -2080,11 +2066,11 @@ static bool decode_deviceid(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   if (ctrl==SOLD_02::M_R_DEVICEID || ctrl==HA_02::M_R_DEVICEID ||
       ctrl==FE_02::M_R_DEVICEID   || ctrl==PH_02::M_R_DEVICEID ||
       ctrl==SF_02::M_R_DEVICEID){
-    print_hdr_line(be, F("M_R_DEVICEID"));
-    if(len==0){ kv_fs(F("text"), F("")); Serial.println(); return true; }
+    print_hdr_line(be, REC(M_R_DEVICEID));
+    if(len==0){ kv_fs(FLD(text), F("")); kv_end(); return true; }
     String s = sanitize_ascii(d,len);
-    if (s.length()) kv_s(F("text"), s); else kv_s(F("raw"), hex_string(d,len));
-    Serial.println();
+    if (s.length()) kv_s(FLD(text), s); else kv_s(FLD(raw), hex_string(d,len));
+    kv_end();
     return true;
   }
   return false;
@@ -2102,8 +2088,8 @@ static bool decode_deviceid_original(Backend be, uint8_t ctrl, const uint8_t* d,
 
   if(!match) return false;
 
-  print_hdr_line(be, F("M_R_DEVICEIDORIGINAL"));
-  if(len != 16){ Serial.print(F(" raw=")); print_hex(d,len); Serial.println(); return true; }
+  print_hdr_line(be, REC(M_R_DEVICEIDORIGINAL));
+  if(len != 16){ kv_raw(FLD(raw), d, len); kv_end(); return true; }
 
   // 4x u32 LE
   uint32_t w0 = u32le(&d[0]);
@@ -2113,13 +2099,13 @@ static bool decode_deviceid_original(Backend be, uint8_t ctrl, const uint8_t* d,
 
   uint16_t vid = u16le(&d[0]);
   uint16_t pid = u16le(&d[2]);
-  kv_u(F("vid"), vid);
-  kv_u(F("pid"), pid);
-  kv_hex(F("w0"), w0, 8);
-  kv_hex(F("w1"), w1, 8);
-  kv_hex(F("w2"), w2, 8);
-  kv_hex(F("w3"), w3, 8);
-  Serial.println();
+  kv_u(FLD(vid), vid);
+  kv_u(FLD(pid), pid);
+  kv_hex(FLD(w0), w0, 8);
+  kv_hex(FLD(w1), w1, 8);
+  kv_hex(FLD(w2), w2, 8);
+  kv_hex(FLD(w3), w3, 8);
+  kv_end();
   return true;
 }
 
@@ -2135,8 +2121,8 @@ static bool decode_inf_port(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   // ---- HOT AIR (HA_02) ----
   if (be == BK_HA) {
     if (len < 14) {
-      print_hdr_line(be, F("M_INF_PORT")); Serial.print(F(" payload=")); Serial.print(len); Serial.print('B');
-      Serial.print(F(" raw=")); print_hex(d,len); Serial.println();
+      print_hdr_line(be, REC(M_INF_PORT)); kv_u(FLD(payload), len); if (!g_fmt) Serial.print('B');
+      kv_raw(FLD(raw), d, len); kv_end();
       return true;
     }
 
@@ -2149,20 +2135,20 @@ static bool decode_inf_port(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
     const uint16_t tts_ds      = u16le(&d[10]);  // Zehntelsekunden
     const bool     hasChanges  = (len >= 15);
     const uint8_t  changesMask = hasChanges ? d[len-1] : 0;
-    print_hdr_line(be, F("M_INF_PORT"));
-    if (const __FlashStringHelper* tn = ha_tool_name(tool)) kv_fs(F("tool"), tn); else kv_u(F("tool_code"), tool);
-    kv_c(F("air_c"), uti_to_c(airTempUTI), 1);
-    kv_c(F("prot_tc_c"), uti_to_c(protTcUTI), 1);
-    { uint16_t v = powerRaw>1000?1000:powerRaw; kv_c(F("power_pct"), v/10.0f, 1); }
-    { uint16_t v = flowRaw >1000?1000:flowRaw;  kv_c(F("flow_pct"),  v/10.0f, 1); }
+    print_hdr_line(be, REC(M_INF_PORT));
+    if (const __FlashStringHelper* tn = ha_tool_name(tool)) kv_fs(FLD(tool), tn); else kv_u(FLD(tool_code), tool);
+    kv_fix(FLD(air_c), uti_to_dc(airTempUTI), 1);
+    kv_fix(FLD(prot_tc_c), uti_to_dc(protTcUTI), 1);
+    { uint16_t v = powerRaw>1000?1000:powerRaw; kv_fix(FLD(power_pct), v, 1); }
+    { uint16_t v = flowRaw >1000?1000:flowRaw;  kv_fix(FLD(flow_pct), v, 1); }
     { const uint32_t total_s = tts_ds/10; const uint8_t t=tts_ds%10;
       char buf[8]; snprintf(buf, sizeof(buf), "%02u:%02u", (unsigned)(total_s/60), (unsigned)(total_s%60));
-      String s(buf); if (t) { s += '.'; s += char('0'+t); } kv_s(F("tts"), s);
+      String s(buf); if (t) { s += '.'; s += char('0'+t); } kv_s(FLD(tts), s);
     }
-    kv_hex(F("status"), statusFlags, 2);
-    if (hasChanges) kv_hex(F("changes"), changesMask, 2);
-    kv_s  (F("status_text"), ha_status_to_string(statusFlags));
-    Serial.println();
+    kv_hex(FLD(status), statusFlags, 2);
+    if (hasChanges) kv_hex(FLD(changes), changesMask, 2);
+    kv_bits(F("status_text"), BT_HA_STATUS, statusFlags, 8, BITS_UNNAMED);
+    kv_end();
     return true;
   }
     
@@ -2171,8 +2157,8 @@ static bool decode_inf_port(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   // ---- PREHEATER (PH_02) ----
   if (be == BK_PH) {
     if (len < 12) {
-      print_hdr_line(be, F("M_INF_PORT")); Serial.print(F(" payload=")); Serial.print(len); Serial.print('B');
-      Serial.print(F(" raw=")); print_hex(d,len); Serial.println();
+      print_hdr_line(be, REC(M_INF_PORT)); kv_u(FLD(payload), len); if (!g_fmt) Serial.print('B');
+      kv_raw(FLD(raw), d, len); kv_end();
       return true;
     }
     const uint8_t  tool      = d[0];
@@ -2182,21 +2168,22 @@ static bool decode_inf_port(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
     const uint16_t powerRaw  = u16le(&d[8]);
     const uint8_t  flags8    = (len >= 11) ? d[10] : 0;
 
-    print_hdr_line(be, F("M_INF_PORT"));
-    if (const __FlashStringHelper* tn = sold_tool_name(tool)) kv_fs(F("tool"), tn); else kv_u(F("tool_code"), tool);
-    kv_c(F("temp_c"),  uti_to_c(tempUTI),1);
-    kv_c(F("ext_tc_c"),uti_to_c(extTcUTI),1);
-    kv_u(F("heater_raw"), heaterRaw);
-    kv_u(F("power_raw"),  powerRaw);
-    kv_hex(F("flags"), flags8, 2);
-    Serial.println();
+    print_hdr_line(be, REC(M_INF_PORT));
+    if (const __FlashStringHelper* tn = sold_tool_name(tool)) kv_fs(FLD(tool), tn); else kv_u(FLD(tool_code), tool);
+    kv_fix(FLD(temp_c), uti_to_dc(tempUTI), 1);
+    kv_fix(FLD(ext_tc_c), uti_to_dc(extTcUTI), 1);
+    kv_u(FLD(heater_raw), heaterRaw);
+    kv_u(FLD(power_raw),  powerRaw);
+    kv_hex(FLD(flags), flags8, 2);
+    kv_end();
     return true;
   }
 
   // ---- SOLDER (SOLD_02/SOLD_01) ----
   if (len < 12) {
+    if (g_fmt) { print_hdr_line(be, REC(M_INF_PORT)); kv_u(FLD(payload), len); kv_raw(FLD(raw), d, len); kv_end(); return true; }
     Serial.print(F("  payload ")); Serial.print(len); Serial.println(F(" bytes (zu kurz)"));
-    Serial.print(F("  raw: ")); print_hex(d,len); Serial.println();
+    Serial.print(F("  raw: ")); print_hex(d,len); kv_end();
     return true;
   }
 
@@ -2205,39 +2192,39 @@ static bool decode_inf_port(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t
   const uint16_t tip1UTI = u16le(&d[2]);
   const uint16_t tip2UTI = u16le(&d[4]);
 
-  print_hdr_line(be, F("M_INF_PORT"));
-  if (const __FlashStringHelper* tn = sold_tool_name(tool)) kv_fs(F("tool"), tn); else kv_u(F("tool_code"), tool);
-  kv_u(F("tool_err"), toolErr);
-  if (const __FlashStringHelper* te = tool_error_name_fam(be, toolErr)) kv_fs(F("tool_err_name"), te);
-  kv_c(F("tip1_c"), uti_to_c(tip1UTI), 1);
-  kv_c(F("tip2_c"), uti_to_c(tip2UTI), 1); 
+  print_hdr_line(be, REC(M_INF_PORT));
+  if (const __FlashStringHelper* tn = sold_tool_name(tool)) kv_fs(FLD(tool), tn); else kv_u(FLD(tool_code), tool);
+  kv_u(FLD(tool_err), toolErr);
+  if (const __FlashStringHelper* te = tool_error_name_fam(be, toolErr)) kv_fs(FLD(tool_err_name), te);
+  kv_fix(FLD(tip1_c), uti_to_dc(tip1UTI), 1);
+  kv_fix(FLD(tip2_c), uti_to_dc(tip2UTI), 1); 
 
   const uint16_t pwr1_ppm = u16le(&d[6]);
   const uint16_t pwr2_ppm = u16le(&d[8]);
-  const float pwr1_pct = (pwr1_ppm > 1000 ? 1000 : pwr1_ppm) / 10.0f;
-  const float pwr2_pct = (pwr2_ppm > 1000 ? 1000 : pwr2_ppm) / 10.0f;
-  kv_c(F("pwr1_pct"), pwr1_pct, 1);
-  kv_c(F("pwr2_pct"), pwr2_pct, 1);
+  const uint16_t pwr1_pct = pwr1_ppm > 1000 ? 1000 : pwr1_ppm;   // Zehntel-%
+  const uint16_t pwr2_pct = pwr2_ppm > 1000 ? 1000 : pwr2_ppm;
+  kv_fix(FLD(pwr1_pct), pwr1_pct, 1);
+  kv_fix(FLD(pwr2_pct), pwr2_pct, 1);
 
   if (be == BK_SOLD || be == BK_UNKNOWN) {
     if (len >= 11) {
       const uint8_t flags8 = d[10];
-      kv_hex(F("flags"), flags8, 2);
-      kv_s  (F("flags_bits"), sold_status_to_string(flags8));
+      kv_hex(FLD(flags), flags8, 2);
+      kv_bits(F("flags_bits"), BT_SOLD_STATUS, flags8, 8, BITS_UNNAMED);
     }
     if (len >= 12) {
       const uint8_t changes = d[11];
-      kv_hex(F("changes"), changes, 2);
-      kv_s  (F("changes_bits"), sold_changes_to_string(changes));
+      kv_hex(FLD(changes), changes, 2);
+      kv_bits(F("changes_bits"), BT_CHANGES, changes, 8, BITS_UNNAMED);
     }
-    Serial.println();
+    kv_end();
   } else if (be == BK_SOLD1) {
     if (len >= 12) {
       const uint8_t changes = d[11];
-      kv_hex(F("changes"), changes, 2);
-      kv_s  (F("changes_bits"), sold_changes_to_string(changes));
+      kv_hex(FLD(changes), changes, 2);
+      kv_bits(F("changes_bits"), BT_CHANGES, changes, 8, BITS_UNNAMED);
     }
-    Serial.println();
+    kv_end();
   }
 
   return true;
@@ -2251,21 +2238,21 @@ static bool decode_sold_statustool(Backend be, uint8_t ctrl, const uint8_t* d, u
     const bool is16 = (len >= 2);
     const uint16_t v = is16 ? u16le(d) : d[0];
 
-    print_hdr_line(be, F("M_R_STATUSTOOL"));
-    kv_hex(F("mask"), v, is16 ? 4 : 2);
+    print_hdr_line(be, REC(M_R_STATUSTOOL));
+    kv_hex(FLD(mask), v, is16 ? 4 : 2);
 
     if (v == 0){
-      kv_fs(F("bits"), F("NONE"));
-      Serial.println();
+      kv_bits(F("bits"), BT_SOLD_STATUSTOOL, 0, 16, 0);   // "NONE"; binär entfällt es wie alle Bit-Namen
+      kv_end();
       return true;
     }
 
     if (is16){
-      kv_s(F("bits"), sold_statustool_bits_to_string(v));   // <<< neu
+      kv_bits(F("bits"), BT_SOLD_STATUSTOOL, v, 16, BITS_UNNAMED);   // <<< neu
     } else {
-      kv_s(F("bits"), sold_status_to_string(uint8_t(v)));    // 8-Bit Altfall
+      kv_bits(F("bits"), BT_SOLD_STATUS, uint8_t(v), 8, BITS_UNNAMED);    // 8-Bit Altfall
     }
-    Serial.println();
+    kv_end();
     return true;
   }
   return false;
@@ -2280,14 +2267,9 @@ static bool decode_ha_statustool(Backend be, uint8_t ctrl, const uint8_t* d, uin
 
   const uint16_t v = (len >= 2) ? u16le(d) : (uint16_t)d[0];
   const uint8_t  s = uint8_t(v & 0xFF);
-  print_hdr_line(be, F("M_R_STATUSTOOL")); kv_hex(F("mask"), s, 2);
-  String bits; struct { uint8_t bit; const char* name; } B[]={
-    {1,"HEATER"},{2,"HEATER_REQUESTED"},{4,"COOLING"},{8,"SUCTION"},
-    {16,"SUCTION_REQUESTED"},{32,"PEDAL_CONNECTED"},{64,"PEDAL_PRESSED"},{128,"STAND"}
-  };
-  for (auto &b:B){ if (s & b.bit){ if(bits.length()) bits+='|'; bits+=b.name; } }
-  if(bits.length()) kv_s(F("bits"), bits);
-  Serial.println();
+  print_hdr_line(be, REC(M_R_STATUSTOOL)); kv_hex(FLD(mask), s, 2);
+  if (s) kv_bits(F("bits"), BT_HA_STATUS, s, 8, 0);
+  kv_end();
   return true;
 }
 
@@ -2299,17 +2281,17 @@ static bool decode_common_u16(Backend be, uint8_t ctrl, const uint8_t* d, uint8_
   // SELECTTEMP (read, UTI)
   if ((be==BK_SOLD || be==BK_SOLD1) && (ctrl==SOLD_02::M_R_SELECTTEMP || ctrl==SOLD_01::M_R_SELECTTEMP)) {
     uint16_t v=u16le(d);
-    print_hdr_line(be, F("M_R_SELECTTEMP")); kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v, 4); Serial.println();
+    print_hdr_line(be, REC(M_R_SELECTTEMP)); kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v, 4); kv_end();
     return true;
   }
   if (be==BK_HA && ctrl==HA_02::M_R_SELECTTEMP) {
     uint16_t v=u16le(d);
-    print_hdr_line(be, F("M_R_SELECTTEMP")); kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v, 4); Serial.println();
+    print_hdr_line(be, REC(M_R_SELECTTEMP)); kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v, 4); kv_end();
     return true;
   }
   if (be==BK_PH && ctrl==PH_02::M_R_SELECTTEMP) {
     uint16_t v=u16le(d);
-    print_hdr_line(be, F("M_R_SELECTTEMP")); kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v, 4); Serial.println();
+    print_hdr_line(be, REC(M_R_SELECTTEMP)); kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v, 4); kv_end();
     return true;
   }
 
@@ -2317,7 +2299,7 @@ static bool decode_common_u16(Backend be, uint8_t ctrl, const uint8_t* d, uint8_
   if ((be==BK_SOLD || be==BK_SOLD1) &&
       (ctrl==SOLD_02::M_R_TIPTEMP || ctrl==SOLD_01::M_R_TIPTEMP)){
     uint16_t v=u16le(d);
-    print_hdr_line(be, F("M_R_TIPTEMP")); kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v, 4); Serial.println();
+    print_hdr_line(be, REC(M_R_TIPTEMP)); kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v, 4); kv_end();
     return true;
   }
 
@@ -2325,7 +2307,7 @@ static bool decode_common_u16(Backend be, uint8_t ctrl, const uint8_t* d, uint8_
   if ((be==BK_SOLD || be==BK_SOLD1) &&
       (ctrl==SOLD_02::M_R_POWER || ctrl==SOLD_01::M_R_POWER)){
     uint16_t v=u16le(d);
-    print_hdr_line(be, F("M_R_POWER")); kv_u(F("raw"), v); Serial.println();
+    print_hdr_line(be, REC(M_R_POWER)); kv_u(FLD(raw), v); kv_end();
     return true;
   }
 
@@ -2333,33 +2315,33 @@ static bool decode_common_u16(Backend be, uint8_t ctrl, const uint8_t* d, uint8_
   if ((be==BK_SOLD || be==BK_SOLD1) &&
       (ctrl==SOLD_02::M_R_CURRENT || ctrl==SOLD_01::M_R_CURRENT)){
     uint16_t v=u16le(d);
-    print_hdr_line(be, F("M_R_CURRENT")); kv_u(F("raw"), v); Serial.println();
+    print_hdr_line(be, REC(M_R_CURRENT)); kv_u(FLD(raw), v); kv_end();
     return true;
   }
 
   // AIRTEMP (HA)
   if (be==BK_HA && ctrl==HA_02::M_R_AIRTEMP){
     uint16_t v=u16le(d);
-    print_hdr_line(be, F("M_R_AIRTEMP")); kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v, 4); Serial.println();
+    print_hdr_line(be, REC(M_R_AIRTEMP)); kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v, 4); kv_end();
     return true;
   }
 
   // EXTTCTEMP (HA + PH)
   if (be==BK_HA && ctrl==HA_02::M_R_EXTTCTEMP){
     uint16_t v=u16le(d);
-    print_hdr_line(be, F("M_R_EXTTCTEMP")); kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v, 4); Serial.println();
+    print_hdr_line(be, REC(M_R_EXTTCTEMP)); kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v, 4); kv_end();
     return true;
   }
   if (be==BK_PH && ctrl==PH_02::M_R_EXTTCTEMP){
     uint16_t v=u16le(d);
-    print_hdr_line(be, F("M_R_EXTTCTEMP")); kv_c(F("c"), uti_to_c(v),1); kv_hex(F("uti"), v, 4); Serial.println();
+    print_hdr_line(be, REC(M_R_EXTTCTEMP)); kv_fix(FLD(c), uti_to_dc(v), 1); kv_hex(FLD(uti), v, 4); kv_end();
     return true;
   }
 
   // SELECTPOWER (PH) → %
   if (be==BK_PH && ctrl==PH_02::M_R_SELECTPOWER){
     uint16_t ppm=u16le(d); if(ppm>1000) ppm=1000;
-    print_hdr_line(be, F("M_R_SELECTPOWER")); kv_c(F("pct"), ppm/10.0f, 1); kv_u(F("raw"), ppm); Serial.println();
+    print_hdr_line(be, REC(M_R_SELECTPOWER)); kv_fix(FLD(pct), ppm, 1); kv_u(FLD(raw), ppm); kv_end();
     return true;
   }
 
@@ -2368,7 +2350,7 @@ static bool decode_common_u16(Backend be, uint8_t ctrl, const uint8_t* d, uint8_
 
 // --- dispatcher API ---
 static bool decode_payload_and_print(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t len){
-  if (!g_log_show_syn && is_syn_ctrl(ctrl)) return true;
+  if (!g_log_show_syn && is_syn_ctrl(be, ctrl)) return true;
 
   
   // zuerst NACK/ACK behandeln
@@ -2424,9 +2406,11 @@ static bool decode_payload_and_print(Backend be, uint8_t ctrl, const uint8_t* d,
 
 static bool print(Backend be, uint8_t ctrl, const uint8_t* d, uint8_t len){
   if (decode_payload_and_print(be, ctrl, d, len)) return true;
-  if (!g_log_show_syn && is_syn_ctrl(ctrl)) return true;
-  print_hdr_tag(F("PAYLOAD")); Serial.print(len); Serial.print(F(" bytes: "));
-  print_hex(d,len); Serial.println();
+  if (!g_log_show_syn && is_syn_ctrl(be, ctrl)) return true;
+  print_hdr_tag(REC(PAYLOAD));
+  if (g_fmt) { kv_u(FLD(len), len); kv_raw(FLD(raw), d, len); }
+  else { Serial.print(len); Serial.print(F(" bytes: ")); print_hex(d,len); }
+  kv_end();
   return false;
 }
 
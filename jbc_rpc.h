@@ -0,0 +1,95 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+
+#pragma once
+#include <Arduino.h>
+
+// ---- Binäres RPC (Serial1): COBS-Rahmen mit CRC16 und Request-ID ----
+// Anfrage: COBS( <op> <id lo> <id hi> <args...> <crc lo> <crc hi> ) 00
+// Antwort: COBS( <op|0x80> <id lo> <id hi> <status> <daten...> <crc lo> <crc hi> ) 00
+// CRC-16/CCITT-FALSE (Poly 0x1021, Start 0xFFFF) über alles vor der CRC.
+// Rahmen mit falscher CRC werden ohne Antwort verworfen (die ID ist dann nicht sicher).
+namespace jbc_rpc {
+
+static const uint8_t VERSION     = 1;
+static const uint8_t PAYLOAD_MAX = 48;                       // JBC-Payload je Anfrage (== jbc_cli::handle)
+static const uint8_t FRAME_MAX   = 3 + 1 + PAYLOAD_MAX + 2;  // größte dekodierte Anfrage
+static const uint8_t DATA_MAX    = 96;                       // Antwortdaten, länger = ST_TRUNC
+
+enum : uint8_t {
+  OP_PING    = 0x01,   // -> VERSION
+  OP_STATUS  = 0x02,   // -> flags proto backend st_addr queued pending uptime_ms(u32)
+  OP_JBC     = 0x10,   // ctrl payload... -> ctrl payload... (Antwort der Station)
+  OP_CFG_GET = 0x20,   // key -> key value
+  OP_CFG_SET = 0x21,   // key value -> key value
+  OP_RESP    = 0x80
+};
+enum : uint8_t {
+  ST_OK = 0, ST_BAD_OP = 1, ST_BAD_ARG = 2, ST_BUSY = 3, ST_RATE = 4,
+  ST_NOLINK = 5, ST_TIMEOUT = 6, ST_TRUNC = 7
+};
+// OP_STATUS flags
+enum : uint8_t { SF_LINK = 0x01, SF_READY = 0x02, SF_ATTACHED = 0x04, SF_RELAY = 0x08 };
+// Schlüssel für OP_CFG_GET/SET (Werte je 1 Byte)
+enum : uint8_t {
+  K_AUTO_USB_C = 1, K_CONTISEND = 2, K_USBCLI = 3, K_OUT_USB = 4, K_OUT_S1 = 5,
+  K_RATE_S1 = 6, K_BURST_S1 = 7, K_RPC = 8,     // K_RPC = 0: zurück zur Text-CLI
+  K_CONTIDELTA = 9                              // an/aus, Totbänder bleiben
+};
+
+static uint16_t crc16(const uint8_t* p, uint8_t n){
+  uint16_t c = 0xFFFF;
+  while (n--){
+    c ^= (uint16_t)*p++ << 8;
+    for (uint8_t b=0; b<8; b++) c = (c & 0x8000) ? (uint16_t)((c << 1) ^ 0x1021) : (uint16_t)(c << 1);
+  }
+  return c;
+}
+
+// In place dekodieren (ohne die abschließende 00); liefert die Länge, 0xFF = kaputt
+static uint8_t cobs_decode(uint8_t* p, uint8_t n){
+  uint8_t r = 0, w = 0;
+  while (r < n){
+    const uint8_t code = p[r++];
+    if (!code || r + code - 1 > n) return 0xFF;
+    for (uint8_t i=1; i<code; i++) p[w++] = p[r++];
+    if (code != 0xFF && r < n) p[w++] = 0;
+  }
+  return w;
+}
+
+// Kodieren samt abschließender 00; out braucht n + n/254 + 2 Bytes
+static uint8_t cobs_encode(const uint8_t* p, uint8_t n, uint8_t* out){
+  uint8_t at = 0, w = 1, code = 1;
+  for (uint8_t i=0; i<n; i++){
+    if (p[i]) { out[w++] = p[i]; code++; }
+    if (!p[i] || code == 0xFF) { out[at] = code; at = w++; code = 1; }
+  }
+  out[at] = code;
+  out[w++] = 0;
+  return w;
+}
+
+// Empfang: Bytes bis zur 00 sammeln
+struct Rx {
+  uint8_t  buf[FRAME_MAX + 2];   // kodiert: + Code-Bytes
+  uint8_t  n = 0;
+  bool     over = false;
+  uint32_t bad = 0;              // Überlauf / COBS- / CRC-Fehler
+};
+// Byte c übernehmen; bei Rahmenende die dekodierte Länge (in r.buf), sonst 0
+static uint8_t rx_push(Rx& r, uint8_t c){
+  if (c){
+    if (r.n < sizeof(r.buf)) r.buf[r.n++] = c; else r.over = true;
+    return 0;
+  }
+  uint8_t len = 0;
+  if (r.over) r.bad++;
+  else if (r.n){
+    len = cobs_decode(r.buf, r.n);
+    if (len == 0xFF) { r.bad++; len = 0; }
+  }
+  r.n = 0; r.over = false;
+  return len;
+}
+
+} // namespace jbc_rpc
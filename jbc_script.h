@@ -0,0 +1,97 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+
+#pragma once
+#include <Arduino.h>
+#include <EEPROM.h>
+#include "jbc_cmd_names.h"   // Backend
+
+// ---- Kommando-Skripte im EEPROM ----
+// Ab BASE liegen die Skripte lückenlos hintereinander, ein Byte != MAGIC beendet die Kette
+// (gelöschtes EEPROM = 0xFF). Je Skript: Hdr + Schritte [ctrl][len][payload...],
+// also schon kodiert (kein Text) – die Ctrl-IDs gelten für hdr.backend (BK_UNKNOWN = jedes).
+namespace jbc_script {
+
+static const uint16_t BASE     = 64;     // 0..63: Cfg (+ Reserve)
+static const uint16_t END      = 1024;   // exklusiv
+static const uint8_t  MAGIC    = 0x53;   // 'S'
+static const uint8_t  NAME_LEN = 8;
+static const uint8_t  STEP_MAX = 48;     // Payload je Schritt (== jbc_cli::handle)
+static const uint8_t  F_AUTORUN = 0x01;  // nach Link-Up + FW automatisch starten
+
+struct Hdr {
+  uint8_t  magic;
+  char     name[NAME_LEN];   // Großbuchstaben, mit '\0' aufgefüllt (bei 8 Zeichen ohne)
+  uint8_t  backend;
+  uint8_t  flags;
+  uint8_t  steps;
+  uint16_t gap_ms;           // Abstand zwischen Antwort und nächstem Schritt
+  uint16_t len;              // Bytes der Schritte
+  uint8_t  crc;              // XOR über Hdr (crc = 0) und Schritte
+};
+
+inline uint16_t body(uint16_t a){ return (uint16_t)(a + sizeof(Hdr)); }
+inline uint16_t next(uint16_t a, const Hdr& h){ return (uint16_t)(body(a) + h.len); }
+
+// Header an a lesen; false = Ende der Kette (oder kaputt)
+inline bool read_hdr(uint16_t a, Hdr& h){
+  if (a < BASE || body(a) > END) return false;
+  EEPROM.get(a, h);
+  return h.magic == MAGIC && next(a, h) <= END;
+}
+
+// Erste freie Adresse (Ende der Kette)
+inline uint16_t end_addr(){
+  Hdr h; uint16_t a = BASE;
+  while (read_hdr(a, h)) a = next(a, h);
+  return a;
+}
+
+inline bool name_is(const Hdr& h, const char* n){
+  return strlen(n) <= NAME_LEN && !strncasecmp(h.name, n, NAME_LEN);
+}
+
+// Adresse des Skripts name, 0 = nicht vorhanden
+inline uint16_t find(const char* n, Hdr& h){
+  for (uint16_t a = BASE; read_hdr(a, h); a = next(a, h))
+    if (name_is(h, n)) return a;
+  return 0;
+}
+
+inline uint8_t calc_crc(uint16_t a, const Hdr& h){
+  Hdr t = h; t.crc = 0;
+  const uint8_t* p = (const uint8_t*)&t;
+  uint8_t x = 0;
+  for (uint8_t i=0; i<sizeof(Hdr); i++) x ^= p[i];
+  for (uint16_t i=body(a); i<next(a, h); i++) x ^= EEPROM.read(i);
+  return x;
+}
+inline bool valid(uint16_t a, const Hdr& h){ return calc_crc(a, h) == h.crc; }
+
+// Schritt an p lesen (p rückt weiter); false = kaputt
+inline bool read_step(uint16_t& p, uint16_t lim, uint8_t& ctrl, uint8_t* buf, uint8_t& len){
+  if (p + 2 > lim) return false;
+  ctrl = EEPROM.read(p++);
+  len  = EEPROM.read(p++);
+  if (len > STEP_MAX || p + len > lim) return false;
+  for (uint8_t i=0; i<len; i++) buf[i] = EEPROM.read(p++);
+  return true;
+}
+
+// Header schreiben (crc wird berechnet); MAGIC zuletzt, damit ein Abbruch die Kette nicht verlängert
+inline void write_hdr(uint16_t a, Hdr h){
+  h.magic = MAGIC;
+  h.crc   = calc_crc(a, h);
+  h.magic = 0xFF;
+  EEPROM.put(a, h);
+  EEPROM.update(a, MAGIC);
+}
+
+// Skript an a entfernen: Rest der Kette nachrücken, neues Ende markieren
+inline void remove(uint16_t a){
+  Hdr h; if (!read_hdr(a, h)) return;
+  uint16_t src = next(a, h), end = end_addr();
+  while (src < end) EEPROM.update(a++, EEPROM.read(src++));
+  if (a < END) EEPROM.update(a, 0xFF);
+}
+
+} // namespace jbc_script
@@ -0,0 +1,549 @@
+#!/usr/bin/env python3
+# SPDX-License-Identifier: MIT OR GPL-2.0-only
+#
+# Erzeugt aus tools/jbc_commands.spec:
+#   jbc_commands_full.h  -> jbc_cmd::<FAMILIE>::M_* (Ctrl-IDs)
+#   jbc_cmd_tables.h     -> ArgFmt + Argumentprogramme (CLI -> Payload), je Familie Namens-Blob und
+#                           Kommando-Tabelle (nach ctrl, für Binärsuche), dazu je Backend
+#                           eine perfekte Hash-Tabelle CLI-Name -> Kommando (PROGMEM)
+#   jbc_ctrl_meta.h      -> pro Backend 256 Byte Ctrl-Flags (PROGMEM)
+# und aus tools/jbc_bin_schema.spec:
+#   jbc_bin_schema.h     -> Datensatz-/Feld-IDs der Binär-Telemetrie (R_*, K_*) + Namen für OUT SCHEMA
+#
+# Aufruf (im Sketch-Ordner):  python3 tools/gen_jbc_tables.py
+
+import os
+import re
+import sys
+
+ROOT = os.path.dirname(os.path.dirname(os.path.abspath(__file__)))
+SPEC = os.path.join(ROOT, "tools", "jbc_commands.spec")
+SCHEMA = os.path.join(ROOT, "tools", "jbc_bin_schema.spec")
+
+# Reihenfolge == enum Backend (jbc_cmd_names.h)
+BACKENDS = [
+    ("BK_UNKNOWN", "BASE"),
+    ("BK_SOLD",    "SOLD_02"),
+    ("BK_HA",      "HA_02"),
+    ("BK_FE",      "FE_02"),
+    ("BK_PH",      "PH_02"),
+    ("BK_SF",      "SF_02"),
+    ("BK_SOLD1",   "SOLD_01"),
+]
+
+FLAGS = [
+    ("CM_READ",       0x01, "M_R_* / M_INF_PORT"),
+    ("CM_WRITE",      0x02, "M_W_* / M_I_*"),
+    ("CM_SYN",        0x04, "M_SYN"),
+    ("CM_ACK",        0x08, "M_ACK"),
+    ("CM_NACK",       0x10, "M_NACK"),
+    ("CM_PORT",       0x20, "Payload trägt Port"),
+    ("CM_EXPECT_ACK", 0x40, "Write, Antwort 0x06.. = ACK"),
+    ("CM_USB_STATUS", 0x80, "M_R_/M_W_USB_CONNECTSTATUS"),
+]
+F = {name: bit for name, bit, _ in FLAGS}
+
+# Byte "arg" in CmdEntry: Bit0-5 ArgFmt (NO_CLI = nicht über die Konsole), Bit6-7 Antwort
+NO_CLI = 0x3F
+REPLIES = {"-": 0x00, "ACK": 0x40, "DATA": 0x80}
+
+# BK_UNKNOWN: CLI sucht best effort in dieser Reihenfolge (erste Familie gewinnt)
+CLI_ANY_ORDER = ["SOLD_02", "SOLD_01", "HA_02", "PH_02", "FE_02", "SF_02"]
+
+# Feldtypen der Argumentprogramme; Reihenfolge == OP_* in jbc_cmd_tables.h (0 = OP_END)
+OPS = ["u8", "bool", "u16", "temp", "dtemp", "port", "tool", "ip", "str", "raw"]
+OP_BYTES = {"u8": 1, "bool": 1, "u16": 2, "temp": 2, "dtemp": 2, "port": 1, "tool": 1, "ip": 4}
+MAX_ARG = 11        # tok[12] in jbc_cli::handle, tok[0] = Name
+PAYLOAD_MAX = 48    # payload[] in jbc_cli::handle
+
+OUT = "// AUTO-GENERATED by tools/gen_jbc_tables.py aus tools/jbc_commands.spec – nicht von Hand editieren."
+
+
+class Fmt:
+    def __init__(self, name, prog, usage):
+        self.name, self.usage = name, usage
+        self.ops, self.nreq, size = [], 0, 0
+        for t in ([] if prog == ["-"] else prog):
+            m = re.fullmatch(r"([a-z0-9]+)(?::(\d+))?(\?)?", t)
+            if not m or m.group(1) not in OPS:
+                raise ValueError("Feld %s ungültig" % t)
+            typ, arg, opt = m.group(1), int(m.group(2) or 0), bool(m.group(3))
+            if (typ == "str") != (arg == 0) or arg > MAX_ARG:
+                raise ValueError("Feld %s: Argument fehlt oder ungültig" % t)
+            if typ in ("str", "raw") and opt:
+                raise ValueError("Feld %s: str/raw nicht optional" % t)
+            if not opt:
+                self.nreq = max(self.nreq, arg or 1)
+            size += OP_BYTES.get(typ, 0)
+            self.ops.append((typ, arg, opt))
+        for typ, arg, opt in self.ops:
+            if opt and arg <= self.nreq:
+                raise ValueError("optionales Argument %d vor Pflichtargument" % arg)
+        if size > PAYLOAD_MAX:
+            raise ValueError("Payload > %d Byte" % PAYLOAD_MAX)
+
+    def has_port(self):
+        return any(typ == "port" for typ, _, _ in self.ops)
+
+    def code(self):
+        return [self.nreq] + [((OPS.index(typ) + 1) << 4) | arg for typ, arg, _ in self.ops] + [0]
+
+    def text(self):
+        return " ".join("%s%s%s" % (typ, ":%d" % arg if arg else "", "?" if opt else "")
+                        for typ, arg, opt in self.ops) or "-"
+
+
+class Cmd:
+    def __init__(self, name, ctrl, fmt, reply, note):
+        self.name, self.ctrl, self.fmt, self.reply, self.note = name, ctrl, fmt, reply, note
+
+
+def parse_spec(path):
+    fmts, fams, order = [], {}, []
+    sect = None
+    for no, raw in enumerate(open(path, encoding="utf-8"), 1):
+        line, _, note = raw.partition("#")
+        line, note = line.strip(), note.strip()
+        if not line:
+            continue
+        m = re.fullmatch(r"\[(\w+)\]", line)
+        if m:
+            sect = m.group(1)
+            if sect != "FORMATS":
+                if sect in fams:
+                    sys.exit("%s:%d: Familie %s doppelt" % (path, no, sect))
+                fams[sect] = []
+                order.append(sect)
+            continue
+        if sect == "FORMATS":
+            cols = line.split()
+            try:
+                fmts.append(Fmt(cols[0], cols[1:], note))
+            except (ValueError, IndexError) as e:
+                sys.exit("%s:%d: %s" % (path, no, e))
+            continue
+        cols = line.split()
+        if sect is None or len(cols) != 4:
+            sys.exit("%s:%d: erwartet NAME CTRL CLI REPLY" % (path, no))
+        name, ctrl, fmt, reply = cols
+        fams[sect].append(Cmd(name, int(ctrl), fmt, reply, note))
+
+    known = {f.name: f for f in fmts}
+    if len(fmts) >= NO_CLI:
+        sys.exit("zu viele Formate")
+    for fam, cmds in fams.items():
+        seen_n, seen_c = set(), set()
+        for c in cmds:
+            if c.name in seen_n or c.ctrl in seen_c or not 0 <= c.ctrl <= 255:
+                sys.exit("%s::%s: Name/Ctrl doppelt oder ungültig" % (fam, c.name))
+            if c.fmt != "-" and c.fmt not in known:
+                sys.exit("%s::%s: Format %s unbekannt" % (fam, c.name, c.fmt))
+            if c.reply not in REPLIES:
+                sys.exit("%s::%s: REPLY %s unbekannt" % (fam, c.name, c.reply))
+            seen_n.add(c.name)
+            seen_c.add(c.ctrl)
+        cmds.sort(key=lambda c: c.ctrl)
+    for _, ns in BACKENDS:
+        if ns not in fams:
+            sys.exit("Familie %s fehlt" % ns)
+    for c in (c for cmds in fams.values() for c in cmds):
+        c.port = c.fmt != "-" and known[c.fmt].has_port()
+    return fmts, fams, order
+
+
+def write(name, lines):
+    with open(os.path.join(ROOT, name), "w", encoding="utf-8", newline="\n") as fh:
+        fh.write("\n".join(lines))
+
+
+def gen_commands(fams, order):
+    o = []
+    o.append("// SPDX-License-Identifier: MIT OR GPL-2.0-only")
+    o.append(OUT)
+    o.append("")
+    o.append("#pragma once")
+    o.append("")
+    o.append("#include <stdint.h>")
+    o.append("")
+    o.append("// Namespaces:")
+    o.append("//   jbc_cmd::BASE")
+    o.append("//   jbc_cmd::SOLD_01, SOLD_02")
+    o.append("//   jbc_cmd::HA_02, FE_02, PH_02, SF_02")
+    o.append("")
+    o.append("namespace jbc_cmd {")
+    o.append("")
+    for ns in order:
+        o.append("namespace %s {" % ns)
+        for c in fams[ns]:
+            o.append("static const uint8_t %s = %d;" % (c.name, c.ctrl))
+        o.append("} // namespace %s" % ns)
+        o.append("")
+    o.append("} // namespace jbc_cmd")
+    o.append("")
+    write("jbc_commands_full.h", o)
+
+
+def cli_hash(name, seed):
+    # == jbc_cli::cli_hash()
+    h = seed & 0xFFFF
+    for ch in name.encode("ascii"):
+        h = ((h ^ ch) * 0x0193) & 0xFFFF
+    return h ^ (h >> 7)
+
+
+def build_phash(keys):
+    """Hash & Displace: Bucket = hash(seed) % nb, Slot = hash(disp[Bucket]) % m.
+    keys: [(name, ref)] -> (seed, disp[], slots[])"""
+    n = len(keys)
+    for m in range(n + (n + 7) // 8, 256):
+        nb = max(1, (n + 2) // 3)
+        for seed in range(0x100, 0x10000, 0x101):
+            buckets = [[] for _ in range(nb)]
+            for k in keys:
+                buckets[cli_hash(k[0], seed) % nb].append(k)
+            slots, disp, ok = [None] * m, [0] * nb, True
+            for b in sorted(range(nb), key=lambda b: -len(buckets[b])):
+                if not buckets[b]:
+                    continue
+                for d in range(256):
+                    pos = [cli_hash(k[0], d) % m for k in buckets[b]]
+                    if len(set(pos)) == len(pos) and all(slots[q] is None for q in pos):
+                        for q, k in zip(pos, buckets[b]):
+                            slots[q] = k[1]
+                        disp[b] = d
+                        break
+                else:
+                    ok = False
+                    break
+            if ok:
+                return seed, disp, [0xFFFF if v is None else v for v in slots]
+    sys.exit("kein perfekter Hash gefunden")
+
+
+def gen_tables(fmts, fams):
+    fidx = {f.name: i for i, f in enumerate(fmts)}
+    o = []
+    o.append("// SPDX-License-Identifier: MIT OR GPL-2.0-only")
+    o.append(OUT)
+    o.append("")
+    o.append("#pragma once")
+    o.append("#include <Arduino.h>")
+    o.append("")
+    o.append("namespace jbc_cli {")
+    o.append("")
+    o.append("// -------- Argument-Formate --------")
+    o.append("enum ArgFmt : uint8_t {")
+    w = max(len(f.name) for f in fmts) + 8
+    for i, f in enumerate(fmts):
+        decl = ("FMT_%s = 0," % f.name) if i == 0 else ("FMT_%s," % f.name)
+        wire = "CLI: %-26s → %s" % (f.usage, f.text()) if f.usage else "keine Payload"
+        o.append("  %-*s// %s" % (w, decl, wire))
+    o.append("  FMT_COUNT")
+    o.append("};")
+    o.append("")
+    o.append("} // namespace jbc_cli")
+    o.append("")
+    o.append("namespace jbc_tbl {")
+    o.append("")
+    o.append("// arg-Byte: Bit0-5 ArgFmt, Bit6-7 erwartete Antwort")
+    o.append("static const uint8_t NO_CLI   = 0x%02X;   // nicht über die Konsole erreichbar" % NO_CLI)
+    o.append("static const uint8_t FMT_MASK = 0x3F;")
+    o.append("enum : uint8_t { RP_NONE = 0x00, RP_ACK = 0x40, RP_DATA = 0x80, RP_MASK = 0xC0 };")
+    o.append("")
+    o.append("// Ein Eintrag je Kommando; name = Offset im Namens-Blob")
+    o.append("struct CmdEntry {")
+    o.append("  uint8_t  ctrl;")
+    o.append("  uint8_t  arg;")
+    o.append("  uint16_t name;")
+    o.append("};")
+    o.append("")
+    gen_fmt_progs(o, fmts)
+    o.append("")
+    o.append("struct Family {")
+    o.append("  const char*     prefix;   // \"SOLD_02\" (einmal je Familie)")
+    o.append("  const char*     names;    // \"M_HS\\0M_ACK\\0...\"")
+    o.append("  const CmdEntry* cmds;     // nach ctrl sortiert")
+    o.append("  uint8_t         count;")
+    o.append("};")
+    for _, ns in BACKENDS:
+        cmds = fams[ns]
+        o.append("")
+        o.append("// ---- %s (%d) ----" % (ns, len(cmds)))
+        o.append("static const char FAM_%s[] PROGMEM = \"%s\";" % (ns, ns))
+        o.append("static const char NAMES_%s[] PROGMEM =" % ns)
+        off, offs = 0, []
+        for i, c in enumerate(cmds):
+            offs.append(off)
+            off += len(c.name) + 1
+            o.append("  \"%s\\0\"%s" % (c.name, ";" if i == len(cmds) - 1 else ""))
+        if off > 0xFFFF:
+            sys.exit("%s: Namens-Blob zu groß" % ns)
+        o.append("static const CmdEntry CMDS_%s[] PROGMEM = {" % ns)
+        for c, nofs in zip(cmds, offs):
+            arg = (NO_CLI if c.fmt == "-" else fidx[c.fmt]) | REPLIES[c.reply]
+            o.append("  { %3d, 0x%02X, %4d },  // %-24s %s %s" % (c.ctrl, arg, nofs, c.name, c.fmt, c.reply))
+        o.append("};")
+    o.append("")
+    o.append("// [Backend] – BK_UNKNOWN nutzt BASE")
+    o.append("static const uint8_t FAMILY_COUNT = %d;" % len(BACKENDS))
+    o.append("static const Family FAMILIES[FAMILY_COUNT] PROGMEM = {")
+    for bk, ns in BACKENDS:
+        o.append("  { FAM_%s, NAMES_%s, CMDS_%s, %d },  // %s" % (ns, ns, ns, len(fams[ns]), bk))
+    o.append("};")
+    gen_cli_hash(o, fams)
+    o.append("")
+    o.append("} // namespace jbc_tbl")
+    o.append("")
+    write("jbc_cmd_tables.h", o)
+
+
+def gen_fmt_progs(o, fmts):
+    o.append("// ---- CLI-Argumentprogramme (je ArgFmt, Quelle [FORMATS]) ----")
+    o.append("// Programm: <min. Argumente> <op>... OP_END; op = (Typ << 4) | CLI-Argument (1..%d)" % MAX_ARG)
+    o.append("enum : uint8_t {")
+    o.append("  OP_END = 0,")
+    for typ in OPS:
+        o.append("  OP_%s," % typ.upper())
+    o.append("};")
+    o.append("static const uint8_t OP_ARG_MASK = 0x0F;")
+    o.append("")
+    o.append("static const uint8_t FMT_PROG[] PROGMEM = {")
+    pofs, pos = [], 0
+    for f in fmts:
+        code = f.code()
+        pofs.append(pos)
+        pos += len(code)
+        o.append("  %s  // %s" % (" ".join("0x%02X," % b for b in code), f.name))
+    o.append("};")
+    if pos > 0xFF:
+        sys.exit("Argumentprogramme zu groß")
+    o.append("")
+    o.append("// Text für \"[CLI] Erwartet: ...\"")
+    o.append("static const char FMT_USAGE[] PROGMEM =")
+    uofs, pos = [], 0
+    for i, f in enumerate(fmts):
+        uofs.append(pos)
+        pos += len(f.usage.encode("utf-8")) + 1
+        o.append("  \"%s\\0\"%s" % (f.usage, ";" if i == len(fmts) - 1 else ""))
+    o.append("")
+    o.append("struct FmtInfo {")
+    o.append("  uint8_t  prog;    // Offset in FMT_PROG")
+    o.append("  uint16_t usage;   // Offset in FMT_USAGE")
+    o.append("};")
+    o.append("static const FmtInfo FMT_INFO[jbc_cli::FMT_COUNT] PROGMEM = {")
+    for f, p, u in zip(fmts, pofs, uofs):
+        o.append("  { %3d, %4d },  // %s" % (p, u, f.name))
+    o.append("};")
+
+
+def gen_cli_hash(o, fams):
+    fam_no = {ns: i for i, (_, ns) in enumerate(BACKENDS)}
+
+    def cli_keys(ns):
+        return [(c.name, (fam_no[ns] << 8) | i) for i, c in enumerate(fams[ns]) if c.fmt != "-"]
+
+    any_keys, seen = [], set()
+    for ns in CLI_ANY_ORDER:
+        for k in cli_keys(ns):
+            if k[0] not in seen:
+                seen.add(k[0])
+                any_keys.append(k)
+
+    o.append("")
+    o.append("// ---- CLI: perfekter Hash Name -> Kommando ----")
+    o.append("// Bucket = cli_hash(name, seed) % nb, Slot = cli_hash(name, disp[Bucket]) % m;")
+    o.append("// Slot = (Familie << 8) | Index in cmds, 0xFFFF = leer. Danach genau ein strcmp_P.")
+    o.append("struct CliHash {")
+    o.append("  const uint8_t*  disp;")
+    o.append("  const uint16_t* slots;")
+    o.append("  uint16_t        seed;")
+    o.append("  uint8_t         nb;")
+    o.append("  uint8_t         m;")
+    o.append("};")
+    rows = []
+    for bk, ns in BACKENDS:
+        tag = "ANY" if bk == "BK_UNKNOWN" else ns
+        keys = any_keys if bk == "BK_UNKNOWN" else cli_keys(ns)
+        seed, disp, slots = build_phash(keys)
+        o.append("")
+        o.append("// %s: %d Namen%s" % (tag, len(keys), " (Vereinigung, Reihenfolge %s)" % " > ".join(CLI_ANY_ORDER) if tag == "ANY" else ""))
+        o.append("static const uint8_t CLI_DISP_%s[] PROGMEM = {" % tag)
+        for base in range(0, len(disp), 16):
+            o.append("  %s," % ",".join("%3d" % v for v in disp[base:base + 16]))
+        o.append("};")
+        o.append("static const uint16_t CLI_SLOT_%s[] PROGMEM = {" % tag)
+        for base in range(0, len(slots), 12):
+            o.append("  %s," % ",".join("0x%04X" % v for v in slots[base:base + 12]))
+        o.append("};")
+        rows.append("  { CLI_DISP_%s, CLI_SLOT_%s, 0x%04X, %d, %d },  // %s" % (tag, tag, seed, len(disp), len(slots), bk))
+    o.append("")
+    o.append("// [Backend] – BK_UNKNOWN: Vereinigung aller Familien")
+    o.append("static const CliHash CLI_HASH[FAMILY_COUNT] PROGMEM = {")
+    o.extend(rows)
+    o.append("};")
+
+
+def flags_for(c):
+    name, f = c.name, 0
+    if name.startswith("M_R_") or name == "M_INF_PORT":
+        f |= F["CM_READ"]
+    if name.startswith("M_W_") or name.startswith("M_I_"):
+        f |= F["CM_WRITE"]
+    if name == "M_SYN":
+        f |= F["CM_SYN"]
+    if name == "M_ACK":
+        f |= F["CM_ACK"]
+    if name == "M_NACK":
+        f |= F["CM_NACK"]
+    if c.port:
+        f |= F["CM_PORT"]
+    if c.reply == "ACK":
+        f |= F["CM_EXPECT_ACK"]
+    if name in ("M_R_USB_CONNECTSTATUS", "M_W_USB_CONNECTSTATUS"):
+        f |= F["CM_USB_STATUS"]
+    return f
+
+
+def gen_meta(fams):
+    o = []
+    o.append("// SPDX-License-Identifier: MIT OR GPL-2.0-only")
+    o.append(OUT)
+    o.append("")
+    o.append("#pragma once")
+    o.append("#include <Arduino.h>")
+    o.append('#include "jbc_cmd_names.h"   // Backend')
+    o.append("")
+    o.append("namespace jbc_meta {")
+    o.append("")
+    o.append("// Ctrl-Flags (1 Byte je Ctrl und Backend)")
+    o.append("enum : uint8_t {")
+    for name, bit, doc in FLAGS:
+        o.append("  %-14s= 0x%02X,   // %s" % (name, bit, doc))
+    o.append("};")
+    o.append("")
+    o.append("// [Backend][ctrl] – Zeilen à 16 Ctrls")
+    o.append("static const uint8_t CTRL_META[%d][256] PROGMEM = {" % len(BACKENDS))
+    for bk, ns in BACKENDS:
+        row = [0] * 256
+        for c in fams[ns]:
+            row[c.ctrl] |= flags_for(c)
+        o.append("  { // %s (%s)" % (bk, ns))
+        for base in range(0, 256, 16):
+            cells = ",".join("0x%02X" % v for v in row[base:base + 16])
+            o.append("    %s,  // %3d" % (cells, base))
+        o.append("  },")
+    o.append("};")
+    o.append("")
+    o.append("static inline uint8_t ctrl_meta(Backend be, uint8_t ctrl){")
+    o.append("  if ((uint8_t)be >= %d) be = BK_UNKNOWN;" % len(BACKENDS))
+    o.append("  return pgm_read_byte(&CTRL_META[(uint8_t)be][ctrl]);")
+    o.append("}")
+    o.append("static inline bool ctrl_is(Backend be, uint8_t ctrl, uint8_t flag){")
+    o.append("  return (ctrl_meta(be, ctrl) & flag) != 0;")
+    o.append("}")
+    o.append("")
+    o.append("} // namespace jbc_meta")
+    o.append("")
+    write("jbc_ctrl_meta.h", o)
+
+
+def parse_schema(path):
+    sects, sect = {"REC": [], "FIELD": []}, None
+    for no, raw in enumerate(open(path, encoding="utf-8"), 1):
+        line = raw.partition("#")[0].strip()
+        if not line:
+            continue
+        m = re.fullmatch(r"\[(\w+)\]", line)
+        if m:
+            sect = m.group(1)
+            if sect not in sects:
+                sys.exit("%s:%d: Abschnitt %s unbekannt" % (path, no, sect))
+            continue
+        if sect is None or not re.fullmatch(r"[\x21-\x7E]+", line):
+            sys.exit("%s:%d: erwartet ein Name je Zeile" % (path, no))
+        sects[sect].append(line)
+    for sect, names in sects.items():
+        idents = [schema_ident(n) for n in names]
+        if len(set(idents)) != len(idents):
+            sys.exit("%s: [%s] Name doppelt" % (path, sect))
+        if len(names) > 255:
+            sys.exit("%s: [%s] mehr als 255 Einträge" % (path, sect))
+    return sects
+
+
+def schema_ident(name):
+    return re.sub(r"\W", "_", name)
+
+
+def schema_blob(names):
+    rows, row = [], ""
+    for n in names:
+        cell = '"%s\\0" ' % n
+        if row and len(row) + len(cell) > 96:
+            rows.append(row.rstrip())
+            row = ""
+        row += cell
+    rows.append(row.rstrip())
+    return ["  " + r for r in rows]
+
+
+# Append-only: bestehende IDs aus dem vorhandenen Header dürfen sich nicht ändern
+def check_schema_append_only(sects):
+    path = os.path.join(ROOT, "jbc_bin_schema.h")
+    if not os.path.exists(path):
+        return
+    text = open(path, encoding="utf-8").read()
+    for sect, prefix in (("REC", "R_"), ("FIELD", "K_")):
+        old = re.findall(r"^  %s(\w+) += (\d+),$" % prefix, text, re.M)
+        new = {schema_ident(n): i for i, n in enumerate(sects[sect], 1)}
+        for ident, id_ in old:
+            if new.get(ident) != int(id_):
+                sys.exit("jbc_bin_schema.h: %s%s hatte ID %s – im Schema nur hinten anhängen"
+                         % (prefix, ident, id_))
+
+
+def gen_schema(sects):
+    check_schema_append_only(sects)
+    o = []
+    o.append("// SPDX-License-Identifier: MIT OR GPL-2.0-only")
+    o.append(OUT.replace("jbc_commands.spec", "jbc_bin_schema.spec"))
+    o.append("")
+    o.append("#pragma once")
+    o.append("#include <Arduino.h>")
+    o.append("")
+    o.append("namespace jbc_bin {")
+    o.append("")
+    for sect, prefix, doc in (("REC", "R_", "Datensätze (rec-ID)"),
+                              ("FIELD", "K_", "Felder (key = ID << 3 | Typ)")):
+        names = sects[sect]
+        w = max(len(schema_ident(n)) for n in names) + len(prefix)
+        o.append("// %s, 0 = nicht im Schema" % doc)
+        o.append("enum : uint8_t {")
+        for i, n in enumerate(names, 1):
+            o.append("  %-*s = %d," % (w, prefix + schema_ident(n), i))
+        o.append("};")
+        o.append("static const uint8_t %s_COUNT = %d;" % (sect, len(names)))
+        o.append("")
+    o.append("// Namen in ID-Reihenfolge, nur für OUT SCHEMA (Text/JSON nehmen den Namen der Aufrufstelle)")
+    o.append("static const char REC_NAMES[] PROGMEM =")
+    o.extend(schema_blob(sects["REC"]))
+    o[-1] += ";"
+    o.append("static const char FIELD_NAMES[] PROGMEM =")
+    o.extend(schema_blob(sects["FIELD"]))
+    o[-1] += ";"
+    o.append("")
+    o.append("} // namespace jbc_bin")
+    o.append("")
+    write("jbc_bin_schema.h", o)
+
+
+def main():
+    fmts, fams, order = parse_spec(SPEC)
+    gen_commands(fams, order)
+    gen_tables(fmts, fams)
+    gen_meta(fams)
+    gen_schema(parse_schema(SCHEMA))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,68 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+//
+// Host-Messung der Konsolen-Ausgabe (DualSerial) mit einem 4-Port-SOLD-Conti-Burst.
+// Der Sketch wird mit den Attrappen aus mock/ für den Host übersetzt (siehe run.sh) und
+// bekommt N gleiche Frames (Parser + Decoder + Konsole): Zeilen je Frame, HW-write()-Aufrufe
+// je Zeile und Host-Zeit je Frame.
+// Die Zeiten sind Host-Zeiten (x86) und nur zum Vergleich zweier Stände gedacht;
+// auf dem AVR misst "PERF" (us/frame, us/line).
+#include "Arduino.h"
+#include "EEPROM.h"
+#include <chrono>
+HardwareSerial Serial("USB"), Serial1("S1");
+EEPROMClass EEPROM;
+static uint32_t g_ms = 0;
+uint32_t millis(){ return g_ms; }
+uint32_t micros(){ return g_ms * 1000; }
+void delay(uint32_t d){ g_ms += d; }
+void pinMode(int, int){}
+void digitalWrite(int, int){}
+#include "sketch.cpp"
+#undef Serial
+
+// JBC-Frame (P02) wie vom CP210x empfangen: DLE-gestopft, mit BCC
+static void sim_frame(uint8_t src, uint8_t fid, uint8_t ctrl, const std::string& data){
+  std::string in;
+  in += (char)0x02; in += (char)(src | 0x80); in += (char)0x1D; in += (char)fid; in += (char)ctrl;
+  in += (char)data.size(); in += data;
+  uint8_t x = 0; for (char c : in) x ^= (uint8_t)c; x ^= 0x03;
+  in += (char)x; in += (char)0x03;
+  std::string out; out += (char)0x10; out += (char)0x02;
+  for (size_t i=1; i+1<in.size(); i++){ if ((uint8_t)in[i] == 0x10) out += (char)0x10; out += in[i]; }
+  out += (char)0x10; out += (char)0x03;
+  CP.rx += out;
+}
+static void run(int ms){ for (int i=0; i<ms; i+=5){ loop(); g_ms += 5; } }
+
+// Link-Up mit einer DDE (SOLD, P02)
+static void station_up_sold(){
+  setup(); run(900);
+  sim_frame(0x10, 253, 0, std::string(1, '\x00')); run(50);
+  sim_frame(0x10, 1, 33, "02:DDE_CAP26_06:1234567:0123"); run(50);
+}
+static std::string conti_sold(uint8_t seq, uint16_t pwr, uint8_t flags, uint8_t changes, int ports){
+  std::string d(1, (char)seq);
+  for (int p=0; p<ports; p++){
+    uint8_t b[10] = { 0x10, 0x0D, 0, 0, (uint8_t)pwr, (uint8_t)(pwr >> 8), 0, 0, flags, changes };
+    d.append((char*)b, 10);
+  }
+  return d;
+}
+
+int main(){
+  station_up_sold(); run(100);
+  Serial.out.clear(); Serial1.out.clear();
+  Serial.cap = Serial1.cap = 100000;   // HW nimmt alles: gemessen wird nur die Software
+  const std::string f = conti_sold(1, 100, 0, 0x01, 4);
+
+  const int N = 2000;
+  Serial.nwr = Serial1.nwr = 0;
+  auto t0 = std::chrono::steady_clock::now();
+  for (int i=0; i<N; i++){ sim_frame(0x10, 250, 0x10, f); loop(); }
+  auto t1 = std::chrono::steady_clock::now();
+  size_t lines = 0; for (char c : Serial.out) lines += (c == '\n');
+  printf("lines/frame=%.1f hw_writes/line USB=%.2f S1=%.2f host_ns/frame=%.0f\n",
+         lines / (double)N, Serial.nwr / (double)lines, Serial1.nwr / (double)lines,
+         std::chrono::duration<double, std::nano>(t1 - t0).count() / N);
+  return 0;
+}
@@ -0,0 +1,7 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+// Host-Attrappe (tools/host_sim), nur so viel wie der Sketch braucht
+#pragma once
+#include <stdint.h>
+#define NEO_GRBW 0
+#define NEO_KHZ800 0
+struct Adafruit_NeoPixel { Adafruit_NeoPixel(int,int,int){} void begin(){} void show(){} void setPixelColor(int,uint32_t){} static uint32_t Color(uint8_t r,uint8_t g,uint8_t b,uint8_t w=0){ return r|(g<<8)|(b<<16)|((uint32_t)w<<24);} };
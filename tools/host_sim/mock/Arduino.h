@@ -0,0 +1,130 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+// Host-Attrappe der Arduino-API (tools/host_sim): Print/Stream/HardwareSerial schreiben in std::string,
+// PROGMEM/F() sind normaler Speicher. HardwareSerial::cap = freie Bytes im HW-Puffer, nwr = write()-Aufrufe.
+#pragma once
+#include <vector>
+#include <stdint.h>
+#include <stddef.h>
+#include <string.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <ctype.h>
+#include <string>
+#include <algorithm>
+#define __AVR_ATmega2560__ 1
+#define F_CPU 16000000UL
+#define HIGH 1
+#define LOW 0
+#define OUTPUT 1
+#define INPUT 0
+#define INPUT_PULLUP 2
+#define HEX 16
+#define DEC 10
+#define PROGMEM
+#define PGM_P const char*
+#define PSTR(s) (s)
+#define pgm_read_byte(p) (*(const uint8_t*)(p))
+#define pgm_read_word(p) (*(const uint16_t*)(p))
+#define pgm_read_dword(p) (*(const uint32_t*)(p))
+#define pgm_read_ptr(p) (*(void* const*)(p))
+#define strcmp_P strcmp
+#define strncmp_P strncmp
+#define strcasecmp_P strcasecmp
+static inline char* utoa(unsigned v, char* s, int){ sprintf(s, "%u", v); return s; }
+#if !defined(__GLIBC__) || __GLIBC__ < 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ < 38)
+static inline size_t strlcpy(char* d, const char* s, size_t n){   // avr-libc hat es, ältere glibc nicht
+  size_t l = strlen(s);
+  if (n) { size_t k = l < n ? l : n - 1; memcpy(d, s, k); d[k] = '\0'; }
+  return l;
+}
+#endif
+#define strncasecmp_P strncasecmp
+#define strlen_P strlen
+#define memcpy_P memcpy
+#define strcpy_P strcpy
+#include <strings.h>
+class __FlashStringHelper;
+#define F(s) (reinterpret_cast<const __FlashStringHelper*>(s))
+#define FPSTR(p) (reinterpret_cast<const __FlashStringHelper*>(p))
+uint32_t millis(); uint32_t micros(); void delay(uint32_t);
+void pinMode(int,int); void digitalWrite(int,int);
+struct String {
+  std::string s;
+  String(){} String(const char* c){ if(c) s=c; } String(const std::string& x):s(x){}
+  String(const __FlashStringHelper* f){ s=(const char*)f; }
+  String(char c){ s=std::string(1,c);} 
+  String(int v, int base=10){ char b[40]; if(base==16) snprintf(b,40,"%x",v); else snprintf(b,40,"%d",v); s=b; }
+  String(unsigned v, int base=10){ char b[40]; if(base==16) snprintf(b,40,"%x",v); else snprintf(b,40,"%u",v); s=b; }
+  String(long v, int base=10){ char b[40]; if(base==16) snprintf(b,40,"%lx",v); else snprintf(b,40,"%ld",v); s=b; }
+  String(unsigned long v, int base=10){ char b[40]; if(base==16) snprintf(b,40,"%lx",v); else snprintf(b,40,"%lu",v); s=b; }
+  String(unsigned char v, int base=10):String((unsigned)v,base){}
+  size_t length() const { return s.size(); }
+  void reserve(size_t n){ s.reserve(n); }
+  char operator[](size_t i) const { return i<s.size()?s[i]:0; }
+  char& operator[](size_t i){ return s[i]; }
+  int indexOf(char c, int from=0) const { auto p=s.find(c,from); return p==std::string::npos?-1:(int)p; }
+  int indexOf(const char* c, int from=0) const { auto p=s.find(c,from); return p==std::string::npos?-1:(int)p; }
+  int indexOf(const String& c, int from=0) const { auto p=s.find(c.s,from); return p==std::string::npos?-1:(int)p; }
+  String substring(int a) const { return a>=(int)s.size()?String():String(s.substr(a)); }
+  String substring(int a,int b) const { if(a>b) std::swap(a,b); if(a>=(int)s.size()) return String(); return String(s.substr(a,b-a)); }
+  void trim(){ size_t a=0; while(a<s.size()&&isspace((unsigned char)s[a])) a++; size_t b=s.size(); while(b>a&&isspace((unsigned char)s[b-1])) b--; s=s.substr(a,b-a); }
+  void toUpperCase(){ for(auto&c:s) c=toupper((unsigned char)c); }
+  void replace(const char* a,const char* b){ std::string A=a,B=b; size_t p=0; while((p=s.find(A,p))!=std::string::npos){ s.replace(p,A.size(),B); p+=B.size(); } }
+  bool startsWith(const char* p) const { return s.rfind(p,0)==0; }
+  bool startsWith(const String& p) const { return s.rfind(p.s,0)==0; }
+  bool equals(const __FlashStringHelper* f) const { return s==(const char*)f; }
+  bool equals(const String& o) const { return s==o.s; }
+  bool equalsIgnoreCase(const char* o) const { return strcasecmp(s.c_str(),o)==0; }
+  void remove(size_t i){ s.erase(i); } void remove(size_t i,size_t n){ s.erase(i,n); }
+  long toInt() const { return atol(s.c_str()); }
+  const char* c_str() const { return s.c_str(); }
+  String& operator+=(char c){ s+=c; return *this; }
+  String& operator+=(const char* c){ s+=c; return *this; }
+  String& operator+=(const String& c){ s+=c.s; return *this; }
+  bool operator==(const char* c) const { return s==c; }
+  bool operator==(const String& c) const { return s==c.s; }
+  bool operator!=(const char* c) const { return s!=c; }
+  friend String operator+(const String& a, const String& b){ return String(a.s+b.s); }
+  friend String operator+(const String& a, const char* b){ return String(a.s+b); }
+};
+struct Print {
+  virtual size_t write(uint8_t)=0;
+  virtual size_t write(const uint8_t* b, size_t n){ for(size_t i=0;i<n;i++) write(b[i]); return n; }
+  size_t write(const char* s){ return write((const uint8_t*)s, strlen(s)); }
+  size_t write(const char* s, size_t n){ return write((const uint8_t*)s, n); }
+  virtual int availableForWrite(){ return 0; }
+  size_t print(const char* s){ return write(s); }
+  size_t print(const __FlashStringHelper* s){ return write((const char*)s); }
+  size_t print(const String& s){ return write(s.c_str()); }
+  size_t print(char c){ return write((uint8_t)c); }
+  size_t pnum(unsigned long v, int base){ char b[40]; if(base==16) snprintf(b,40,"%lX",v); else snprintf(b,40,"%lu",v); return write(b); }
+  size_t print(unsigned char v, int base=DEC){ return pnum(v,base); }
+  size_t print(int v, int base=DEC){ if(base==DEC){ char b[40]; snprintf(b,40,"%d",v); return write(b);} return pnum((unsigned long)(unsigned)v,base); }
+  size_t print(unsigned v, int base=DEC){ return pnum(v,base); }
+  size_t print(long v, int base=DEC){ if(base==DEC){ char b[40]; snprintf(b,40,"%ld",v); return write(b);} return pnum((unsigned long)v,base); }
+  size_t print(unsigned long v, int base=DEC){ return pnum(v,base); }
+  size_t print(double v, int d=2){ char b[40]; snprintf(b,40,"%.*f",d,v); return write(b); }
+  size_t println(){ return write("\r\n"); }
+  template<class T> size_t println(T v){ size_t n=print(v); return n+println(); }
+  template<class T> size_t println(T v, int b){ size_t n=print(v,b); return n+println(); }
+  virtual void flush(){}
+};
+struct Stream : Print { virtual int available()=0; virtual int read()=0; virtual int peek()=0; };
+struct HardwareSerial : Stream {
+  std::string out, in; const char* name; size_t cap=63; bool drain=true;
+  HardwareSerial(const char* n):name(n){}
+  void begin(unsigned long){} void end(){}
+  int available() override { return (int)in.size(); }
+  int read() override { if(in.empty()) return -1; int c=(uint8_t)in[0]; in.erase(0,1); return c; }
+  int peek() override { return in.empty()?-1:(uint8_t)in[0]; }
+  size_t nwr=0;
+  size_t write(uint8_t c) override { nwr++; if (finite && cap) cap--; out+=(char)c; return 1; }
+  std::vector<std::string>* rec = nullptr;
+  bool finite=false;
+  size_t write(const uint8_t* b, size_t n) override { nwr++; if (finite) cap = cap > n ? cap - n : 0; if (rec) rec->push_back(std::string((const char*)b, n)); out.append((const char*)b, n); return n; }
+  using Print::write;
+  int availableForWrite() override { return drain ? (int)cap : 0; }
+  operator bool() const { return true; }
+};
+extern HardwareSerial Serial, Serial1;
@@ -0,0 +1,20 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+// Host-Attrappe (tools/host_sim), nur so viel wie der Sketch braucht
+#pragma once
+#include <stdint.h>
+#include <string>
+#include "Usb.h"
+#define CP210X_PARITY_EVEN 2
+#define CP210X_STOP_BITS_1 1
+#define CP210X_FLOW_CONTROL_OFF 0
+class CP210x;
+struct CP210xAsyncOper { virtual uint8_t OnInit(CP210x*){ return 0; } };
+class CP210x { public:
+  std::string rx; std::string tx; uint8_t addr=1;
+  CP210x(USB*, CP210xAsyncOper*){}
+  uint8_t IFCEnable(){return 0;} uint8_t SetBaudRate(uint32_t){return 0;} uint8_t SetDataBits(uint8_t){return 0;}
+  uint8_t SetParity(uint8_t){return 0;} uint8_t SetStopBits(uint8_t){return 0;} uint8_t SetFlowControl(uint8_t){return 0;}
+  uint8_t RcvData(uint16_t* n, uint8_t* p){ uint16_t k = rx.size()<*n? rx.size():*n; memcpy(p,rx.data(),k); rx.erase(0,k); *n=k; return 0; }
+  uint8_t SndData(uint16_t n, uint8_t* p){ tx.append((const char*)p,n); return 0; }
+  uint8_t GetAddress(){ return addr; }
+};
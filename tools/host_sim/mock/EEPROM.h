@@ -0,0 +1,11 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+// Host-Attrappe (tools/host_sim), nur so viel wie der Sketch braucht
+#pragma once
+#include <stdint.h>
+#include <string.h>
+struct EEPROMClass { uint8_t mem[4096]; EEPROMClass(){ memset(mem,0xFF,sizeof mem);} 
+  template<class T> T& get(int a, T& t){ memcpy(&t,mem+a,sizeof(T)); return t; }
+  template<class T> const T& put(int a, const T& t){ memcpy(mem+a,&t,sizeof(T)); return t; }
+  uint8_t read(int a){ return mem[a]; } void write(int a, uint8_t v){ mem[a]=v; } void update(int a, uint8_t v){ mem[a]=v; }
+  uint16_t length(){ return 4096; } };
+extern EEPROMClass EEPROM;
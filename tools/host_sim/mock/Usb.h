@@ -0,0 +1,4 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+// Host-Attrappe (tools/host_sim), nur so viel wie der Sketch braucht
+#pragma once
+struct USB { int Init(){ return 0; } void Task(){} };
@@ -0,0 +1,5 @@
+// SPDX-License-Identifier: MIT OR GPL-2.0-only
+// Host-Attrappe (tools/host_sim), nur so viel wie der Sketch braucht
+#pragma once
+#include "Usb.h"
+struct USBHub { USBHub(USB*){} };
@@ -0,0 +1,22 @@
+#!/bin/sh
+# SPDX-License-Identifier: MIT OR GPL-2.0-only
+#
+# Sketch mit den Attrappen aus mock/ für den Host übersetzen und bench_console ausführen.
+#   tools/host_sim/run.sh          -> Arbeitsbaum
+#   tools/host_sim/run.sh <rev>    -> Stand <rev> (git archive), z. B. zum Vorher/Nachher-Vergleich
+# Braucht g++ (C++11). Ausgabe: siehe Kopf von bench_console.cpp.
+set -e
+HERE=$(cd "$(dirname "$0")" && pwd)
+ROOT=$(cd "$HERE/../.." && pwd)
+OUT=$(mktemp -d)
+trap 'rm -rf "$OUT"' EXIT
+mkdir "$OUT/src"
+if [ -n "$1" ]; then
+  (cd "$ROOT" && git archive "$1" -- '*.h' JBC_Link_Protokoll_1_und_2.ino) | tar -x -C "$OUT/src"
+else
+  cp "$ROOT"/*.h "$ROOT"/JBC_Link_Protokoll_1_und_2.ino "$OUT/src/"
+fi
+rm -f "$OUT/src/CP210x.h"                                   # USB-Host-Treiber -> mock/CP210x.h
+mv "$OUT/src/JBC_Link_Protokoll_1_und_2.ino" "$OUT/src/sketch.cpp"
+g++ -std=gnu++11 -O2 -w -fpermissive -I"$HERE/mock" -I"$OUT/src" "$HERE/bench_console.cpp" -o "$OUT/bench"
+"$OUT/bench"
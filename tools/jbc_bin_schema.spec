@@ -0,0 +1,256 @@
+# SPDX-License-Identifier: MIT OR GPL-2.0-only
+#
+# Schema der Binär-Telemetrie (jbc_bin.h) – einzige Quelle für jbc_bin_schema.h
+# Nach Änderungen:  python3 tools/gen_jbc_tables.py
+#
+# ID = Position im Abschnitt ab 1 (Datensatz: R_<Name>, Feld: K_<Name>; Zeichen außer
+# A-Z a-z 0-9 _ werden im Bezeichner zu '_'). Nur hinten anhängen: Der Generator bricht ab,
+# wenn sich eine ID gegenüber dem vorhandenen jbc_bin_schema.h ändern würde.
+# Bit-Namen (flags_bits, ...) gehören nicht hierher, sie folgen aus dem Hex-Feld davor.
+
+[REC]
+CONTIMODE_SENDING
+CONTIMODE_CHANGES
+ACK
+NACK
+PAYLOAD
+M_R_USB_CONNECTSTATUS
+M_R_DISCOVER
+M_R_PIN
+M_R_REMOTEMODE
+M_R_TEMPUNIT
+M_R_LANGUAGE
+M_R_PINENABLED
+M_R_STATIONLOCKED
+BEEP
+M_R_BEEP
+M_R_TOOLERROR
+M_R_RBT_CONNCONFIG
+M_R_RBT_CONNECTSTATUS
+M_R_CONNECTTOOL
+M_R_LEVELSTEMPS
+M_R_CARTRIDGE
+M_R_HIBERDELAY
+M_R_SLEEPDELAY
+M_R_SLEEPTEMP
+M_R_AJUSTTEMP
+M_R_TRAFOTEMP
+M_R_MOSTEMP
+M_R_POWER
+M_R_QST_STATUS
+M_R_DELAYTIME
+M_R_ETH_TCPIPCONFIG
+M_R_ETH_CONNECTSTATUS
+M_R_ALARM_MAXTEMP
+M_R_ALARM_MINTEMP
+M_R_ALARM_TEMP
+M_R_MAXTEMP
+M_R_MINTEMP
+M_R_POWERLIM
+M_R_CONTIMODE
+M_R_LOCK_PORT
+M_R_QST_ACTIVATE
+M_R_TYPEOFGROUND
+M_R_STATERROR
+M_R_PERIPHCOUNT
+M_R_PERIPHCONFIG
+M_R_PERIPHSTATUS
+M_R_PLUGTIME
+M_R_WORKTIME
+M_R_SLEEPTIME
+M_R_HIBERTIME
+M_R_NOTOOLTIME
+M_R_SLEEPCYCLES
+M_R_DESOLCYCLES
+M_R_PLUGTIMEP
+M_R_WORKTIMEP
+M_R_SLEEPTIMEP
+M_R_HIBERTIMEP
+M_R_NOTOOLTIMEP
+M_R_SLEEPCYCLESP
+M_R_DESOLCYCLESP
+M_R_WORKCYCLES
+M_R_SUCTIONCYCLES
+M_R_WORKCYCLESP
+M_R_SUCTIONCYCLESP
+M_R_AIRFLOW
+AIRFLOW
+M_R_STARTMODE
+M_R_EXTTCMODE
+M_R_THEME
+M_R_HEATERSTATUS
+M_R_SUCTIONSTATUS
+M_R_PROFILEMODE
+M_R_SELECTFLOW
+M_R_SELECTEXTTEMP
+M_R_TIMETOSTOP
+M_R_MAXMINTEMP
+M_R_MAXMINFLOW
+M_R_MAXMINEXTTEMP
+M_R_DATETIME
+M_R_SELECTPOWER
+M_R_WARNING
+M_R_ACTIVEZONES
+M_R_WORKMODE
+M_R_FLOW
+M_R_SPEED
+M_R_SUCTIONLEVEL
+M_R_FILTERSTATUS
+M_R_CONNECTEDPEDAL
+M_R_RESETFILTER
+M_R_COUNTERS
+PIN
+M_R_ACTIVATIONPEDAL
+M_R_PEDALMODE
+M_R_INTAKEACTIVATION
+M_R_SUCTIONDELAY
+M_R_LENGTH
+M_R_PROGRAM
+M_R_DISPENSERMODE
+M_R_BACKWARDMODE
+M_R_TOOLENABLED
+M_R_LENGTHUNIT
+SF_RAW
+LEVELSTEMPS/ACK
+LOCK_PORT/ACK
+M_R_DEVICENAME
+M_FIRMWARE
+PK/FW/HW
+MODEL
+M_R_DEVICEID
+M_R_DEVICEIDORIGINAL
+M_INF_PORT
+M_R_STATUSTOOL
+M_R_SELECTTEMP
+M_R_TIPTEMP
+M_R_CURRENT
+M_R_AIRTEMP
+M_R_EXTTCTEMP
+CONTIMODE_SUMMARY
+
+[FIELD]
+seq
+port
+tip1_c
+tip2_c
+power_pct
+flags
+changes
+air_c
+flow_set_pct
+ext_tc_c
+flow_act
+flow_act_pct
+tts
+status
+mask
+text
+raw
+mode
+present
+ack
+nack
+code
+pin
+on
+unit
+name
+src
+speed_code
+baud
+databits
+parity
+parity_raw
+stopbits
+stopbits_raw
+addr_enabled
+addr_enabled_raw
+addr
+tail
+state
+state_char
+sel
+l1_on
+l1_c
+l1_uti
+l2_on
+l2_c
+l2_uti
+l3_on
+l3_c
+l3_uti
+tool
+tool_name
+nbr
+adj300_c
+adj400_c
+group
+family
+min
+c
+uti
+delta_c
+pct
+mmss
+sec
+tag
+next
+dhcp
+ip
+gw
+dns
+lowbyte_name
+count
+active
+idx
+payload
+hm
+value
+ds
+max_c
+min_c
+max_pct
+min_pct
+iso
+year
+month
+day
+hour
+sod
+connected
+ms
+tip1_uti
+tip2_uti
+power_raw
+flow_set_raw
+flow_raw
+result
+extra
+reason
+reason_name
+cmd
+arg0
+proto
+sw
+hw
+type
+ver
+ports
+vid
+pid
+w0
+w1
+w2
+w3
+tool_code
+prot_tc_c
+flow_pct
+temp_c
+heater_raw
+tool_err
+tool_err_name
+pwr1_pct
+pwr2_pct
+len
+truncated
+string
@@ -0,0 +1,621 @@
+# SPDX-License-Identifier: MIT OR GPL-2.0-only
+#
+# JBC-Kommandoliste – einzige Quelle für
+#   jbc_commands_full.h   (Ctrl-IDs je Familie)
+#   jbc_cmd_tables.h      (Namen, CLI-Mapping, Antwort-Erwartung, ArgFmt)
+#   jbc_ctrl_meta.h       (Ctrl-Flags je Backend)
+# Nach Änderungen:  python3 tools/gen_jbc_tables.py
+#
+# [FORMATS]: CLI-Argumentformate (Reihenfolge = enum ArgFmt)
+#   NAME   PROGRAMM   # CLI-Argumente (Text der Fehlermeldung "Erwartet: ...")
+#   PROGRAMM = Payload-Felder in Draht-Reihenfolge, je Feld TYP:ARG ("-" = keine Payload)
+#     ARG  CLI-Argument 1..11 (Token nach dem Namen); "?" am Ende = optional, fehlt -> 0
+#     u8 / u16      Zahl (0x.. oder dezimal), u16 als LE
+#     bool          u8, nur 0 oder 1
+#     temp / dtemp  °C -> UTI (x9) als u16 / int16 LE
+#     port          u8, gegen die Portanzahl des Backends geprüft
+#     tool          u8 oder Tool-Alias (T245, JT, ...)
+#     ip            a.b.c.d -> 4 Byte
+#     str           Rest der Zeile als ASCII (ohne ARG)
+#     raw:N         alle Argumente ab N als u8
+#
+# [FAMILIE]: eine Zeile je Kommando, nach Ctrl aufsteigend
+#   NAME   CTRL   CLI   REPLY   [# Hinweis]
+#   CLI    ArgFmt ohne "FMT_" oder "-" (nicht über die Konsole erreichbar)
+#   REPLY  ACK  = Write, Antwort 0x06.. gilt als ACK
+#          DATA = Antwort trägt den gelesenen Wert
+#          -    = keine definierte Antwort
+
+[FORMATS]
+# NAME                     PROGRAMM (Draht-Reihenfolge)                                  # CLI-Argumente
+NONE                       -                                                             #
+PORT                       port:1                                                        # <port>
+PORT_TOOL                  port:1 tool:2                                                 # <port> <tool>
+U8                         u8:1                                                          # <u8>
+U16                        u16:1                                                         # <u16>
+TEMP                       temp:1                                                        # <°C>
+U16_U16                    u16:1 u16:2                                                   # <u16> <u16>
+TEMP_TEMP                  temp:1 temp:2                                                 # <°C> <°C>
+STRING                     str                                                           # <Text>
+RAWHEX                     raw:1                                                         # <byte> [byte...]  (0x.. oder dezimal)
+IPCFG                      bool:1 ip:2 ip:3 ip:4 ip:5? u16:6?                            # <dhcp> <ip> <mask> <gw> [dns] [port]
+W_MASK_INDEX               u8:2 u8:1                                                     # <index> <mask>
+W_PORT_U8                  u8:2 port:1                                                   # <port> <u8>
+W_PORT_U16                 u16:2 port:1                                                  # <port> <u16>
+W_PORT_TEMP                temp:2 port:1                                                 # <port> <°C>
+W_PORT_3TEMP               temp:2 temp:3 temp:4 port:1                                   # <port> <t1> <t2> <t3>
+W_PORT_TOOL_U8             u8:3 port:1 tool:2                                            # <port> <tool> <u8>
+W_PORT_TOOL_U16            u16:3 port:1 tool:2                                           # <port> <tool> <u16>
+W_PORT_TOOL_TEMP           temp:3 port:1 tool:2                                          # <port> <tool> <°C>
+W_PORT_TOOL_3TEMP          temp:3 temp:4 temp:5 port:1 tool:2                            # <port> <tool> <t1> <t2> <t3>
+W_PORT_TOOL_U8_U8          u8:3 u8:4 port:1 tool:2                                       # <port> <tool> <value> <onoff>
+W_LEVELSTEMPS_S02          u8:3 u8:4 u8:5 temp:6 u8:7 temp:8 u8:9 temp:10 port:1 tool:2  # <port> <tool> <onoff> <sel> <l1_on> <l1°C> <l2_on> <l2°C> <l3_on> <l3°C>
+W_PORT_TOOL_TEMPDELTA      dtemp:3 port:1 tool:2                                         # <port> <tool> <Δ°C>
+W_DT6                      u16:1 u8:2 u8:3 u8:4 u8:5 u8:6                                # yyyy mm dd HH MM SS
+
+[BASE]
+M_HS                         0  -                      -
+M_ACK                        6  -                      -
+M_NACK                      21  -                      -
+M_SYN                       22  -                      -
+M_RESET                     32  -                      -
+M_FIRMWARE                  33  -                      DATA
+
+[FE_02]
+M_HS                         0  -                      -
+M_EOT                        4  -                      -
+M_ACK                        6  -                      -
+M_NACK                      21  -                      -
+M_SYN                       22  -                      -
+M_R_DEVICEIDORIGINAL        28  NONE                   DATA
+M_R_DISCOVER                29  NONE                   DATA
+M_R_DEVICEID                30  NONE                   DATA
+M_W_DEVICEID                31  RAWHEX                 ACK
+M_RESET                     32  -                      -
+M_FIRMWARE                  33  NONE                   DATA
+M_CLEARMEMFLASH             34  -                      -
+M_SENDMEMADDRESS            35  -                      -
+M_SENDMEMDATA               36  -                      -
+M_ENDPROGR                  37  -                      -
+M_ENDUPD                    38  -                      -
+M_CONTINUEUPD               39  -                      -
+M_CLEARING                  40  -                      -
+M_FORCEUPDATE               41  -                      -
+M_R_SUCTIONLEVEL            48  NONE                   DATA
+M_W_SUCTIONLEVEL            49  U16                    ACK
+M_R_FLOW                    50  NONE                   DATA
+M_R_SPEED                   51  NONE                   DATA
+M_R_SELECTFLOW              52  NONE                   DATA
+M_W_SELECTFLOW              53  U16                    ACK
+M_R_STANDINTAKES            54  NONE                   DATA
+M_W_STANDINTAKES            55  U8                     ACK   # 0/1
+M_R_INTAKEACTIVATION        56  NONE                   DATA
+M_W_INTAKEACTIVATION        57  U8                     ACK
+M_R_SUCTIONDELAY            58  NONE                   DATA
+M_W_SUCTIONDELAY            59  U16                    ACK
+M_R_DELAYTIME               60  NONE                   DATA
+M_R_ACTIVATIONPEDAL         61  NONE                   DATA
+M_W_ACTIVATIONPEDAL         62  U8                     ACK
+M_R_PEDALMODE               63  NONE                   DATA
+M_W_PEDALMODE               64  U8                     ACK
+M_R_FILTERSTATUS            65  NONE                   DATA
+M_R_RESETFILTER             66  NONE                   DATA
+M_R_CONNECTEDPEDAL          68  NONE                   DATA
+M_RESETSTATION              80  -                      -
+M_R_PIN                     81  NONE                   DATA
+M_W_PIN                     82  U16                    ACK
+M_R_STATIONLOCKED           83  NONE                   DATA
+M_W_STATIONLOCKED           84  U8                     ACK
+M_R_BEEP                    85  NONE                   DATA
+M_W_BEEP                    86  U8                     ACK
+M_R_CONTINUOUSSUCTION       87  NONE                   DATA
+M_W_CONTINUOUSSUCTION       88  U8                     ACK   # 0/1
+M_R_STATERROR               89  NONE                   DATA
+M_R_DEVICENAME              91  NONE                   DATA
+M_W_DEVICENAME              92  STRING                 ACK
+M_R_PINENABLED              93  NONE                   DATA
+M_W_PINENABLED              94  U8                     ACK
+M_W_WORKINTAKES             96  U8                     ACK
+M_R_COUNTERS               192  NONE                   DATA
+M_R_RESETCOUNTERS          193  NONE                   DATA
+M_R_COUNTERSP              194  -                      DATA
+M_R_RESETCOUNTERSP         195  NONE                   DATA
+M_R_USB_CONNECTSTATUS      224  NONE                   DATA
+M_W_USB_CONNECTSTATUS      225  STRING                 ACK
+M_R_RBT_CONNCONFIG         240  -                      DATA
+M_W_RBT_CONNCONFIG         241  -                      -
+M_R_RBT_CONNECTSTATUS      242  -                      DATA
+M_W_RBT_CONNECTSTATUS      243  -                      -
+
+[HA_02]
+M_HS                         0  -                      -
+M_EOT                        4  -                      -
+M_ACK                        6  -                      -
+M_NACK                      21  -                      -
+M_SYN                       22  -                      -
+M_R_DEVICEIDORIGINAL        28  NONE                   DATA  # Nicht Implementiert
+M_R_DISCOVER                29  NONE                   DATA  # Liefert ein nur ACK
+M_R_DEVICEID                30  NONE                   DATA  # JTSE hat keine, wird von der JCB Software zugewiesen
+M_W_DEVICEID                31  STRING                 ACK   # Nicht getestet, wird aber die Device ID überschreiben!
+M_RESET                     32  -                      -
+M_FIRMWARE                  33  NONE                   DATA  # Liefert Model und Firmwaredaten
+M_CLEARMEMFLASH             34  -                      -
+M_SENDMEMADDRESS            35  -                      -
+M_SENDMEMDATA               36  -                      -
+M_ENDPROGR                  37  -                      -
+M_ENDUPD                    38  -                      -
+M_CONTINUEUPD               39  -                      -
+M_CLEARING                  40  -                      -
+M_FORCEUPDATE               41  -                      -
+M_INF_PORT                  48  PORT                   DATA  # M_INF_PORT <PORT> liefert viele wichtige Daten über den Port
+M_RESET_PORTTOOL            49  -                      -
+M_R_PROFILEMODE             51  PORT                   DATA  # M_R_PROFILEMODE <PORT> Profilmode ON/OFF
+M_W_PROFILEMODE             52  W_PORT_U8              ACK   # M_W_PROFILEMODE <PORT> <0/1> Schaltet nur den Profimodus ein und aus
+M_R_HEATERSTATUS            53  PORT                   DATA  # M_R_HEATERSTATUS <PORT> Heater ON/OFF
+M_W_HEATERSTATUS            54  W_PORT_U8              ACK   # M_W_HEATERSTATUS <PORT> <0/1>
+M_R_SUCTIONSTATUS           55  PORT                   DATA  # M_R_SUCTIONSTATUS <PORT> Suction 1/0
+M_W_SUCTIONSTATUS           56  W_PORT_U8              ACK   # M_W_SUCTIONSTATUS <PORT> <0/1>
+M_R_EXTTCMODE               57  PORT_TOOL              DATA  # M_R_EXTTCMODE <PORT> <TOOL> liefert den Status in On Off
+M_W_EXTTCMODE               58  W_PORT_TOOL_U8         ACK
+M_R_LEVELSTEMPS             64  PORT_TOOL              DATA  # Nicht Implementiert
+M_W_LEVELSTEMPS             65  W_PORT_3TEMP           ACK
+M_R_AJUSTTEMP               66  PORT_TOOL              DATA  # M_R_AJUSTTEMP <PORT> <TOOL> liefert den Status in °C
+M_W_AJUSTTEMP               67  W_PORT_TOOL_TEMPDELTA  ACK   # Δ°C (signed)
+M_R_TIMETOSTOP              68  PORT_TOOL              DATA  # M_R_TIMETOSTOP <PORT> <TOOL> liefert den Status in Min
+M_W_TIMETOSTOP              69  W_PORT_TOOL_U16        ACK   # M_W_TIMETOSTOP <PORT> <TOOL> <Sekunden>
+M_R_STARTMODE               70  PORT_TOOL              DATA  # M_R_STARTMODE <PORT> <TOOL> Liefert die Startbedingungen z.B [STARTMODE] 0x09 [TOOL_BUTTON|PEDAL_HOLD_DOWN]
+M_W_STARTMODE               71  W_PORT_TOOL_U8         ACK   # M_W_STARTMODE <PORT> <TOOL> <1,4,8,9>
+M_R_SELECTTEMP              80  PORT                   DATA  # M_R_SELECTTEMP <PORT> liefert den Status der eingestellten Temperatur in °C
+M_W_SELECTTEMP              81  W_PORT_TEMP            ACK   # M_W_SELECTTEMP <PORT> <TEMP> Port ist 0 Temp 150-450°C
+M_R_AIRTEMP                 82  PORT                   DATA  # M_R_AIRTEMP <PORT> liefert den Status der aktuellen Düsentemperatur in °C
+M_R_POWER                   84  PORT                   DATA  # aktuelle Leistung/Power in %
+M_R_CONNECTTOOL             85  PORT                   DATA  # Liefert welches Handstück angeschlossen ist TE/JT
+M_R_TOOLERROR               86  PORT                   DATA  # liefert Toolerrors z.B. HA_NOTOOL
+M_R_STATUSTOOL              87  PORT                   DATA  # liefert Status des Tools z.B. Status=STAND
+M_R_SELECTFLOW              89  PORT                   DATA  # liefert eingestellten Flow des Tools in %
+M_W_SELECTFLOW              90  W_PORT_U16             ACK   # M_W_SELECTFLOW <PORT> <FLOW> Port ist 0 Flow 100-1000 (10-100%)
+M_R_SELECTEXTTEMP           91  PORT                   DATA  # liefert eingestellten Ext Temperatur in °C
+M_W_SELECTEXTTEMP           92  W_PORT_TEMP            ACK   # M_W_SELECTEXTTEMP <PORT> <TEMP> JTSE hat nur einen Port 0. Temp 25-450°C
+M_R_AIRFLOW                 93  PORT                   DATA
+M_R_EXTTCTEMP               95  PORT                   DATA
+M_R_REMOTEMODE              96  NONE                   DATA
+M_W_REMOTEMODE              97  U8                     ACK   # M_W_REMOTEMODE <1/0> bei meiner JTSE sehe ich keine Änderung
+M_R_CONTIMODE              128  NONE                   DATA
+M_W_CONTIMODE              129  W_MASK_INDEX           -
+M_I_CONTIMODE              130  NONE                   -
+M_READSTARTFILE            144  -                      -
+M_READFILEBLOCK            145  -                      -
+M_READENDOFFILE            146  -                      -
+M_WRITESTARTFILE           147  -                      -
+M_WRITEFILEBLOCK           148  -                      -
+M_WRITEENDOFFILE           149  -                      -
+M_R_FILESCOUNT             150  -                      DATA
+M_R_GETFILENAME            151  -                      DATA
+M_DELETEFILE               152  -                      -
+M_R_SELECTEDFILENAME       154  -                      DATA
+M_W_SELECTEDFILENAME       155  -                      -
+M_R_TEMPUNIT               160  NONE                   DATA
+M_W_TEMPUNIT               161  STRING                 ACK   # M_W_TEMPUNIT <C/F> Celsius oder Fahrenheit
+M_R_MAXMINTEMP             162  NONE                   DATA
+M_W_MAXMINTEMP             163  TEMP_TEMP              ACK   # M_W_MAXMINTEMP <MAX> <MIN> 150-450°C
+M_R_MAXMINFLOW             164  NONE                   DATA
+M_W_MAXMINFLOW             165  U16_U16                ACK   # M_W_MAXMINFLOW <MAX> <MIN> 100-1000 (10-100%)
+M_R_MAXMINEXTTEMP          166  -                      DATA
+M_W_MAXMINEXTTEMP          167  TEMP_TEMP              ACK   # M_W_MAXMINEXTTEMP <MAX> <MIN> 25-450°C
+M_R_PINENABLED             168  NONE                   DATA
+M_W_PINENABLED             169  U8                     ACK   # M_W_PINENABLED <0/1> mit 0 kannst du die Pinsperre Deaktivieren
+M_R_STATIONLOCKED          170  NONE                   DATA
+M_W_STATIONLOCKED          171  U8                     ACK   # M_W_STATIONLOCKED <1/0>
+M_R_PIN                    172  NONE                   DATA
+M_W_PIN                    173  STRING                 ACK   # M_W_PIN <1234> Nach dem Befehl ein Leerzeichen und dann ein Passwort aus 4 Zahlen
+M_R_STATERROR              174  NONE                   DATA
+M_RESETSTATION             176  -                      -
+M_R_DEVICENAME             177  NONE                   DATA
+M_W_DEVICENAME             178  STRING                 ACK   # M_W_DEVICENAME <ABCDEFGHIJKLMNOPQ> Maximal 17 Zeichen A-Z 0-9
+M_R_BEEP                   179  NONE                   DATA
+M_W_BEEP                   180  U8                     ACK   # M_W_BEEP <1/0>
+M_R_LANGUAGE               181  NONE                   DATA
+M_W_LANGUAGE               182  U8                     ACK   # Bei JTSE Implementiert
+M_R_DATETIME               187  NONE                   DATA
+M_W_DATETIME               188  W_DT6                  ACK   # yyyy mm dd HH MM SS Bei JTSE Implementiert
+M_R_THEME                  190  NONE                   DATA
+M_W_THEME                  191  U8                     ACK   # Bei JTSE Implementiert
+M_R_PLUGTIME               192  PORT                   DATA
+M_W_PLUGTIME               193  -                      -
+M_R_WORKTIME               194  PORT                   DATA
+M_W_WORKTIME               195  -                      -
+M_R_WORKCYCLES             196  PORT                   DATA
+M_W_WORKCYCLES             197  -                      -
+M_R_SUCTIONCYCLES          198  PORT                   DATA
+M_W_SUCTIONCYCLES          199  -                      -
+M_R_PLUGTIMEP              208  PORT                   DATA
+M_W_PLUGTIMEP              209  -                      -
+M_R_WORKTIMEP              210  PORT                   DATA
+M_W_WORKTIMEP              211  -                      -
+M_R_WORKCYCLESP            212  PORT                   DATA
+M_W_WORKCYCLESP            213  -                      -
+M_R_SUCTIONCYCLESP         214  PORT                   DATA
+M_W_SUCTIONCYCLESP         215  -                      -
+M_R_USB_CONNECTSTATUS      224  NONE                   DATA
+M_W_USB_CONNECTSTATUS      225  STRING                 ACK   # M_W_USB_CONNECTSTATUS <:C/:M> wenn Ihr Befehle Schreiben wollt erst mal auf :C
+M_R_RBT_CONNCONFIG         240  NONE                   DATA
+M_W_RBT_CONNCONFIG         241  -                      -
+M_R_RBT_CONNECTSTATUS      242  NONE                   DATA
+M_W_RBT_CONNECTSTATUS      243  -                      -
+
+[PH_02]
+M_HS                         0  -                      -
+M_EOT                        4  -                      -
+M_ACK                        6  -                      -
+M_NACK                      21  -                      -
+M_SYN                       22  -                      -
+M_R_DEVICEIDORIGINAL        28  NONE                   DATA
+M_R_DISCOVER                29  NONE                   DATA
+M_R_DEVICEID                30  NONE                   DATA
+M_W_DEVICEID                31  RAWHEX                 ACK
+M_RESET                     32  -                      -
+M_FIRMWARE                  33  NONE                   DATA
+M_CLEARMEMFLASH             34  -                      -
+M_SENDMEMADDRESS            35  -                      -
+M_SENDMEMDATA               36  -                      -
+M_ENDPROGR                  37  -                      -
+M_ENDUPD                    38  -                      -
+M_CONTINUEUPD               39  -                      -
+M_CLEARING                  40  -                      -
+M_FORCEUPDATE               41  -                      -
+M_INF_PORT                  48  PORT                   DATA
+M_R_WORKMODE                51  NONE                   DATA
+M_W_WORKMODE                52  U8                     ACK
+M_R_HEATERSTATUS            53  NONE                   DATA
+M_W_HEATERSTATUS            54  U8                     ACK   # 0/1
+M_R_EXTTCMODE               57  NONE                   DATA
+M_W_EXTTCMODE               58  U8                     ACK   # 0/1
+M_R_TIMETOSTOP              68  PORT                   DATA
+M_W_TIMETOSTOP              69  U16                    ACK   # 1/10 s
+M_R_SELECTTEMP              80  PORT                   DATA
+M_W_SELECTTEMP              81  W_PORT_TEMP            ACK
+M_R_SELECTPOWER             82  PORT                   DATA
+M_W_SELECTPOWER             83  W_PORT_U16             ACK   # 0..1000
+M_R_WARNING                 88  NONE                   DATA
+M_R_ACTIVEZONES             91  NONE                   DATA
+M_W_ACTIVEZONES             92  U8                     ACK   # Bitmaske
+M_R_EXTTCTEMP               95  NONE                   DATA
+M_R_REMOTEMODE              96  NONE                   DATA
+M_W_REMOTEMODE              97  U8                     ACK
+M_R_CONTIMODE              128  NONE                   DATA
+M_W_CONTIMODE              129  W_MASK_INDEX           ACK   # 0=OFF,1=ON
+M_I_CONTIMODE              130  NONE                   -
+M_R_PROFILE                144  NONE                   DATA
+M_W_PROFILE                145  U8                     ACK
+M_R_SETTINGSPROFILE        146  NONE                   DATA
+M_W_SETTINGSPROFILE        147  U8                     ACK
+M_R_PROFILETEACH           148  NONE                   DATA
+M_W_PROFILETEACH           149  U8                     ACK
+M_R_MAXMINPOWER            162  NONE                   DATA
+M_W_MAXMINPOWER            163  U16_U16                ACK
+M_R_MAXMINTEMP             166  NONE                   DATA
+M_W_MAXMINTEMP             167  TEMP_TEMP              ACK
+M_R_PINENABLED             168  NONE                   DATA
+M_W_PINENABLED             169  U8                     ACK
+M_R_STATIONLOCKED          170  NONE                   DATA
+M_W_STATIONLOCKED          171  U8                     ACK
+M_R_PIN                    172  NONE                   DATA
+M_W_PIN                    173  STRING                 ACK
+M_R_STATERROR              174  NONE                   DATA
+M_RESETSTATION             176  -                      -
+M_R_DEVICENAME             177  NONE                   DATA
+M_W_DEVICENAME             178  STRING                 ACK
+M_R_BEEP                   179  NONE                   DATA
+M_W_BEEP                   180  U8                     ACK
+M_R_PLUGTIME               192  PORT                   DATA
+M_W_PLUGTIME               193  -                      -
+M_R_WORKTIME               194  PORT                   DATA
+M_W_WORKTIME               195  -                      -
+M_R_WORKCYCLES             199  PORT                   DATA
+M_W_WORKCYCLES             200  -                      -
+M_R_PLUGTIMEP              208  PORT                   DATA
+M_W_PLUGTIMEP              209  -                      -
+M_R_WORKTIMEP              210  PORT                   DATA
+M_W_WORKTIMEP              211  -                      -
+M_R_WORKCYCLESP            215  PORT                   DATA
+M_W_WORKCYCLESP            216  -                      -
+M_R_USB_CONNECTSTATUS      224  NONE                   DATA
+M_W_USB_CONNECTSTATUS      225  STRING                 ACK
+M_R_RBT_CONNCONFIG         240  -                      DATA
+M_W_RBT_CONNCONFIG         241  -                      -
+M_R_RBT_CONNECTSTATUS      242  -                      DATA
+M_W_RBT_CONNECTSTATUS      243  -                      -
+
+[SF_02]
+M_HS                         0  -                      -
+M_EOT                        4  -                      -
+M_ACK                        6  -                      -
+M_NACK                      21  -                      -
+M_SYN                       22  -                      -
+M_R_DEVICEIDORIGINAL        28  NONE                   DATA
+M_R_DISCOVER                29  NONE                   DATA
+M_R_DEVICEID                30  NONE                   DATA
+M_W_DEVICEID                31  RAWHEX                 ACK
+M_RESET                     32  -                      -
+M_FIRMWARE                  33  NONE                   DATA
+M_CLEARMEMFLASH             34  -                      -
+M_SENDMEMADDRESS            35  -                      -
+M_SENDMEMDATA               36  -                      -
+M_ENDPROGR                  37  -                      -
+M_ENDUPD                    38  -                      -
+M_CONTINUEUPD               39  -                      -
+M_CLEARING                  40  -                      -
+M_FORCEUPDATE               41  -                      -
+M_R_DISPENSERMODE           48  NONE                   DATA
+M_W_DISPENSERMODE           49  U8                     ACK
+M_R_PROGRAM                 50  NONE                   DATA
+M_W_PROGRAM                 51  U8                     ACK
+M_R_PROGRAMLIST             52  NONE                   DATA
+M_W_PROGRAMLIST             53  U8                     ACK
+M_R_SPEED                   54  NONE                   DATA
+M_W_SPEED                   55  U16                    ACK
+M_R_LENGTH                  56  NONE                   DATA
+M_W_LENGTH                  57  U16                    ACK
+M_R_STARTFEEDING            58  NONE                   DATA
+M_R_STOPTFEEDING            59  NONE                   DATA
+M_R_FEEDING                 60  NONE                   DATA
+M_R_BACKWARDMODE            61  NONE                   DATA
+M_W_BACKWARDMODE            62  U8                     ACK
+M_RESETSTATION              80  -                      -
+M_R_PIN                     81  NONE                   DATA
+M_W_PIN                     82  U16                    ACK
+M_R_STATIONLOCKED           83  NONE                   DATA
+M_W_STATIONLOCKED           84  U8                     ACK
+M_R_BEEP                    85  NONE                   DATA
+M_W_BEEP                    86  U8                     ACK
+M_R_LENGTHUNIT              87  NONE                   DATA
+M_W_LENGTHUNIT              88  U8                     ACK
+M_R_STATERROR               89  NONE                   DATA
+M_R_RESETERROR              90  NONE                   DATA
+M_R_DEVICENAME              91  NONE                   DATA
+M_W_DEVICENAME              92  STRING                 ACK
+M_R_TOOLENABLED             93  NONE                   DATA
+M_W_TOOLENABLED             94  U8                     ACK
+M_R_PINENABLED              95  NONE                   DATA
+M_W_PINENABLED              96  -                      -
+M_R_COUNTERS               192  NONE                   DATA
+M_R_RESETCOUNTERS          193  NONE                   DATA
+M_R_COUNTERSP              194  NONE                   DATA
+M_R_RESETCOUNTERSP         195  NONE                   DATA
+M_R_USB_CONNECTSTATUS      224  NONE                   DATA
+M_W_USB_CONNECTSTATUS      225  STRING                 ACK
+M_R_RBT_CONNCONFIG         240  -                      DATA
+M_W_RBT_CONNCONFIG         241  -                      -
+M_R_RBT_CONNECTSTATUS      242  -                      DATA
+M_W_RBT_CONNECTSTATUS      243  -                      -
+
+[SOLD_01]
+M_NULL                       0  -                      -
+M_EOT                        4  -                      -
+M_ACK                        6  -                      -
+M_NACK                      21  -                      -
+M_SYN                       22  -                      -
+M_R_CONNECTSTATUS           30  NONE                   DATA
+M_W_CONNECTSTATUS           31  STRING                 -
+M_RESET                     32  -                      -
+M_FIRMWARE                  33  NONE                   DATA
+M_INF_PORT                  48  PORT                   DATA
+M_R_FIXTEMP                 49  NONE                   DATA
+M_W_FIXTEMP                 50  W_PORT_TEMP            -
+M_R_LEVELTEMP               51  -                      DATA
+M_W_LEVELTEMP               52  W_PORT_TEMP            -
+M_R_LEVEL1                  53  PORT                   DATA
+M_W_LEVEL1                  54  W_PORT_TEMP            -
+M_R_LEVEL2                  55  PORT                   DATA
+M_W_LEVEL2                  56  W_PORT_TEMP            -
+M_R_LEVEL3                  57  PORT                   DATA
+M_W_LEVEL3                  58  W_PORT_TEMP            -
+M_R_SLEEPDELAY              64  PORT                   DATA
+M_W_SLEEPDELAY              65  W_PORT_U16             -
+M_R_SLEEPTEMP               66  PORT                   DATA
+M_W_SLEEPTEMP               67  W_PORT_TEMP            -
+M_R_HIBERDELAY              68  PORT                   DATA
+M_W_HIBERDELAY              69  W_PORT_U16             -
+M_R_AJUSTTEMP               70  PORT                   DATA
+M_W_AJUSTTEMP               71  W_PORT_TOOL_TEMPDELTA  -     # Δ°C (signed)
+M_R_SELECTTEMP              80  PORT                   DATA
+M_W_SELECTTEMP              81  W_PORT_TEMP            -
+M_R_TIPTEMP                 82  PORT                   DATA
+M_R_CURRENT                 83  PORT                   DATA
+M_R_POWER                   84  PORT                   DATA
+M_R_CONNECTTOOL             85  PORT                   DATA
+M_R_TOOLERROR               86  PORT                   DATA
+M_R_STATUSTOOL              87  PORT                   DATA
+M_R_MOSTEMP                 88  PORT                   DATA
+M_R_DELAYTIME               89  NONE                   DATA
+M_R_REMOTEMODE              96  NONE                   DATA
+M_W_REMOTEMODE              97  U8                     -
+M_R_STATUSREMOTEMODE        98  NONE                   DATA
+M_R_CONTIMODE              128  NONE                   DATA
+M_W_CONTIMODE              129  W_MASK_INDEX           -     # 0=OFF,1=ON
+M_I_CONTIMODE              130  NONE                   -
+M_R_TEMPUNIT               160  NONE                   DATA
+M_W_TEMPUNIT               161  U8                     -
+M_R_MAXTEMP                162  NONE                   DATA
+M_W_MAXTEMP                163  TEMP                   -
+M_R_MINTEMP                164  NONE                   DATA
+M_W_MINTEMP                165  TEMP                   -
+M_R_NITROMODE              166  NONE                   DATA
+M_W_NITROMODE              167  U8                     -
+M_R_HELPTEXT               168  NONE                   DATA
+M_W_HELPTEXT               169  STRING                 -
+M_R_POWERLIM               170  NONE                   DATA
+M_W_POWERLIM               171  U16                    -
+M_R_PIN                    172  NONE                   DATA
+M_W_PIN                    173  STRING                 -
+M_R_STATERROR              174  NONE                   DATA
+M_R_TRAFOTEMP              175  NONE                   DATA
+M_RESETSTATION             176  -                      -
+M_R_DEVICENAME             177  NONE                   DATA
+M_W_DEVICENAME             178  STRING                 -
+M_R_BEEP                   179  NONE                   DATA
+M_W_BEEP                   180  U8                     -
+M_R_LANGUAGE               181  NONE                   DATA
+M_W_LANGUAGE               182  U8                     -
+M_R_TEMPERRORTRAFO         183  NONE                   DATA
+M_R_TEMPERRORMOS           184  NONE                   DATA
+M_R_DEVICEID               185  NONE                   DATA
+M_W_DEVICEID               186  RAWHEX                 -
+M_R_PLUGTIME               192  PORT                   DATA
+M_W_PLUGTIME               193  -                      -
+M_R_WORKTIME               194  PORT                   DATA
+M_W_WORKTIME               195  -                      -
+M_R_SLEEPTIME              196  PORT                   DATA
+M_W_SLEEPTIME              197  -                      -
+M_R_HIBERTIME              198  PORT                   DATA
+M_W_HIBERTIME              199  -                      -
+M_R_NOTOOLTIME             200  PORT                   DATA
+M_W_NOTOOLTIME             201  -                      -
+M_R_SLEEPCYCLES            202  PORT                   DATA
+M_W_SLEEPCYCLES            203  -                      -
+M_R_DESOLCYCLES            204  PORT                   DATA
+M_W_DESOLCYCLES            205  -                      -
+M_R_QST_ACTIVATE           208  NONE                   DATA
+M_W_QST_ACTIVATE           209  U8                     -
+M_R_QST_STATUS             210  NONE                   DATA
+M_W_QST_STATUS             211  U8                     -
+M_R_LOCK_PORT              212  PORT                   DATA
+M_W_LOCK_PORT              213  W_PORT_U8              -
+
+[SOLD_02]
+M_HS                         0  -                      -
+M_EOT                        4  -                      -
+M_ACK                        6  -                      -
+M_NACK                      21  -                      -
+M_SYN                       22  -                      -
+M_R_DEVICEIDORIGINAL        28  NONE                   DATA
+M_R_DISCOVER                29  NONE                   DATA
+M_R_DEVICEID                30  NONE                   DATA
+M_W_DEVICEID                31  RAWHEX                 ACK
+M_RESET                     32  -                      -
+M_FIRMWARE                  33  NONE                   DATA
+M_CLEARMEMFLASH             34  -                      -
+M_SENDMEMADDRESS            35  -                      -
+M_SENDMEMDATA               36  -                      -
+M_ENDPROGR                  37  -                      -
+M_ENDUPD                    38  -                      -
+M_CONTINUEUPD               39  -                      -
+M_CLEARING                  40  -                      -
+M_INF_PORT                  48  PORT                   DATA
+M_RESET_PORTTOOL            49  -                      -
+M_R_LEVELSTEMPS             51  PORT_TOOL              DATA  # M_R_LEVELSTEMPS <PORT> <TOOL>  Port 0-3 Tool z.B. T210, T245, DR usw.
+M_W_LEVELSTEMPS             52  W_LEVELSTEMPS_S02      ACK   # M_W_LEVELSTEMPS <PORT> <TOOL> <1/0 Levelsstemps> <SelL1-L3> <L1 1/0> <L1 TEMP> <L2 1/0> <L1 TEMP> <L3 1/0> <L3 TEMP> Beispiel: M_W_LEVELSTEMPS 0 T245 1 0 1 350 1 320 1 280
+M_R_SLEEPDELAY              64  PORT_TOOL              DATA
+M_W_SLEEPDELAY              65  W_PORT_TOOL_U8_U8      ACK
+M_R_SLEEPTEMP               66  PORT_TOOL              DATA
+M_W_SLEEPTEMP               67  W_PORT_TOOL_TEMP       ACK
+M_R_HIBERDELAY              68  PORT_TOOL              DATA
+M_W_HIBERDELAY              69  W_PORT_TOOL_U8_U8      ACK
+M_R_AJUSTTEMP               70  PORT_TOOL              DATA
+M_W_AJUSTTEMP               71  W_PORT_TOOL_TEMPDELTA  ACK   # Δ°C (signed)
+M_R_CARTRIDGE               72  PORT_TOOL              DATA
+M_W_CARTRIDGE               73  RAWHEX                 ACK
+M_R_SELECTTEMP              80  PORT                   DATA
+M_W_SELECTTEMP              81  W_PORT_TEMP            ACK
+M_R_TIPTEMP                 82  PORT                   DATA
+M_R_CURRENT                 83  PORT                   DATA
+M_R_POWER                   84  PORT                   DATA
+M_R_CONNECTTOOL             85  PORT                   DATA
+M_R_TOOLERROR               86  PORT                   DATA
+M_R_STATUSTOOL              87  PORT                   DATA
+M_W_SELECTTEMPVOLATILE      88  W_PORT_TEMP            ACK
+M_R_MOSTEMP                 89  PORT                   DATA
+M_R_DELAYTIME               90  PORT                   DATA
+M_R_REMOTEMODE              96  NONE                   DATA
+M_W_REMOTEMODE              97  U8                     ACK   # 0=OFF,1=ON
+M_R_CONTIMODE              128  NONE                   DATA
+M_W_CONTIMODE              129  W_MASK_INDEX           ACK   # 0=OFF,1=ON
+M_I_CONTIMODE              130  W_MASK_INDEX           -
+M_R_ALARMMAXTEMP           131  PORT                   DATA
+M_W_ALARMMAXTEMP           132  W_PORT_TEMP            ACK
+M_R_ALARMMINTEMP           133  PORT                   DATA
+M_W_ALARMMINTEMP           134  W_PORT_TEMP            ACK
+M_R_ALARMTEMP              135  PORT                   DATA
+M_R_LOCK_PORT              136  PORT                   DATA
+M_W_LOCK_PORT              137  W_PORT_U8              ACK
+M_READSTARTFILE            144  -                      -
+M_READFILEBLOCK            145  -                      -
+M_READENDOFFILE            146  -                      -
+M_WRITESTARTFILE           147  -                      -
+M_WRITEFILEBLOCK           148  -                      -
+M_WRITEENDOFFILE           149  -                      -
+M_R_FILESCOUNT             150  -                      DATA
+M_R_GETFILENAME            151  -                      DATA
+M_DELETEFILE               152  -                      -
+M_R_SELECTEDFILENAME       154  -                      DATA
+M_W_SELECTEDFILENAME       155  -                      -
+M_R_QST_ACTIVATE           156  NONE                   DATA
+M_W_QST_ACTIVATE           157  U8                     ACK
+M_R_QST_STATUS             158  NONE                   DATA
+M_W_QST_STATUS             159  U8                     ACK
+M_R_TEMPUNIT               160  NONE                   DATA
+M_W_TEMPUNIT               161  U8                     ACK
+M_R_MAXTEMP                162  NONE                   DATA
+M_W_MAXTEMP                163  TEMP                   ACK
+M_R_MINTEMP                164  NONE                   DATA
+M_W_MINTEMP                165  TEMP                   ACK
+M_R_POWERLIM               170  NONE                   DATA
+M_W_POWERLIM               171  U16                    ACK
+M_R_PIN                    172  NONE                   DATA
+M_W_PIN                    173  STRING                 ACK
+M_R_STATERROR              174  NONE                   DATA
+M_R_TRAFOTEMP              175  NONE                   DATA
+M_RESETSTATION             176  -                      -
+M_R_DEVICENAME             177  NONE                   DATA
+M_W_DEVICENAME             178  STRING                 ACK
+M_R_BEEP                   179  NONE                   DATA
+M_W_BEEP                   180  U8                     ACK
+M_R_LANGUAGE               181  NONE                   DATA
+M_W_LANGUAGE               182  U8                     ACK
+M_W_TYPEOFGROUND           185  U8                     ACK
+M_R_TYPEOFGROUND           186  NONE                   DATA
+M_R_PLUGTIME               192  PORT                   DATA
+M_W_PLUGTIME               193  -                      -
+M_R_WORKTIME               194  PORT                   DATA
+M_W_WORKTIME               195  -                      -
+M_R_SLEEPTIME              196  PORT                   DATA
+M_W_SLEEPTIME              197  -                      -
+M_R_HIBERTIME              198  PORT                   DATA
+M_W_HIBERTIME              199  -                      -
+M_R_NOTOOLTIME             200  PORT                   DATA
+M_W_NOTOOLTIME             201  -                      -
+M_R_SLEEPCYCLES            202  PORT                   DATA
+M_W_SLEEPCYCLES            203  -                      -
+M_R_DESOLCYCLES            204  PORT                   DATA
+M_W_DESOLCYCLES            205  -                      -
+M_W_RESETCOUNTERS          206  NONE                   ACK
+M_R_PLUGTIMEP              208  PORT                   DATA
+M_W_PLUGTIMEP              209  -                      -
+M_R_WORKTIMEP              210  PORT                   DATA
+M_W_WORKTIMEP              211  -                      -
+M_R_SLEEPTIMEP             212  PORT                   DATA
+M_W_SLEEPTIMEP             213  -                      -
+M_R_HIBERTIMEP             214  PORT                   DATA
+M_W_HIBERTIMEP             215  -                      -
+M_R_NOTOOLTIMEP            216  PORT                   DATA
+M_W_NOTOOLTIMEP            217  -                      -
+M_R_SLEEPCYCLESP           218  PORT                   DATA
+M_W_SLEEPCYCLESP           219  -                      -
+M_R_DESOLCYCLESP           220  PORT                   DATA
+M_W_DESOLCYCLESP           221  -                      -
+M_W_RESETCOUNTERSP         222  -                      -
+M_R_USB_CONNECTSTATUS      224  NONE                   DATA
+M_W_USB_CONNECTSTATUS      225  STRING                 ACK
+M_R_ETH_TCPIPCONFIG        231  NONE                   DATA
+M_W_ETH_TCPIPCONFIG        232  IPCFG                  ACK
+M_R_ETH_CONNECTSTATUS      233  NONE                   DATA
+M_W_ETH_CONNECTSTATUS      234  STRING                 ACK
+M_R_RBT_CONNCONFIG         240  NONE                   DATA
+M_W_RBT_CONNCONFIG         241  -                      -
+M_R_RBT_CONNECTSTATUS      242  NONE                   DATA
+M_W_RBT_CONNECTSTATUS      243  -                      -
+M_R_PERIPHCOUNT            249  NONE                   DATA
+M_R_PERIPHCONFIG           250  PORT                   DATA
+M_W_PERIPHCONFIG           251  RAWHEX                 ACK
+M_R_PERIPHSTATUS           252  PORT                   DATA
+M_W_PERIPHSTATUS           253  RAWHEX                 ACK